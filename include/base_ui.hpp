@@ -4,13 +4,19 @@
 #include "models.hpp"
 #include "solver.hpp"
 #include "gantt_maker.hpp"
+#include "gantt_batch.hpp"
+#include "text_batch.hpp"
 #include "parser.hpp"
+#include "thread_pool.hpp"
+#include "binary_solution.hpp"
 #include <SFML/Graphics.hpp>
 #include <SFML/Window.hpp>
 #include <vector>
 #include <memory>
 #include <string>
 #include <functional>
+#include <atomic>
+#include <mutex>
 
 /**
  * Enumeration for different view modes in the UI.
@@ -73,6 +79,35 @@ private:
     // Scrolling state
     int fileScrollOffset;
     
+    // Viewer mode for large binary solutions, used instead of currentResult
+    struct ViewSpan {
+        float x;
+        float width;
+        int jobId;    // -1 if the span merges operations of several jobs
+        bool packed;  // made of operations narrower than a pixel
+    };
+    std::unique_ptr<BinarySolutionView> solutionView;
+    long long viewFrom = 0; // visible time window
+    long long viewTo = 1;
+    int viewFirstMachine = 0; // top visible machine row
+    sf::FloatRect viewArea; // chart area of the last frame, for zooming at the cursor
+    std::vector<std::vector<ViewSpan>> viewRows; // spans of the visible rows
+    std::string viewBatchKey; // window and layout viewRows and ganttBatch were built for
+    static constexpr size_t VIEWER_MIN_ENTRIES = 200000;
+    
+    // Gantt chart geometry and labels, rebuilt when the result, the viewer window or the layout changes
+    GanttBatch ganttBatch;
+    TextBatch ganttText{font}; // axis, machine and job id labels
+    sf::Text ganttInfo;        // makespan line under the chart
+    std::weak_ptr<ScheduleResult> ganttBatchResult;       // result the batch was built for, unless in viewer mode
+    sf::Vector2u ganttBatchSize;                          // window size the batch was built for
+    
+    // Background exports
+    std::mutex exportLogMutex;
+    std::vector<std::string> exportLog; // lines posted by export jobs, moved to the console by update()
+    std::atomic<int> exportsPending{0};
+    std::unique_ptr<ThreadPool> exportQueue = std::make_unique<ThreadPool>(1); // declared last so it is joined first
+    
     // Helper methods
     /**
      * Loads the font for UI elements.
@@ -130,6 +165,40 @@ private:
      */
     void drawGanttInMain();
 
+    /**
+     * Draws the visible part of the solution open in viewer mode.
+     */
+    void drawSolutionView();
+
+    /**
+     * Decodes the visible rows of the viewer into pixel spans. Operations
+     * narrower than a pixel are merged, so a row never holds more spans
+     * than it is wide.
+     *
+     * Args:
+     *   rows: Number of visible machine rows.
+     *   width: Chart width in pixels.
+     */
+    void buildViewRows(int rows, float width);
+
+    /**
+     * Zooms the viewer's time window.
+     *
+     * Args:
+     *   factor: New window length over the current one.
+     *   anchor: Position in the window that stays in place, 0 to 1.
+     */
+    void zoomSolutionView(double factor, double anchor);
+
+    /**
+     * Moves the viewer's time window and machine rows.
+     *
+     * Args:
+     *   fraction: Time shift as a fraction of the window length.
+     *   rows: Number of machine rows to scroll.
+     */
+    void panSolutionView(double fraction, int rows);
+
     /**
      * Logs a message to the console.
      *
@@ -138,6 +207,20 @@ private:
      */
     void logToConsole(const std::string& message);
 
+    /**
+     * Queues a console message from any thread. The message is shown on
+     * the next update() of the UI thread.
+     *
+     * Args:
+     *   message: Message to log.
+     */
+    void postToConsole(const std::string& message);
+
+    /**
+     * Moves the messages posted by export jobs into the console.
+     */
+    void drainExportLog();
+
     /**
      * Creates a button and adds it to a container.
      *
@@ -191,12 +274,14 @@ public:
 
 
     /**
-     * Opens an interactive dialog to export Gantt chart.
+     * Exports the Gantt chart as PNG. The chart is rendered on the UI thread
+     * and encoded by the background export queue.
      */
     void exportGanttChartInteractive();
 
     /**
-     * Opens an interactive dialog to export solution.
+     * Exports the solution in every format through the background export
+     * queue, which works on a private copy of the current result.
      */
     void exportSolutionInteractive();
 
@@ -206,7 +291,9 @@ public:
     void loadSolutionInteractive();
 
     /**
-     * Loads a solution from a file.
+     * Loads a solution from a file. Binary solutions with at least
+     * VIEWER_MIN_ENTRIES operations open in viewer mode, which maps the
+     * file and decodes only the visible part of the chart.
      *
      * Args:
      *   filename: Path to the solution file.
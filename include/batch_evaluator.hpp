@@ -0,0 +1,255 @@
+#ifndef BATCH_EVALUATOR_HPP
+#define BATCH_EVALUATOR_HPP
+
+#include "flat_instance.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Enumeration for the instruction sets the batch evaluator can use.
+ */
+enum class EvaluatorBackend {
+    Scalar,
+    AVX2,   // 8 lanes
+    AVX512  // 16 lanes
+};
+
+/**
+ * Decodes many operation-based sequences at once and returns their makespans.
+ *
+ * A sequence lists job indices, each job repeated once per operation; the
+ * k-th occurrence of job j stands for its k-th operation. Decoding uses the
+ * same rule as Solver: an operation starts when both its machine and its job
+ * predecessor are free. The SIMD backends run one candidate per lane in
+ * lockstep over the FlatInstance arrays. By default the backend is picked
+ * by a one-off timing run, since the gather-bound kernels are slower than
+ * scalar code on some CPUs, and lane groups of large batches are spread
+ * over all hardware threads.
+ */
+class BatchEvaluator {
+public:
+    /**
+     * Constructor for BatchEvaluator using the fastest backend of this CPU,
+     * see selectBackend().
+     *
+     * Args:
+     *   instance: Flat instance to evaluate against. Must outlive the evaluator.
+     */
+    explicit BatchEvaluator(const FlatInstance& instance);
+
+    /**
+     * Constructor for BatchEvaluator with an explicit backend. Falls back to
+     * selectBackend() if the requested one is unavailable.
+     *
+     * Args:
+     *   instance: Flat instance to evaluate against.
+     *   backend: Requested backend.
+     */
+    BatchEvaluator(const FlatInstance& instance, EvaluatorBackend backend);
+
+    /**
+     * Evaluates a single sequence with the scalar decoder.
+     *
+     * Args:
+     *   sequence: Job-repetition sequence.
+     *
+     * Returns:
+     *   Makespan of the decoded schedule.
+     */
+    int evaluate(const std::vector<int>& sequence) const;
+
+    /**
+     * Evaluates a batch of sequences.
+     *
+     * Args:
+     *   sequences: Job-repetition sequences, each of length numOperations.
+     *
+     * Returns:
+     *   Makespan per sequence, in input order.
+     */
+    std::vector<int> evaluateBatch(const std::vector<std::vector<int>>& sequences) const;
+
+    /**
+     * Evaluates a batch stored row-major in one contiguous buffer.
+     *
+     * Args:
+     *   sequences: count * numOperations job indices.
+     *   count: Number of sequences.
+     *   makespans: Output array of count makespans.
+     */
+    void evaluateBatch(const int32_t* sequences, int count, int32_t* makespans) const;
+
+    /**
+     * Sets how many threads share a batch; all hardware threads by default.
+     * Small batches always run on the calling thread.
+     *
+     * Args:
+     *   threads: Thread count; 0 uses all hardware threads.
+     */
+    void setThreadCount(int threads);
+
+    /**
+     * Gets the number of threads used for large batches.
+     *
+     * Returns:
+     *   Thread count.
+     */
+    int getThreadCount() const { return threadCount; }
+
+    /**
+     * Gets the backend in use.
+     *
+     * Returns:
+     *   Active backend.
+     */
+    EvaluatorBackend getBackend() const { return backend; }
+
+    /**
+     * Gets the number of candidates decoded in lockstep.
+     *
+     * Returns:
+     *   Lane count of the active backend.
+     */
+    int getLaneCount() const;
+
+    /**
+     * Detects the widest backend supported by the running CPU.
+     *
+     * Returns:
+     *   Widest available backend.
+     */
+    static EvaluatorBackend detectBackend();
+
+    /**
+     * Selects the backend that decodes fastest on this CPU. The first call
+     * times every supported backend on a random 50x15 instance; a SIMD
+     * backend is only picked if it beats scalar by 10%. Later calls return
+     * the same choice.
+     *
+     * Returns:
+     *   Fastest backend.
+     */
+    static EvaluatorBackend selectBackend();
+
+    /**
+     * Checks whether a backend can run on this CPU.
+     *
+     * Args:
+     *   backend: Backend to check.
+     *
+     * Returns:
+     *   True if supported.
+     */
+    static bool isSupported(EvaluatorBackend backend);
+
+    /**
+     * Gets the name of a backend.
+     *
+     * Args:
+     *   backend: Backend type.
+     *
+     * Returns:
+     *   Backend name string.
+     */
+    static std::string getBackendName(EvaluatorBackend backend);
+
+private:
+    /**
+     * Scratch buffers owned by one worker thread. Lane-interleaved for the
+     * SIMD backends, plain per-job and per-machine arrays for the scalar one.
+     */
+    struct LaneScratch {
+        std::vector<int32_t> jobNext;      // [job * lanes + lane] -> next operation
+        std::vector<int32_t> jobReady;     // [job * lanes + lane]
+        std::vector<int32_t> machineReady; // [machine * lanes + lane]
+    };
+
+    const FlatInstance& instance;
+    EvaluatorBackend backend;
+    int threadCount;
+
+    /**
+     * Times each supported backend on a random instance and candidate batch.
+     *
+     * Returns:
+     *   Fastest backend, scalar unless a SIMD backend is clearly faster.
+     */
+    static EvaluatorBackend calibrate();
+
+    /**
+     * Evaluates a contiguous range of sequences on the calling thread.
+     *
+     * Args:
+     *   sequences: First sequence of the range.
+     *   count: Number of sequences.
+     *   makespans: Output array of count makespans.
+     *   scratch: Worker scratch buffers.
+     */
+    void evaluateRange(const int32_t* sequences, int count, int32_t* makespans, LaneScratch& scratch) const;
+
+    /**
+     * Decodes one sequence with plain scalar code, validating it on the way.
+     * Throws std::invalid_argument if the sequence is not a valid
+     * job-repetition sequence.
+     *
+     * Args:
+     *   sequence: Job-repetition sequence.
+     *   scratch: Worker scratch buffers.
+     *
+     * Returns:
+     *   Makespan.
+     */
+    int decodeScalar(const int32_t* sequence, LaneScratch& scratch) const;
+
+    /**
+     * Resets per-lane job and machine state before decoding a lane group.
+     *
+     * Args:
+     *   scratch: Worker scratch buffers.
+     *   lanes: Lane count.
+     */
+    void resetLanes(LaneScratch& scratch, int lanes) const;
+
+    /**
+     * Checks that every lane consumed each job exactly jobLength times.
+     *
+     * Args:
+     *   scratch: Worker scratch buffers after decoding a lane group.
+     *   lanes: Lane count.
+     *
+     * Returns:
+     *   True if all lanes held valid job-repetition sequences.
+     */
+    bool countsMatch(const LaneScratch& scratch, int lanes) const;
+
+    /**
+     * Decodes one lane group with AVX2 (8 lanes).
+     *
+     * Args:
+     *   sequences: First sequence of the group, row-major.
+     *   groupSize: Number of real sequences in the group.
+     *   scratch: Worker scratch buffers, reset for 8 lanes.
+     *   makespans: Output makespans of the 8 lanes.
+     *
+     * Returns:
+     *   False if a lane read a job index out of range.
+     */
+    bool decodeGroupAVX2(const int32_t* sequences, int groupSize, LaneScratch& scratch, int32_t* makespans) const;
+
+    /**
+     * Decodes one lane group with AVX-512 (16 lanes).
+     *
+     * Args:
+     *   sequences: First sequence of the group, row-major.
+     *   groupSize: Number of real sequences in the group.
+     *   scratch: Worker scratch buffers, reset for 16 lanes.
+     *   makespans: Output makespans of the 16 lanes.
+     *
+     * Returns:
+     *   False if a lane read a job index out of range.
+     */
+    bool decodeGroupAVX512(const int32_t* sequences, int groupSize, LaneScratch& scratch, int32_t* makespans) const;
+};
+
+#endif // BATCH_EVALUATOR_HPP
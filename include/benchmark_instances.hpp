@@ -0,0 +1,183 @@
+#ifndef BENCHMARK_INSTANCES_HPP
+#define BENCHMARK_INSTANCES_HPP
+
+#include "models.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * Layouts of the standard benchmark files.
+ */
+enum class BenchmarkFormat {
+    OR_LIBRARY, // "n m", then per job m pairs of 0-based machine and time
+    TAILLARD    // "n m", then an n x m time matrix and an n x m 1-based machine matrix
+};
+
+/**
+ * Seeds of a Taillard instance, as printed in the paper and in the header of
+ * each published file.
+ */
+struct TaillardSeeds {
+    int jobs = 0;
+    int machines = 0;
+    int32_t timeSeed = 0;
+    int32_t machineSeed = 0;
+};
+
+/**
+ * Reader for the OR-Library and Taillard instance layouts.
+ *
+ * Only lines that start with a digit or a sign hold data; names, comments
+ * and the "Times" / "Machines" labels of Taillard files are skipped.
+ * Operation ids are assigned job by job in file order, as Parser::parseFile
+ * does. Throws std::invalid_argument on malformed or truncated data.
+ */
+class BenchmarkReader {
+public:
+    /**
+     * Parses an instance in OR-Library layout. When a name is given, the
+     * text may be a collection such as jobshop1.txt and the instance that
+     * follows the line "instance <name>" is read.
+     *
+     * Args:
+     *   text: File contents.
+     *   name: Instance to read from a collection, or empty for the first.
+     *
+     * Returns:
+     *   Parsed problem instance.
+     */
+    static std::shared_ptr<ProblemInstance> parseORLibrary(const std::string& text, const std::string& name = "");
+
+    /**
+     * Parses an instance in Taillard layout.
+     *
+     * Args:
+     *   text: File contents.
+     *
+     * Returns:
+     *   Parsed problem instance.
+     */
+    static std::shared_ptr<ProblemInstance> parseTaillard(const std::string& text);
+
+    /**
+     * Reads the seeds from the header of a published Taillard file, whose
+     * first data line is "jobs machines timeSeed machineSeed upper lower".
+     *
+     * Args:
+     *   text: File contents.
+     *   seeds: Receives the seeds.
+     *
+     * Returns:
+     *   True if the header holds seeds.
+     */
+    static bool readTaillardSeeds(const std::string& text, TaillardSeeds& seeds);
+
+    /**
+     * Guesses the layout of a file: Taillard if it has "Times" or
+     * "Machines" labels, OR-Library otherwise. Unlabelled Taillard files
+     * must be read with an explicit format.
+     *
+     * Args:
+     *   text: File contents.
+     *
+     * Returns:
+     *   Detected format.
+     */
+    static BenchmarkFormat detectFormat(const std::string& text);
+
+    /**
+     * Loads an instance file. Throws std::runtime_error if it cannot be read.
+     *
+     * Args:
+     *   filename: Path to instance file.
+     *   format: Layout of the file.
+     *
+     * Returns:
+     *   Parsed problem instance.
+     */
+    static std::shared_ptr<ProblemInstance> loadFile(const std::string& filename, BenchmarkFormat format);
+
+    /**
+     * Loads an instance file, detecting its layout.
+     *
+     * Args:
+     *   filename: Path to instance file.
+     *
+     * Returns:
+     *   Parsed problem instance.
+     */
+    static std::shared_ptr<ProblemInstance> loadFile(const std::string& filename);
+};
+
+/**
+ * Taillard's instance generator (E. Taillard, "Benchmarks for basic
+ * scheduling problems", EJOR 64, 1993).
+ *
+ * Durations are drawn uniformly from 1..99 with the time seed, job by job.
+ * Each job's route starts as machines 1..m and position j is swapped with a
+ * position drawn from j..m-1 with the machine seed. Both streams use the
+ * paper's Lehmer generator (a = 16807, m = 2^31 - 1, Schrage's method), so
+ * the published instances are reproduced exactly from their seeds.
+ */
+class TaillardGenerator {
+public:
+    /**
+     * Generates an instance from its seeds.
+     *
+     * Args:
+     *   seeds: Dimensions and seeds.
+     *
+     * Returns:
+     *   Generated problem instance.
+     */
+    static std::shared_ptr<ProblemInstance> generate(const TaillardSeeds& seeds);
+
+    /**
+     * Generates a published instance by name, e.g. "ta01". Throws
+     * std::invalid_argument if its seeds are not in the built-in table.
+     *
+     * Args:
+     *   name: Instance name.
+     *
+     * Returns:
+     *   Generated problem instance.
+     */
+    static std::shared_ptr<ProblemInstance> generate(const std::string& name);
+
+    /**
+     * Looks up the seeds of a published instance.
+     *
+     * Args:
+     *   name: Instance name.
+     *   seeds: Receives the seeds.
+     *
+     * Returns:
+     *   True if the instance is in the built-in table.
+     */
+    static bool findSeeds(const std::string& name, TaillardSeeds& seeds);
+
+    /**
+     * Gets the names of the instances in the built-in table.
+     *
+     * Returns:
+     *   Instance names.
+     */
+    static std::vector<std::string> getInstanceNames();
+
+    /**
+     * Draws from the paper's uniform generator and advances the seed.
+     *
+     * Args:
+     *   seed: Generator state, in 1..2^31 - 2.
+     *   low: Smallest value.
+     *   high: Largest value.
+     *
+     * Returns:
+     *   Value in low..high.
+     */
+    static int unif(int32_t& seed, int low, int high);
+};
+
+#endif // BENCHMARK_INSTANCES_HPP
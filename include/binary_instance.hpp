@@ -0,0 +1,116 @@
+#ifndef BINARY_INSTANCE_HPP
+#define BINARY_INSTANCE_HPP
+
+#include "flat_instance.hpp"
+#include "models.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+
+/**
+ * Binary .jsspb instance files, laid out like FlatInstance so they can be
+ * memory-mapped and used in place.
+ *
+ * Layout (little-endian; every array starts on a 64-byte boundary):
+ *
+ *   header     128 bytes: "JSPB", version, byte-order mark, header size,
+ *              job/machine/operation counts, file size, checksum of
+ *              everything after the header, and the offset of each array
+ *   jobStarts  int32[numJobs + 1]
+ *   jobs       int32[numOperations]
+ *   machines   int32[numOperations]
+ *   durations  int32[numOperations]
+ *   ids        int32[numOperations], ascending within each job
+ *
+ * Loading checks the header against the file size, the checksum and every
+ * index, since the solver indexes the arrays directly. Files that are known
+ * to be intact can skip the verification; loading then takes the same few
+ * microseconds for any instance size and pages are read lazily as the
+ * solver touches them.
+ */
+class BinaryInstance {
+public:
+    static constexpr uint32_t VERSION = 1;
+
+    /**
+     * Writes a flat instance as .jsspb. Throws std::runtime_error if the
+     * file cannot be written.
+     *
+     * Args:
+     *   instance: Instance to write.
+     *   filename: Output file path.
+     */
+    static void write(const FlatInstance& instance, const std::string& filename);
+
+    /**
+     * Writes a flat instance in .jsspb layout to a stream, for embedding
+     * in other files. The caller checks the stream state.
+     *
+     * Args:
+     *   instance: Instance to write.
+     *   out: Output stream.
+     *
+     * Returns:
+     *   Number of bytes written, a multiple of 64.
+     */
+    static size_t write(const FlatInstance& instance, std::ostream& out);
+
+    /**
+     * Writes a problem instance as .jsspb, in the operation order used by
+     * FlatInstance::fromProblem.
+     *
+     * Args:
+     *   problem: Instance to write.
+     *   filename: Output file path.
+     */
+    static void write(const ProblemInstance& problem, const std::string& filename);
+
+    /**
+     * Maps a .jsspb file and returns a flat instance that reads the mapping
+     * in place. The mapping lives as long as the instance or any copy of
+     * it. Throws std::runtime_error if the file cannot be mapped or is not
+     * a valid .jsspb file.
+     *
+     * Args:
+     *   filename: Path to .jsspb file.
+     *   verify: Also check the checksum and that every index is in range.
+     *     Only skip this for files already verified.
+     *
+     * Returns:
+     *   Flat instance backed by the file.
+     */
+    static FlatInstance load(const std::string& filename, bool verify = true);
+
+    /**
+     * Returns a flat instance that reads a .jsspb image in place, such as
+     * one embedded in a larger mapping. Throws std::runtime_error if the
+     * image is not valid.
+     *
+     * Args:
+     *   data: Image bytes, at least 4-byte aligned.
+     *   size: Image size in bytes.
+     *   owner: Keeps the bytes alive.
+     *   verify: Also check the checksum and that every index is in range.
+     *   name: Source named in error messages.
+     *
+     * Returns:
+     *   Flat instance viewing the image.
+     */
+    static FlatInstance fromBuffer(const char* data, size_t size, std::shared_ptr<const void> owner, bool verify,
+                                   const std::string& name);
+
+    /**
+     * Checks whether a file starts with the .jsspb magic.
+     *
+     * Args:
+     *   filename: Path to file.
+     *
+     * Returns:
+     *   True for .jsspb files.
+     */
+    static bool isBinary(const std::string& filename);
+};
+
+#endif // BINARY_INSTANCE_HPP
@@ -0,0 +1,234 @@
+#ifndef BINARY_SOLUTION_HPP
+#define BINARY_SOLUTION_HPP
+
+#include "mapped_file.hpp"
+#include "models.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * Compact binary encoding of a ScheduleResult, used by ExportFormat::BINARY.
+ *
+ * Layout (little-endian):
+ *
+ *   header     64 bytes: "JSSL", version, job and machine counts, makespan,
+ *              total completion time, average flow time, body size,
+ *              directory offset, FNV-1a checksum of the body
+ *   jobs       per job: operation count, then per operation the machine,
+ *              processing time and operationId (delta to the previous id)
+ *   machines   one chunk per machine: available time, operation count, then
+ *              per operation its job, its index in the job, the idle gap
+ *              before its start and its end relative to start + duration
+ *   extras     start/end of operations that are not on any machine but
+ *              carry times (normally none)
+ *   directory  per machine: chunk offset, operation count and chunk size
+ *
+ * Integers are LEB128 varints, zigzag-encoded where they may be negative.
+ * Dense schedules cost about eight bytes per operation. The directory lets a
+ * reader decode a single machine's chunk without reading the others.
+ */
+class BinarySolution {
+public:
+    static constexpr uint32_t VERSION = 1;
+    static constexpr size_t HEADER_SIZE = 64;
+
+    /**
+     * Encodes a schedule result. Throws std::runtime_error if a machine
+     * schedule refers to an operation that is not in any job, or a value
+     * cannot be encoded.
+     *
+     * Args:
+     *   result: Schedule result to encode.
+     *
+     * Returns:
+     *   Encoded bytes.
+     */
+    static std::string encode(const ScheduleResult& result);
+
+    /**
+     * Decodes a schedule result. Machine schedules share the Operation
+     * objects of the jobs. Throws std::runtime_error if the data is
+     * truncated, corrupt, or of another version.
+     *
+     * Args:
+     *   data: Encoded bytes.
+     *   size: Number of bytes.
+     *
+     * Returns:
+     *   Decoded schedule result.
+     */
+    static std::shared_ptr<ScheduleResult> decode(const char* data, size_t size);
+
+    /**
+     * Checks whether a buffer starts with the binary solution magic.
+     *
+     * Args:
+     *   data: Buffer.
+     *   size: Number of bytes.
+     *
+     * Returns:
+     *   True for binary solutions.
+     */
+    static bool hasMagic(const char* data, size_t size);
+
+    /**
+     * Checks whether a file starts with the binary solution magic, whatever
+     * its extension.
+     *
+     * Args:
+     *   filename: File path.
+     *
+     * Returns:
+     *   True for binary solutions.
+     */
+    static bool isBinary(const std::string& filename);
+};
+
+/**
+ * Read-only view of a binary solution file that decodes only the parts of
+ * the schedule being looked at.
+ *
+ * Opening maps the file and reads the header and the machine directory, so
+ * it takes the same time for any schedule size. The first query scans the
+ * job section once into a table of processing times (and operation ids,
+ * unless they are consecutive). The first query of a machine decodes its
+ * chunk once to build a time index with one block per BLOCK_SIZE entries.
+ * Later queries start at the first block that can overlap the time window
+ * and stop after the window ends, so they decode about as many entries as
+ * they return.
+ *
+ * Memory use is about 4.5 bytes per operation once every machine has been
+ * visited (8.5 if the operation ids are not consecutive), against about 80
+ * for a decoded ScheduleResult. Operations
+ * are passed to the caller one at a time and never kept. Times of
+ * operations that are not on any machine are not read.
+ */
+class BinarySolutionView {
+public:
+    static constexpr size_t BLOCK_SIZE = 64;
+
+    /**
+     * Opens a binary solution file. Throws std::runtime_error if it cannot
+     * be mapped, is not a binary solution, or its header or directory is
+     * corrupt. Corrupt chunks are reported by the query that reaches them.
+     *
+     * Args:
+     *   filename: Path to the .jsol file.
+     *   verify: Also check the checksum, which reads the whole file.
+     */
+    explicit BinarySolutionView(const std::string& filename, bool verify = false);
+
+    int getNumJobs() const { return numJobs; }
+    int getNumMachines() const { return static_cast<int>(chunks.size()); }
+    int getMakespan() const { return makespan; }
+    int getTotalCompletionTime() const { return totalCompletionTime; }
+    double getAvgFlowTime() const { return avgFlowTime; }
+
+    /**
+     * Gets the number of machine schedule entries.
+     *
+     * Returns:
+     *   Entries over all machines.
+     */
+    size_t getNumEntries() const { return numEntries; }
+
+    /**
+     * Gets the number of entries of one machine.
+     *
+     * Args:
+     *   machine: Machine index.
+     *
+     * Returns:
+     *   Entry count.
+     */
+    size_t getMachineSize(int machine) const;
+
+    /**
+     * Calls a function for each operation of a machine that overlaps the
+     * time window [from, to), in machine schedule order. An operation of
+     * length zero overlaps if it starts in the window. Throws
+     * std::runtime_error if the data reached is corrupt.
+     *
+     * Args:
+     *   machine: Machine index.
+     *   from: Window start.
+     *   to: Window end.
+     *   visitor: Called with each overlapping operation.
+     */
+    void visit(int machine, int from, int to, const std::function<void(const Operation&)>& visitor);
+
+    /**
+     * Collects the operations of a machine that overlap the time window
+     * [from, to), as visit() finds them.
+     *
+     * Args:
+     *   machine: Machine index.
+     *   from: Window start.
+     *   to: Window end.
+     *
+     * Returns:
+     *   Overlapping operations in machine schedule order.
+     */
+    std::vector<Operation> query(int machine, int from, int to);
+
+    /**
+     * Gets the memory held by the lazily built tables.
+     *
+     * Returns:
+     *   Size in bytes.
+     */
+    size_t getIndexBytes() const;
+
+private:
+    /**
+     * Directory entry of a machine chunk.
+     */
+    struct Chunk {
+        uint64_t offset;
+        uint32_t count;
+        uint32_t bytes;
+    };
+
+    /**
+     * Decoder state at the start of a block of BLOCK_SIZE entries, and the
+     * latest end of any entry up to the end of the block.
+     */
+    struct Block {
+        uint64_t offset;
+        int64_t previousEnd;
+        int64_t maxEnd;
+    };
+
+    MappedFile file;
+    int numJobs;
+    int makespan;
+    int totalCompletionTime;
+    double avgFlowTime;
+    size_t numEntries;
+    uint64_t directoryOffset;
+    std::vector<Chunk> chunks;
+
+    bool jobsLoaded;
+    std::vector<size_t> jobStart;    // global index of each job's first operation
+    std::vector<int> durations;      // by global index
+    std::vector<int> operationIds;   // by global index; empty if ids are consecutive from 0
+    std::vector<std::vector<Block>> blocks; // per machine, empty until first visited
+    std::vector<bool> indexed;
+    std::vector<bool> sorted;        // whether a machine's entries are ordered by start time
+
+    /**
+     * Scans the job section into the duration and id tables.
+     */
+    void loadJobs();
+
+    /**
+     * Builds the time index of a machine.
+     */
+    void indexMachine(int machine);
+};
+
+#endif // BINARY_SOLUTION_HPP
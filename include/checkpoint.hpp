@@ -0,0 +1,143 @@
+#ifndef CHECKPOINT_HPP
+#define CHECKPOINT_HPP
+
+#include "elite_pool.hpp"
+#include "flat_instance.hpp"
+#include "lns_engine.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Everything needed to continue a search exactly where it stopped.
+ */
+struct SearchCheckpoint {
+    uint64_t instanceFingerprint = 0; // CheckpointFile::fingerprint of the instance
+    uint64_t configFingerprint = 0;   // CheckpointFile::fingerprint of the solver config text
+    MachineSequences current;
+    int currentMakespan = 0;
+    MachineSequences best;            // incumbent
+    int bestMakespan = 0;
+    std::vector<EliteSolution> elites;
+    std::vector<uint64_t> tabu;
+    std::vector<uint64_t> rngState;   // words of the engine's generator state
+    int nextNeighborhood = 0;
+    LNSStatistics statistics;         // includes the iteration counter
+};
+
+/**
+ * Append-only binary checkpoint file.
+ *
+ * The first write of a CheckpointFile object writes a full snapshot to a
+ * temporary file and renames it into place. Later writes append only the
+ * sections that changed since the previous write (current schedule,
+ * incumbent, elite pool) followed by a small state record that commits
+ * them; an unchanged incumbent costs nothing. Every record carries a
+ * checksum, so a write torn by preemption is ignored when reading and the
+ * previous committed state is used. Once the log grows well past the size
+ * of a snapshot it is compacted into a fresh snapshot.
+ */
+class CheckpointFile {
+public:
+    /**
+     * Constructor for CheckpointFile. Nothing is touched until the first
+     * read or write.
+     *
+     * Args:
+     *   path: Checkpoint file path.
+     */
+    explicit CheckpointFile(const std::string& path);
+    ~CheckpointFile();
+
+    CheckpointFile(const CheckpointFile&) = delete;
+    CheckpointFile& operator=(const CheckpointFile&) = delete;
+
+    /**
+     * Saves a checkpoint, appending only what changed since the last write.
+     * Throws std::runtime_error if the file cannot be written.
+     *
+     * Args:
+     *   state: State to save.
+     *
+     * Returns:
+     *   Bytes written.
+     */
+    size_t write(const SearchCheckpoint& state);
+
+    /**
+     * Loads the last committed checkpoint.
+     *
+     * Args:
+     *   state: Receives the checkpoint.
+     *
+     * Returns:
+     *   True if a checkpoint was found, false if the file is missing or
+     *   holds no complete checkpoint.
+     */
+    bool read(SearchCheckpoint& state) const;
+
+    /**
+     * Deletes the checkpoint file.
+     */
+    void remove();
+
+    /**
+     * Gets the checkpoint file path.
+     *
+     * Returns:
+     *   File path.
+     */
+    const std::string& getPath() const { return path; }
+
+    /**
+     * Computes a fingerprint of an instance, used to reject checkpoints of
+     * other instances.
+     *
+     * Args:
+     *   instance: Flat instance.
+     *
+     * Returns:
+     *   64-bit fingerprint.
+     */
+    static uint64_t fingerprint(const FlatInstance& instance);
+
+    /**
+     * Computes a fingerprint of a configuration, used to reject checkpoints
+     * made with other parameters.
+     *
+     * Args:
+     *   text: Configuration text, such as SolverConfig::toString().
+     *
+     * Returns:
+     *   64-bit fingerprint.
+     */
+    static uint64_t fingerprint(const std::string& text);
+
+private:
+    std::string path;
+    int fd;                   // open for appending after the first write
+    size_t fileSize;
+    size_t snapshotSize;      // size of the last full snapshot
+    MachineSequences lastCurrent;
+    MachineSequences lastBest;
+    std::vector<uint64_t> lastElites; // hashes of the elites last written
+
+    /**
+     * Writes a full snapshot and reopens the file for appending.
+     *
+     * Args:
+     *   state: State to save.
+     *
+     * Returns:
+     *   Bytes written.
+     */
+    size_t writeSnapshot(const SearchCheckpoint& state);
+
+    /**
+     * Remembers the sections of a state as written.
+     */
+    void remember(const SearchCheckpoint& state);
+};
+
+#endif // CHECKPOINT_HPP
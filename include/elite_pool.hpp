@@ -0,0 +1,117 @@
+#ifndef ELITE_POOL_HPP
+#define ELITE_POOL_HPP
+
+#include "flat_instance.hpp"
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+/**
+ * A schedule kept in the elite pool.
+ */
+struct EliteSolution {
+    MachineSequences sequences;
+    int makespan;
+    uint64_t hash;
+};
+
+/**
+ * Bounded pool of good and mutually different schedules.
+ *
+ * Distance between two schedules is the number of operation pairs that
+ * the two schedules process in opposite order on some machine. A candidate
+ * that is not a new best must be at least minDistance away from every
+ * member. When the pool is full, a better candidate replaces the most
+ * similar member among those it beats. All methods are thread-safe.
+ */
+class ElitePool {
+public:
+    /**
+     * Constructor for ElitePool.
+     *
+     * Args:
+     *   capacity: Maximum number of schedules.
+     *   minDistance: Minimum distance to every member for non-best entries.
+     */
+    explicit ElitePool(int capacity, long minDistance = 1);
+
+    /**
+     * Offers a schedule to the pool.
+     *
+     * Args:
+     *   sequences: Flat operation indices per machine.
+     *   makespan: Makespan of the schedule.
+     *
+     * Returns:
+     *   True if the schedule was added.
+     */
+    bool tryInsert(const MachineSequences& sequences, int makespan);
+
+    /**
+     * Copies the current members.
+     *
+     * Returns:
+     *   Pool members sorted by makespan.
+     */
+    std::vector<EliteSolution> snapshot() const;
+
+    /**
+     * Gets the best member. Throws std::runtime_error if the pool is empty.
+     *
+     * Returns:
+     *   Copy of the best schedule.
+     */
+    EliteSolution getBest() const;
+
+    /**
+     * Gets the number of members.
+     *
+     * Returns:
+     *   Pool size.
+     */
+    int size() const;
+
+    /**
+     * Gets the maximum number of members.
+     *
+     * Returns:
+     *   Pool capacity.
+     */
+    int getCapacity() const { return capacity; }
+
+    /**
+     * Removes all members.
+     */
+    void clear();
+
+    /**
+     * Replaces the members with saved ones, as taken by snapshot(), without
+     * the admission tests. Hashes are recomputed and members beyond the
+     * capacity are dropped.
+     *
+     * Args:
+     *   members: Saved members.
+     */
+    void restore(std::vector<EliteSolution> members);
+
+    /**
+     * Counts operation pairs ordered differently by two schedules, summed
+     * over machines. Runs in O(n log n).
+     *
+     * Args:
+     *   a: First schedule.
+     *   b: Second schedule over the same operations.
+     *
+     * Returns:
+     *   Pairwise order distance.
+     */
+    static long distance(const MachineSequences& a, const MachineSequences& b);
+
+private:
+    int capacity;
+    long minDistance;
+    std::vector<EliteSolution> solutions; // sorted by makespan
+    mutable std::mutex mutex;
+};
+
+#endif // ELITE_POOL_HPP
@@ -0,0 +1,80 @@
+#ifndef FAST_PARSER_HPP
+#define FAST_PARSER_HPP
+
+#include "models.hpp"
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * A line of a .jssp file that was rejected.
+ */
+struct ParseError {
+    size_t line;         // 1-based line number
+    std::string message;
+};
+
+/**
+ * What a parse accepted and rejected. Rejected lines are skipped; only the
+ * first FastParser::MAX_REPORTED_ERRORS of them are described in errors, but
+ * all of them are counted in skipped.
+ */
+struct ParseReport {
+    std::vector<ParseError> errors;
+    size_t operations = 0; // operations accepted
+    size_t skipped = 0;    // lines rejected
+    size_t lines = 0;      // lines read, including the header
+
+    /**
+     * Checks whether every line was accepted.
+     *
+     * Returns:
+     *   True if nothing was skipped.
+     */
+    bool ok() const { return skipped == 0; }
+};
+
+/**
+ * Single-pass .jssp instance parser.
+ *
+ * Files are memory-mapped and tokenized in place with std::from_chars, which
+ * is locale-independent and does not allocate. The number of lines is
+ * counted first with memchr so the job operation lists are reserved before
+ * any operation is created. The format is the one read by Parser::parseFile:
+ * a "num_jobs num_machines" header, then one "job_id machine_id
+ * processing_time" line per operation. A line that is malformed or out of
+ * range is skipped and reported instead of printed.
+ */
+class FastParser {
+public:
+    static constexpr size_t MAX_REPORTED_ERRORS = 1000;
+
+    /**
+     * Parses a .jssp file. Throws std::runtime_error if the file cannot be
+     * read, the header is invalid, or no operation is valid.
+     *
+     * Args:
+     *   filename: Path to input file.
+     *   report: Receives the accepted and rejected lines.
+     *
+     * Returns:
+     *   Parsed problem instance.
+     */
+    static std::shared_ptr<ProblemInstance> parseFile(const std::string& filename, ParseReport& report);
+
+    /**
+     * Parses .jssp text held in memory, with the same rules as parseFile.
+     *
+     * Args:
+     *   data: Start of the text; need not be null-terminated.
+     *   size: Text length in bytes.
+     *   report: Receives the accepted and rejected lines.
+     *
+     * Returns:
+     *   Parsed problem instance.
+     */
+    static std::shared_ptr<ProblemInstance> parseBuffer(const char* data, size_t size, ParseReport& report);
+};
+
+#endif // FAST_PARSER_HPP
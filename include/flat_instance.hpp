@@ -0,0 +1,228 @@
+#ifndef FLAT_INSTANCE_HPP
+#define FLAT_INSTANCE_HPP
+
+#include "models.hpp"
+#include <cstdint>
+#include <vector>
+#include <memory>
+
+/**
+ * Processing order on each machine as flat operation indices, indexed by
+ * machine.
+ */
+using MachineSequences = std::vector<std::vector<int>>;
+
+/**
+ * Index-based, structure-of-arrays view of a problem instance.
+ *
+ * Operations are renumbered 0..numOperations-1 in job order, so the
+ * operations of job j occupy the range [jobStart(j), jobStart(j + 1)).
+ * Search code works on these indices instead of shared_ptr<Operation>.
+ *
+ * The arrays are immutable and shared: copies of a FlatInstance point at
+ * the same storage, which may be vectors built by fromProblem or a
+ * memory-mapped .jsspb file (see BinaryInstance).
+ */
+class FlatInstance {
+public:
+    /**
+     * Constructor for an empty FlatInstance.
+     */
+    FlatInstance()
+        : numJobs(0), numMachines(0), numOperations(0), jobStartData(nullptr), opJobData(nullptr),
+          opMachineData(nullptr), opDurationData(nullptr), opIdData(nullptr) {}
+
+    /**
+     * Builds the flat layout from a problem instance. Operations of each job
+     * are ordered by operationId, matching the precedence used by Solver.
+     *
+     * Args:
+     *   problem: Problem instance to flatten.
+     *
+     * Returns:
+     *   Flat instance.
+     */
+    static FlatInstance fromProblem(const ProblemInstance& problem);
+
+    /**
+     * Wraps arrays stored elsewhere without copying them. The arrays must
+     * follow the flat layout and stay valid while owner is alive.
+     *
+     * Args:
+     *   numJobs: Job count.
+     *   numMachines: Machine count.
+     *   numOperations: Operation count.
+     *   jobStarts: numJobs + 1 job start indices.
+     *   jobs: Job of each operation.
+     *   machines: Machine of each operation.
+     *   durations: Processing time of each operation.
+     *   operationIds: Original operationId of each operation.
+     *   owner: Keeps the arrays alive.
+     *
+     * Returns:
+     *   Flat instance viewing the arrays.
+     */
+    static FlatInstance fromArrays(int numJobs, int numMachines, int numOperations,
+                                   const int32_t* jobStarts, const int32_t* jobs, const int32_t* machines,
+                                   const int32_t* durations, const int32_t* operationIds,
+                                   std::shared_ptr<const void> owner);
+
+    /**
+     * Builds an unscheduled problem instance with the same jobs and
+     * operations.
+     *
+     * Returns:
+     *   Problem instance.
+     */
+    std::shared_ptr<ProblemInstance> toProblem() const;
+
+    /**
+     * Gets the number of jobs.
+     *
+     * Returns:
+     *   Job count.
+     */
+    int getNumJobs() const { return numJobs; }
+
+    /**
+     * Gets the number of machines.
+     *
+     * Returns:
+     *   Machine count.
+     */
+    int getNumMachines() const { return numMachines; }
+
+    /**
+     * Gets the total number of operations.
+     *
+     * Returns:
+     *   Operation count.
+     */
+    int getNumOperations() const { return numOperations; }
+
+    /**
+     * Gets the index of the first operation of a job. jobStart(numJobs)
+     * equals numOperations.
+     *
+     * Args:
+     *   job: Job index.
+     *
+     * Returns:
+     *   Flat index of the job's first operation.
+     */
+    int jobStart(int job) const { return jobStartData[job]; }
+
+    /**
+     * Gets the number of operations in a job.
+     *
+     * Args:
+     *   job: Job index.
+     *
+     * Returns:
+     *   Operation count of the job.
+     */
+    int jobLength(int job) const { return jobStartData[job + 1] - jobStartData[job]; }
+
+    /**
+     * Gets the job an operation belongs to.
+     *
+     * Args:
+     *   op: Flat operation index.
+     *
+     * Returns:
+     *   Job index.
+     */
+    int job(int op) const { return opJobData[op]; }
+
+    /**
+     * Gets the machine an operation runs on.
+     *
+     * Args:
+     *   op: Flat operation index.
+     *
+     * Returns:
+     *   Machine index.
+     */
+    int machine(int op) const { return opMachineData[op]; }
+
+    /**
+     * Gets the processing time of an operation.
+     *
+     * Args:
+     *   op: Flat operation index.
+     *
+     * Returns:
+     *   Processing time.
+     */
+    int duration(int op) const { return opDurationData[op]; }
+
+    /**
+     * Gets the original operationId of an operation.
+     *
+     * Args:
+     *   op: Flat operation index.
+     *
+     * Returns:
+     *   Operation ID as stored in the ProblemInstance.
+     */
+    int operationId(int op) const { return opIdData[op]; }
+
+    /**
+     * Finds the flat index of an operation by job and operation ID.
+     *
+     * Args:
+     *   jobId: Job ID.
+     *   operationId: Operation ID.
+     *
+     * Returns:
+     *   Flat index, or -1 if not found.
+     */
+    int indexOf(int jobId, int operationId) const;
+
+    /**
+     * Raw array accessors for vectorized kernels.
+     */
+    const int32_t* jobStarts() const { return jobStartData; }
+    const int32_t* operationJobs() const { return opJobData; }
+    const int32_t* machines() const { return opMachineData; }
+    const int32_t* durations() const { return opDurationData; }
+    const int32_t* operationIds() const { return opIdData; }
+
+    /**
+     * Builds an operation-based sequence (each job index repeated once per
+     * operation) from a scheduled problem, ordering operations by start time.
+     * Decoding the sequence reproduces the schedule or an earlier one.
+     *
+     * Args:
+     *   scheduled: Problem instance whose operations carry start times.
+     *
+     * Returns:
+     *   Job-repetition sequence of length numOperations.
+     */
+    std::vector<int> sequenceFromSchedule(const ProblemInstance& scheduled) const;
+
+    /**
+     * Reads the per-machine processing order from Machine::scheduledOperations
+     * of a scheduled problem.
+     *
+     * Args:
+     *   scheduled: Problem instance whose machines hold scheduled operations.
+     *
+     * Returns:
+     *   Flat operation indices per machine.
+     */
+    MachineSequences machineSequences(const ProblemInstance& scheduled) const;
+
+private:
+    int numJobs;
+    int numMachines;
+    int numOperations;
+    const int32_t* jobStartData;
+    const int32_t* opJobData;
+    const int32_t* opMachineData;
+    const int32_t* opDurationData;
+    const int32_t* opIdData;
+    std::shared_ptr<const void> storage; // keeps the arrays alive
+};
+
+#endif // FLAT_INSTANCE_HPP
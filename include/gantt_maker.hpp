@@ -2,6 +2,8 @@
 #define GANTT_MAKER_HPP
 
 #include "models.hpp"
+#include "gantt_batch.hpp"
+#include "text_batch.hpp"
 #include <SFML/Graphics.hpp>
 #include <SFML/Window.hpp>
 #include <SFML/System.hpp>
@@ -9,6 +11,7 @@
 #include <map>
 #include <memory>
 #include <iostream>
+#include <string>
 
 /**
  * Struct representing a single operation in the Gantt chart.
@@ -22,6 +25,10 @@ struct GanttOperation {
 
 /**
  * Class for creating and displaying Gantt charts.
+ *
+ * The grid, bars and outlines are kept in a GanttBatch that is rebuilt only
+ * when the result or the layout changes, so redrawing a chart takes a few
+ * draw calls whatever its size.
  */
 class GanttChartMaker {
 private:
@@ -44,36 +51,40 @@ private:
     // Colors for different jobs
     std::vector<sf::Color> jobColors;
     
+    // Chart geometry and labels, rebuilt when the result or the layout changes
+    GanttBatch chart;
+    TextBatch labels; // time axis, machine and operation labels
+    std::weak_ptr<ScheduleResult> chartResult; // result the chart was built for
+    bool chartDirty;
+    
     // Helper methods
     /**
-     * Draws the time axis.
+     * Adds the time axis labels to the label batch.
      *
      * Args:
      *   startX: Starting X position.
      *   startY: Starting Y position.
      *   maxTime: Maximum time value.
      */
-    void drawTimeAxis(float startX, float startY, int maxTime);
+    void addTimeAxisLabels(float startX, float startY, int maxTime);
 
     /**
-     * Draws machine labels.
+     * Adds the machine labels to the label batch.
      *
      * Args:
      *   startX: Starting X position.
      *   startY: Starting Y position.
-     *   problem: Problem instance.
+     *   numMachines: Number of machines.
      */
-    void drawMachineLabels(float startX, float startY, std::shared_ptr<ProblemInstance> problem);
+    void addMachineLabels(float startX, float startY, int numMachines);
 
     /**
-     * Draws operations on the chart.
+     * Draws the chart and label batches.
      *
      * Args:
-     *   startX: Starting X position.
-     *   startY: Starting Y position.
-     *   result: Schedule result.
+     *   target: Window or render texture to draw to.
      */
-    void drawOperations(float startX, float startY, std::shared_ptr<ScheduleResult> result);
+    void drawOperations(sf::RenderTarget& target);
 
     /**
      * Loads the font.
@@ -84,60 +95,23 @@ private:
     bool loadFont();
 
     /**
-     * Draws the grid.
-     *
-     * Args:
-     *   startX: Starting X position.
-     *   startY: Starting Y position.
-     *   maxTime: Maximum time.
-     *   numMachines: Number of machines.
-     */
-    void drawGrid(float startX, float startY, int maxTime, int numMachines);
-    
-    /**
-     * Draws the grid to a render texture.
-     *
-     * Args:
-     *   target: Render texture to draw to.
-     *   startX: Starting X position.
-     *   startY: Starting Y position.
-     *   maxTime: Maximum time.
-     *   numMachines: Number of machines.
-     */
-    void drawGridToTexture(sf::RenderTexture& target, float startX, float startY, int maxTime, int numMachines);
-    
-    /**
-     * Draws the time axis to a render texture.
-     *
-     * Args:
-     *   target: Render texture to draw to.
-     *   startX: Starting X position.
-     *   startY: Starting Y position.
-     *   maxTime: Maximum time value.
-     */
-    void drawTimeAxisToTexture(sf::RenderTexture& target, float startX, float startY, int maxTime);
-    
-    /**
-     * Draws machine labels to a render texture.
+     * Rebuilds the grid, tick, bar and outline batches and the labels,
+     * unless they were built for this result with the current layout.
      *
      * Args:
-     *   target: Render texture to draw to.
-     *   startX: Starting X position.
-     *   startY: Starting Y position.
-     *   problem: Problem instance.
+     *   result: Schedule result.
      */
-    void drawMachineLabelsToTexture(sf::RenderTexture& target, float startX, float startY, std::shared_ptr<ProblemInstance> problem);
-    
+    void buildChart(std::shared_ptr<ScheduleResult> result);
+
     /**
-     * Draws operations to a render texture.
+     * Draws the whole chart: title, batches, labels and legend.
      *
      * Args:
-     *   target: Render texture to draw to.
-     *   startX: Starting X position.
-     *   startY: Starting Y position.
-     *   result: Schedule result.
+     *   target: Window or render texture to draw to.
+     *   result: Schedule result the chart was built for.
+     *   legendY: Y position of the legend.
      */
-    void drawOperationsToTexture(sf::RenderTexture& target, float startX, float startY, std::shared_ptr<ScheduleResult> result);
+    void drawChart(sf::RenderTarget& target, const ScheduleResult& result, float legendY);
     
 public:
     /**
@@ -160,6 +134,18 @@ public:
     void displaySchedule(std::shared_ptr<ScheduleResult> result);
 
     // Save to file functionality
+    /**
+     * Renders the full Gantt chart into an image. Must run on the thread
+     * that owns the graphics context; encoding the image can run elsewhere.
+     *
+     * Args:
+     *   result: The schedule result to render.
+     *
+     * Returns:
+     *   The rendered chart, or an empty image if rendering failed.
+     */
+    sf::Image renderToImage(std::shared_ptr<ScheduleResult> result);
+
     /**
      * Saves the Gantt chart to a file.
      *
@@ -0,0 +1,121 @@
+#ifndef INSTANCE_GENERATOR_HPP
+#define INSTANCE_GENERATOR_HPP
+
+#include "models.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+
+/**
+ * How processing times are drawn. All of them stay within
+ * [minDuration, maxDuration].
+ */
+enum class DurationDistribution {
+    UNIFORM,     // uniform over the range
+    NORMAL,      // centred in the range, a sixth of the range as deviation, clamped
+    EXPONENTIAL  // minDuration plus an exponential tail with a quarter of the range as mean, clamped
+};
+
+/**
+ * How jobs are routed through the machines.
+ */
+enum class RoutingModel {
+    RANDOM_PERMUTATION, // every job visits the machines in its own random order
+    FLOW,               // every job visits the machines in increasing order
+    BOTTLENECK          // a share of all operations goes to a few bottleneck machines
+};
+
+/**
+ * Parameters of a generated instance.
+ */
+struct GeneratorConfig {
+    int jobs = 10;
+    int machines = 5;
+    int operationsPerJob = 0;      // 0 for one operation per machine
+    DurationDistribution durations = DurationDistribution::UNIFORM;
+    int minDuration = 1;
+    int maxDuration = 99;
+    RoutingModel routing = RoutingModel::RANDOM_PERMUTATION;
+    int bottlenecks = 1;           // BOTTLENECK: machines 0..bottlenecks-1 are the bottlenecks
+    double bottleneckShare = 0.5;  // BOTTLENECK: share of operations sent to them
+    uint64_t seed = 1;
+};
+
+/**
+ * Random instance generator for stress and scaling tests.
+ *
+ * Operations are produced job by job from a single seeded stream, so the
+ * same config always yields the same instance, whether it is built in
+ * memory or written to disk. Writing streams the operations through a fixed
+ * buffer and never holds the instance, so files of millions of operations
+ * cost only the time to format them.
+ *
+ * Routes with fewer operations than machines use a random subset of the
+ * machines (in increasing order for FLOW); longer routes revisit machines,
+ * with a fresh permutation per pass for RANDOM_PERMUTATION and cyclically
+ * for FLOW. BOTTLENECK routes never use the same machine twice in a row
+ * when there is another one.
+ */
+class InstanceGenerator {
+public:
+    /**
+     * Constructor for InstanceGenerator. Throws std::invalid_argument if the
+     * config is out of range.
+     *
+     * Args:
+     *   config: Instance parameters.
+     */
+    explicit InstanceGenerator(const GeneratorConfig& config);
+
+    /**
+     * Builds the instance in memory.
+     *
+     * Returns:
+     *   Generated problem instance.
+     */
+    std::shared_ptr<ProblemInstance> generate() const;
+
+    /**
+     * Streams the instance in .jssp format.
+     *
+     * Args:
+     *   out: Output stream.
+     *
+     * Returns:
+     *   Number of operations written.
+     */
+    size_t write(std::ostream& out) const;
+
+    /**
+     * Streams the instance to a .jssp file. Throws std::runtime_error if the
+     * file cannot be written.
+     *
+     * Args:
+     *   filename: Output file path.
+     *
+     * Returns:
+     *   Number of operations written.
+     */
+    size_t writeFile(const std::string& filename) const;
+
+    /**
+     * Gets the config with defaults resolved.
+     *
+     * Returns:
+     *   Generator config.
+     */
+    const GeneratorConfig& getConfig() const { return config; }
+
+private:
+    GeneratorConfig config;
+
+    /**
+     * Calls emit(job, machine, duration) for every operation in file order.
+     */
+    template <typename Emit>
+    void forEachOperation(Emit&& emit) const;
+};
+
+#endif // INSTANCE_GENERATOR_HPP
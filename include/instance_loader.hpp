@@ -0,0 +1,91 @@
+#ifndef INSTANCE_LOADER_HPP
+#define INSTANCE_LOADER_HPP
+
+#include "fast_parser.hpp"
+#include "models.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * One instance file read by InstanceLoader, with what it cost.
+ */
+struct InstanceFile {
+    std::string path;
+    std::shared_ptr<ProblemInstance> problem; // null if the file could not be read
+    ParseReport report;                       // skipped lines of a .jssp file
+    uintmax_t bytes = 0;
+    double seconds = 0.0; // parse time on its worker
+    std::string error;    // why problem is null
+
+    /**
+     * Checks whether the file was loaded.
+     *
+     * Returns:
+     *   True if problem holds the instance.
+     */
+    bool ok() const { return problem != nullptr; }
+};
+
+/**
+ * Bulk loader for directories of instance files.
+ *
+ * Files are parsed in parallel on a ThreadPool, largest first so that one
+ * big file does not finish last on an otherwise idle pool. Text files go
+ * through FastParser and .jsspb files through BinaryInstance with
+ * verification. Nothing is printed; a file that fails is returned with its
+ * error instead of stopping the others.
+ */
+class InstanceLoader {
+public:
+    /**
+     * Finds the .jssp and .jsspb files below a directory, recursively.
+     * Throws std::runtime_error if the path is not a directory.
+     *
+     * Args:
+     *   directory: Directory to search.
+     *
+     * Returns:
+     *   File paths in sorted order.
+     */
+    static std::vector<std::string> discover(const std::string& directory);
+
+    /**
+     * Parses files in parallel.
+     *
+     * Args:
+     *   paths: Files to read.
+     *   threads: Worker count; 0 uses all hardware threads.
+     *
+     * Returns:
+     *   One entry per path, in the order given.
+     */
+    static std::vector<InstanceFile> loadFiles(const std::vector<std::string>& paths, int threads = 0);
+
+    /**
+     * Discovers and parses every instance below a directory.
+     *
+     * Args:
+     *   directory: Directory to search.
+     *   threads: Worker count; 0 uses all hardware threads.
+     *
+     * Returns:
+     *   One entry per file, in sorted path order.
+     */
+    static std::vector<InstanceFile> loadDirectory(const std::string& directory, int threads = 0);
+
+    /**
+     * Parses a single file on the calling thread. Errors are stored in the
+     * result rather than thrown.
+     *
+     * Args:
+     *   path: File to read.
+     *
+     * Returns:
+     *   Loaded file and its statistics.
+     */
+    static InstanceFile loadFile(const std::string& path);
+};
+
+#endif // INSTANCE_LOADER_HPP
@@ -0,0 +1,259 @@
+#ifndef INSTANCE_PACK_HPP
+#define INSTANCE_PACK_HPP
+
+#include "flat_instance.hpp"
+#include "mapped_file.hpp"
+#include "models.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * Index record of one packed instance.
+ */
+struct PackEntry {
+    std::string name;
+    uint64_t offset = 0; // image position in the pack
+    uint64_t size = 0;   // image size in bytes
+    int numJobs = 0;
+    int numMachines = 0;
+    int numOperations = 0;
+};
+
+/**
+ * Writes a pack one instance at a time.
+ */
+class InstancePackWriter {
+public:
+    /**
+     * Constructor for InstancePackWriter. Throws std::runtime_error if the
+     * file cannot be created.
+     *
+     * Args:
+     *   filename: Pack file to write.
+     */
+    explicit InstancePackWriter(const std::string& filename);
+
+    /**
+     * Destructor. A pack that was not finished is left without a header.
+     */
+    ~InstancePackWriter();
+
+    InstancePackWriter(const InstancePackWriter&) = delete;
+    InstancePackWriter& operator=(const InstancePackWriter&) = delete;
+
+    /**
+     * Appends an instance. Throws std::runtime_error if the pack is
+     * finished or the write fails.
+     *
+     * Args:
+     *   name: Entry name, normally the source file's relative path.
+     *   instance: Instance to append.
+     */
+    void add(const std::string& name, const FlatInstance& instance);
+
+    /**
+     * Appends a problem instance, in the operation order used by
+     * FlatInstance::fromProblem.
+     *
+     * Args:
+     *   name: Entry name.
+     *   problem: Instance to append.
+     */
+    void add(const std::string& name, const ProblemInstance& problem);
+
+    /**
+     * Writes the index and the header and closes the file. Throws
+     * std::runtime_error if the write fails.
+     */
+    void finish();
+
+    /**
+     * Gets the number of instances added so far.
+     *
+     * Returns:
+     *   Entry count.
+     */
+    size_t size() const { return entries.size(); }
+
+private:
+    std::string filename;
+    std::ofstream file;
+    std::vector<PackEntry> entries;
+    uint64_t position;
+    bool finished;
+};
+
+/**
+ * .jsspk pack files hold many instances in one file, so batches of small
+ * instances cost one open() instead of thousands.
+ *
+ * Layout (little-endian):
+ *
+ *   header     64 bytes: "JSPK", version, byte-order mark, header size,
+ *              entry count, index offset and size, file size, FNV-1a
+ *              checksum of the index
+ *   entries    one .jsspb image per instance, each on a 64-byte boundary
+ *   index      per entry: offset, size, name offset and length, and the
+ *              job, machine and operation counts; then the names
+ *
+ * The index comes last so a pack is written in one pass. The header is
+ * filled in when the pack is finished; until then the file has no magic
+ * and is not recognized as a pack.
+ *
+ * This class maps the whole pack for random access. Every entry is a .jsspb
+ * image, so its instances read the mapping in place; they keep the mapping
+ * alive and may outlive the pack object.
+ */
+class InstancePack {
+public:
+    static constexpr uint32_t VERSION = 1;
+
+    /**
+     * Constructor for InstancePack. Maps the pack and reads its index.
+     * Throws std::runtime_error if the file cannot be mapped or is not a
+     * valid pack.
+     *
+     * Args:
+     *   filename: Pack file to map.
+     */
+    explicit InstancePack(const std::string& filename);
+
+    /**
+     * Gets the number of instances.
+     *
+     * Returns:
+     *   Entry count.
+     */
+    size_t size() const { return entries.size(); }
+
+    /**
+     * Gets the index record of an instance.
+     *
+     * Args:
+     *   index: Entry index.
+     *
+     * Returns:
+     *   Index record.
+     */
+    const PackEntry& entry(size_t index) const { return entries.at(index); }
+
+    /**
+     * Gets all index records.
+     *
+     * Returns:
+     *   Records in pack order.
+     */
+    const std::vector<PackEntry>& getEntries() const { return entries; }
+
+    /**
+     * Finds an instance by name.
+     *
+     * Args:
+     *   name: Entry name.
+     *
+     * Returns:
+     *   Index of the first entry with that name, or -1.
+     */
+    int find(const std::string& name) const;
+
+    /**
+     * Returns an instance as a flat view of the mapping. Throws
+     * std::runtime_error if the image is not valid.
+     *
+     * Args:
+     *   index: Entry index.
+     *   verify: Also check the checksum and that every index is in range.
+     *     Only skip this for images already verified, e.g. by JSSPPack --list.
+     *
+     * Returns:
+     *   Flat instance backed by the pack.
+     */
+    FlatInstance flat(size_t index, bool verify = true) const;
+
+    /**
+     * Builds an unscheduled problem instance from a packed instance. The
+     * image is always verified; throws std::runtime_error if it is not valid.
+     *
+     * Args:
+     *   index: Entry index.
+     *
+     * Returns:
+     *   Problem instance.
+     */
+    std::shared_ptr<ProblemInstance> problem(size_t index) const;
+
+    /**
+     * Checks whether a file starts with the pack magic.
+     *
+     * Args:
+     *   filename: Path to file.
+     *
+     * Returns:
+     *   True for .jsspk files.
+     */
+    static bool isPack(const std::string& filename);
+
+private:
+    std::string filename;
+    std::shared_ptr<const MappedFile> file;
+    std::vector<PackEntry> entries;
+};
+
+/**
+ * Reads a pack front to back without mapping it, holding one instance in
+ * memory at a time. Suited to streaming a large pack through a solver.
+ */
+class InstancePackReader {
+public:
+    /**
+     * Constructor for InstancePackReader. Reads the index. Throws
+     * std::runtime_error if the file cannot be read or is not a valid pack.
+     *
+     * Args:
+     *   filename: Pack file to read.
+     */
+    explicit InstancePackReader(const std::string& filename);
+
+    /**
+     * Reads the next instance. The instance owns its bytes and stays valid
+     * after later calls. Throws std::runtime_error if the read fails or the
+     * image is not valid.
+     *
+     * Args:
+     *   instance: Receives the instance.
+     *   verify: Also check the checksum and that every index is in range.
+     *     Only skip this for images already verified, e.g. by JSSPPack --list.
+     *
+     * Returns:
+     *   False once every instance has been read.
+     */
+    bool next(FlatInstance& instance, bool verify = true);
+
+    /**
+     * Gets the index of the instance the next call to next() reads.
+     *
+     * Returns:
+     *   Entry index.
+     */
+    size_t position() const { return current; }
+
+    /**
+     * Gets all index records.
+     *
+     * Returns:
+     *   Records in pack order.
+     */
+    const std::vector<PackEntry>& getEntries() const { return entries; }
+
+private:
+    std::string filename;
+    std::ifstream file;
+    std::vector<PackEntry> entries;
+    size_t current;
+};
+
+#endif // INSTANCE_PACK_HPP
@@ -0,0 +1,198 @@
+#ifndef ISLAND_MODEL_HPP
+#define ISLAND_MODEL_HPP
+
+#include "flat_instance.hpp"
+#include "lns_engine.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/**
+ * One elite schedule read from the migration ring.
+ */
+struct Migrant {
+    int sender;
+    int makespan;
+    std::vector<int> sequence; // machine sequences concatenated in machine order
+};
+
+/**
+ * Fixed-size ring of elite schedules in POSIX shared memory.
+ *
+ * The segment is created with shm_open, mapped, and unlinked right away, so
+ * it is reachable only through the mapping: processes forked after
+ * construction share it, and it disappears when the last one exits. Any
+ * process may publish; a writer draws an atomic ticket and claims its slot
+ * by a compare-and-swap on the slot's sequence counter, so two writers never
+ * fill a slot at once, readers never block writers, and readers skip slots
+ * that were overwritten while they copied them.
+ */
+class MigrationRing {
+public:
+    /**
+     * Constructor for MigrationRing. Throws std::runtime_error if the shared
+     * segment cannot be created.
+     *
+     * Args:
+     *   slots: Number of schedules kept; older ones are overwritten.
+     *   sequenceLength: Operations per schedule.
+     */
+    MigrationRing(int slots, int sequenceLength);
+    ~MigrationRing();
+
+    MigrationRing(const MigrationRing&) = delete;
+    MigrationRing& operator=(const MigrationRing&) = delete;
+
+    /**
+     * Publishes a schedule into the next slot. The schedule is dropped if
+     * the ring wrapped and the slot is still being written, or was already
+     * taken by a later ticket.
+     *
+     * Args:
+     *   sender: Publishing island.
+     *   makespan: Makespan of the schedule.
+     *   sequence: Concatenated machine sequences of sequenceLength operations.
+     *
+     * Returns:
+     *   True if the schedule was written.
+     */
+    bool publish(int sender, int makespan, const std::vector<int>& sequence);
+
+    /**
+     * Reads the schedules published since the cursor by other senders.
+     * Schedules that were overwritten before they could be read are lost.
+     *
+     * Args:
+     *   reader: Reading island; its own schedules are skipped.
+     *   cursor: Ticket of the next unread slot; updated.
+     *
+     * Returns:
+     *   Schedules read, oldest first.
+     */
+    std::vector<Migrant> collect(int reader, uint64_t& cursor) const;
+
+    /**
+     * Gets the number of schedules published so far.
+     *
+     * Returns:
+     *   Publish count.
+     */
+    uint64_t getPublished() const;
+
+    /**
+     * Gets the number of slots.
+     *
+     * Returns:
+     *   Ring capacity.
+     */
+    int getSlots() const { return slots; }
+
+private:
+    int slots;
+    int sequenceLength;
+    size_t slotBytes;
+    size_t bytes;
+    unsigned char* base;
+
+    unsigned char* slot(uint64_t ticket) const;
+};
+
+/**
+ * Parameters of the island model.
+ */
+struct IslandConfig {
+    int islands = 4;            // worker processes
+    int iterations = 1000;      // LNS iterations per island
+    int migrationInterval = 50; // iterations between migrations
+    int ringSlots = 0;          // 0 = two per island
+    long memoryLimitMB = 0;     // address space limit per worker; 0 = none
+    double stallTimeout = 60;   // seconds without an iteration before a worker is killed; 0 = never
+    LNSConfig lns;              // engine parameters; threads is per island
+    std::function<void(int)> workerHook; // run in each worker before it searches; for tests
+};
+
+/**
+ * Outcome of an island model run.
+ */
+struct IslandResult {
+    MachineSequences sequences;
+    int makespan = -1;
+    int completedIslands = 0;
+    int failedIslands = 0;     // crashed, killed, or out of memory
+    int stalledIslands = 0;    // killed by the stall watchdog; also failed
+    long migrationsAccepted = 0;
+    uint64_t migrationsPublished = 0;
+};
+
+/**
+ * Island-model LNS over several worker processes on one machine.
+ *
+ * Every island is a forked process running its own LNSEngine with its own
+ * seed on the same instance. Every migrationInterval iterations an island
+ * publishes its best schedule to a shared MigrationRing if it improved, and
+ * moves its search to the best schedule published by the other islands if
+ * that one is better than its own. Islands report their final schedule
+ * through a second shared segment, and the parent re-times every report
+ * before trusting it. The final schedules and the last schedules in the
+ * ring can be collected into an ElitePool for path relinking.
+ *
+ * Processes give each island its own memory limit and contain faults: an
+ * island that crashes, runs out of memory or reports a schedule that does
+ * not load is counted and ignored. Workers are forked from a process that
+ * may run other threads, so a worker can inherit a held lock and block; the
+ * parent polls its workers and kills any that runs no iteration for
+ * stallTimeout seconds.
+ */
+class IslandModel {
+public:
+    /**
+     * Constructor for IslandModel. Throws std::invalid_argument on an
+     * invalid config.
+     *
+     * Args:
+     *   instance: Flat instance of the problem. Must outlive the model.
+     *   config: Island model parameters.
+     */
+    IslandModel(const FlatInstance& instance, const IslandConfig& config = IslandConfig());
+
+    /**
+     * Runs all islands from a schedule and waits for them. Throws
+     * std::runtime_error if no island completes.
+     *
+     * Args:
+     *   initial: Flat operation indices per machine; must be acyclic.
+     *   elites: If set, receives the final schedule of every completed
+     *     island and the schedules left in the migration ring.
+     *
+     * Returns:
+     *   Best schedule over all islands.
+     */
+    IslandResult run(const MachineSequences& initial, ElitePool* elites = nullptr);
+
+    /**
+     * Gets the island model parameters.
+     *
+     * Returns:
+     *   Current configuration.
+     */
+    const IslandConfig& getConfig() const { return config; }
+
+private:
+    const FlatInstance& instance;
+    IslandConfig config;
+
+    /**
+     * Search loop of one worker process.
+     *
+     * Args:
+     *   island: Island index.
+     *   initial: Start schedule.
+     *   ring: Shared migration ring.
+     *   report: Shared report slot of this island.
+     */
+    void runIsland(int island, const MachineSequences& initial, MigrationRing& ring,
+                   unsigned char* report) const;
+};
+
+#endif // ISLAND_MODEL_HPP
@@ -0,0 +1,276 @@
+#ifndef LNS_ENGINE_HPP
+#define LNS_ENGINE_HPP
+
+#include "flat_instance.hpp"
+#include "sequence_schedule.hpp"
+#include "thread_pool.hpp"
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+class ElitePool;
+struct SearchCheckpoint;
+
+/**
+ * Enumeration for the ways the LNS engine picks operations to free.
+ */
+enum class NeighborhoodType {
+    TimeWindow, // blocks around one point in time on several machines
+    Machines,   // a random block on each of several machines
+    Jobs        // blocks around the operations of one job
+};
+
+/**
+ * Tuning knobs of the LNS engine. Together they bound the cost of one
+ * iteration: at most machinesPerSubproblem blocks of blockSize operations
+ * per subproblem, and nodeLimit branch-and-bound nodes per subproblem.
+ */
+struct LNSConfig {
+    int blockSize = 6;             // operations freed per machine
+    int machinesPerSubproblem = 2; // machines freed per subproblem
+    int nodeLimit = 2000;          // branch-and-bound nodes per subproblem
+    int threads = 0;               // parallel subproblems; 0 = hardware threads
+    int tabuTenure = 16;           // fruitless blocks remembered as tabu
+    uint64_t seed = 1;
+};
+
+/**
+ * Counters describing the work done by the LNS engine.
+ */
+struct LNSStatistics {
+    long iterations = 0;
+    long improvements = 0;
+    long subproblems = 0;
+    long provenOptimal = 0; // subproblems searched to completion
+    long nodes = 0;
+};
+
+/**
+ * Large neighbourhood search over per-machine sequences.
+ *
+ * Each iteration frees a contiguous block of operations on a few machines
+ * and re-sequences those blocks exactly with a depth-first branch and bound,
+ * while every other machine arc stays fixed. The bound is the longest path
+ * of the disjunctive graph with the unplaced operations of each block
+ * relaxed to run in parallel, tightened by their total processing time.
+ * Subproblems on disjoint machines are solved in parallel against the same
+ * schedule and then merged one by one, keeping each merge only if the
+ * schedule stays acyclic and does not get worse. Every schedule the search
+ * moves to can be offered to an ElitePool for path relinking afterwards.
+ */
+class LNSEngine {
+public:
+    /**
+     * Constructor for LNSEngine.
+     *
+     * Args:
+     *   instance: Flat instance of the problem. Must outlive the engine.
+     *   config: Engine parameters.
+     */
+    explicit LNSEngine(const FlatInstance& instance, const LNSConfig& config = LNSConfig());
+
+    /**
+     * Sets a pool that the start schedule of reset() and every schedule the
+     * search moves to are offered to.
+     *
+     * Args:
+     *   pool: Pool to fill, or nullptr. Must outlive the engine or be unset.
+     */
+    void setElitePool(ElitePool* pool) { elites = pool; }
+
+    /**
+     * Starts a new search from a schedule. Throws std::invalid_argument if
+     * the schedule is cyclic.
+     *
+     * Args:
+     *   initial: Flat operation indices per machine.
+     */
+    void reset(const MachineSequences& initial);
+
+    /**
+     * Moves the search to another schedule without restarting it: the
+     * generator state and counters carry on, the tabu list is cleared and
+     * the schedule becomes the best if it is better. Throws
+     * std::invalid_argument if the schedule is cyclic.
+     *
+     * Args:
+     *   sequences: Flat operation indices per machine.
+     */
+    void adopt(const MachineSequences& sequences);
+
+    /**
+     * Runs LNS iterations from the current schedule.
+     *
+     * Args:
+     *   iterations: Number of iterations.
+     *
+     * Returns:
+     *   Best makespan found so far.
+     */
+    int runIterations(int iterations);
+
+    /**
+     * Gets the best makespan found.
+     *
+     * Returns:
+     *   Best makespan.
+     */
+    int getBestMakespan() const { return bestMakespan; }
+
+    /**
+     * Gets the best schedule found.
+     *
+     * Returns:
+     *   Flat operation indices per machine.
+     */
+    const MachineSequences& getBestSequences() const { return best; }
+
+    /**
+     * Gets the work counters.
+     *
+     * Returns:
+     *   Statistics since the last reset.
+     */
+    const LNSStatistics& getStatistics() const { return statistics; }
+
+    /**
+     * Gets the engine parameters.
+     *
+     * Returns:
+     *   Current configuration.
+     */
+    const LNSConfig& getConfig() const { return config; }
+
+    /**
+     * Copies the full search state into a checkpoint: schedules, tabu list,
+     * generator state, counters and the members of the elite pool, if one is
+     * set. The fingerprints are left to the caller.
+     *
+     * Args:
+     *   state: Receives the search state.
+     */
+    void saveState(SearchCheckpoint& state) const;
+
+    /**
+     * Continues from a checkpoint, so that the following iterations are the
+     * same as if the search had never stopped. The elite pool, if one is
+     * set, is replaced by the saved elites. Throws std::invalid_argument if
+     * the checkpoint does not fit the instance.
+     *
+     * Args:
+     *   state: Saved search state.
+     */
+    void restoreState(const SearchCheckpoint& state);
+
+    /**
+     * Gets the name of a neighbourhood type.
+     *
+     * Args:
+     *   type: Neighbourhood type.
+     *
+     * Returns:
+     *   Neighbourhood name string.
+     */
+    static std::string getNeighborhoodName(NeighborhoodType type);
+
+private:
+    /**
+     * Contiguous positions on one machine whose order is re-optimized.
+     */
+    struct Block {
+        int machine;
+        int start;
+        int length;
+    };
+
+    /**
+     * Outcome of one subproblem.
+     */
+    struct SubproblemResult {
+        std::vector<Block> blocks;
+        std::vector<std::vector<int>> orders; // new order of each block
+        int makespan;                         // -1 if no improvement was found
+        long nodes;
+        bool complete;
+    };
+
+    const FlatInstance& instance;
+    LNSConfig config;
+    LNSStatistics statistics;
+    std::unique_ptr<ThreadPool> workers;
+    std::mt19937_64 rng;
+    std::deque<uint64_t> tabu; // recently tried blocks that did not help
+    int nextNeighborhood;
+
+    SequenceSchedule schedule; // timing of current
+    MachineSequences current;
+    int currentMakespan;
+    MachineSequences best;
+    int bestMakespan;
+    ElitePool* elites; // offered every schedule moved to; may be null
+
+    /**
+     * Picks non-overlapping blocks for one subproblem.
+     *
+     * Args:
+     *   type: Neighbourhood type.
+     *   usedMachines: Machines already taken this iteration; updated.
+     *
+     * Returns:
+     *   Chosen blocks, empty if none could be placed.
+     */
+    std::vector<Block> chooseBlocks(NeighborhoodType type, std::vector<char>& usedMachines);
+
+    /**
+     * Builds a block of up to blockSize positions centred on a position.
+     *
+     * Args:
+     *   machine: Machine index.
+     *   center: Position to cover.
+     *
+     * Returns:
+     *   Block on the machine.
+     */
+    Block blockAround(int machine, int center) const;
+
+    /**
+     * Checks whether a block was recently tried without success.
+     *
+     * Args:
+     *   block: Block to check.
+     *
+     * Returns:
+     *   True if the block is tabu.
+     */
+    bool isTabu(const Block& block) const;
+
+    /**
+     * Re-sequences the blocks of one subproblem exactly, within the node limit.
+     *
+     * Args:
+     *   base: Schedule to improve.
+     *   baseMakespan: Its makespan.
+     *   blocks: Blocks to free.
+     *
+     * Returns:
+     *   Best block orders found.
+     */
+    SubproblemResult solveSubproblem(const MachineSequences& base, int baseMakespan,
+                                     const std::vector<Block>& blocks) const;
+
+    /**
+     * Merges improved subproblems into the current schedule.
+     *
+     * Args:
+     *   results: Subproblem outcomes of one iteration.
+     *
+     * Returns:
+     *   True if the current schedule changed.
+     */
+    bool mergeResults(std::vector<SubproblemResult>& results);
+};
+
+#endif // LNS_ENGINE_HPP
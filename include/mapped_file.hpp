@@ -0,0 +1,74 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+/**
+ * Read-only memory mapping of a whole file.
+ *
+ * The file is mapped privately and closed right away; the pages stay valid
+ * until the object is destroyed. An empty file maps to an empty view.
+ */
+class MappedFile {
+public:
+    /**
+     * Expected access pattern, passed to the kernel as a read-ahead hint.
+     */
+    enum class Access {
+        SEQUENTIAL,
+        RANDOM
+    };
+
+    /**
+     * Constructor for MappedFile. Throws std::runtime_error if the file
+     * cannot be opened or mapped.
+     *
+     * Args:
+     *   path: File to map.
+     *   access: Expected access pattern.
+     */
+    explicit MappedFile(const std::string& path, Access access = Access::SEQUENTIAL);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * Gets the mapped bytes.
+     *
+     * Returns:
+     *   Pointer to the first byte, or nullptr for an empty file.
+     */
+    const char* data() const { return bytes; }
+
+    /**
+     * Gets the file size.
+     *
+     * Returns:
+     *   Size in bytes.
+     */
+    size_t size() const { return length; }
+
+    /**
+     * Gets the mapped bytes as a string view.
+     *
+     * Returns:
+     *   View of the whole file.
+     */
+    std::string_view view() const { return std::string_view(bytes, length); }
+
+private:
+    const char* bytes;
+    size_t length;
+
+    /**
+     * Unmaps the file, if mapped.
+     */
+    void release();
+};
+
+#endif // MAPPED_FILE_HPP
@@ -0,0 +1,161 @@
+#ifndef PARAMETER_TUNER_HPP
+#define PARAMETER_TUNER_HPP
+
+#include "flat_instance.hpp"
+#include "solver_config.hpp"
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * Integer range searched for one config key.
+ */
+struct ParameterRange {
+    std::string key;        // SolverConfig key, e.g. "block_size"
+    long minValue;
+    long maxValue;
+    bool logScale = false;  // sample uniformly in log space
+};
+
+/**
+ * Settings of the racing procedure.
+ */
+struct RaceSettings {
+    int candidates = 24;   // configurations entered in each race
+    int races = 3;         // races; later ones sample around earlier survivors
+    int firstTest = 5;     // blocks evaluated before the first elimination test
+    int maxBlocks = 40;    // (instance, seed) blocks per race at most
+    long budget = 0;       // total engine runs; 0 = only maxBlocks limits a race
+    double alpha = 0.05;   // significance level of the Friedman tests
+    int threads = 0;       // parallel engine runs; 0 = hardware threads
+    uint64_t seed = 1;
+    bool verbose = false;  // print progress to std::cout
+};
+
+/**
+ * Outcome of a race.
+ */
+struct RaceResult {
+    SolverConfig best;
+    std::vector<SolverConfig> survivors; // best first
+    int blocks = 0;                      // blocks evaluated
+    long evaluations = 0;                // engine runs
+};
+
+/**
+ * Offline tuner for the engine hyperparameters in SolverConfig.
+ *
+ * Configurations are raced F-race style: all survivors are run on one
+ * training block at a time, where a block is a training instance paired
+ * with a seed shared by every configuration. After firstTest blocks, a
+ * Friedman test on the per-block ranks checks whether the survivors
+ * differ; if they do, every configuration whose rank sum is significantly
+ * worse than the best one is dropped. Races are iterated as in irace: the
+ * next race keeps the survivors and samples new candidates around them
+ * with a shrinking spread. Engine runs are spread over a thread pool, each
+ * run single-threaded.
+ */
+class ParameterTuner {
+public:
+    /**
+     * Constructor for ParameterTuner. Every training instance is scheduled
+     * once with SPT to get the start of the engine runs.
+     *
+     * Args:
+     *   training: Training instances; they are left scheduled with SPT.
+     *   settings: Race settings.
+     */
+    ParameterTuner(const std::vector<std::shared_ptr<ProblemInstance>>& training,
+                   const RaceSettings& settings = RaceSettings());
+
+    /**
+     * Races fixed candidates against each other.
+     *
+     * Args:
+     *   candidates: Configurations to race.
+     *   firstBlock: Index of the first block; blocks map to instances
+     *               round-robin and each has its own seed.
+     *   budget: Engine runs available; 0 = no limit.
+     *
+     * Returns:
+     *   Surviving configurations and the work done.
+     */
+    RaceResult race(const std::vector<SolverConfig>& candidates, int firstBlock = 0, long budget = 0);
+
+    /**
+     * Runs iterated races over the given ranges, starting from a base config.
+     *
+     * Args:
+     *   base: Values of keys not being tuned, and the first candidate.
+     *   ranges: Ranges to search.
+     *
+     * Returns:
+     *   Result of the last race, with work summed over all races.
+     */
+    RaceResult tune(const SolverConfig& base, const std::vector<ParameterRange>& ranges);
+
+    /**
+     * Runs one engine on one block.
+     *
+     * Args:
+     *   config: Configuration to run.
+     *   block: Block index.
+     *
+     * Returns:
+     *   Best makespan found.
+     */
+    int evaluate(const SolverConfig& config, int block) const;
+
+    /**
+     * Applies the Friedman test and its post-hoc comparison to a cost matrix.
+     *
+     * Args:
+     *   costs: costs[block][candidate], lower is better.
+     *   alpha: Significance level.
+     *
+     * Returns:
+     *   For each candidate, whether it survives.
+     */
+    static std::vector<bool> friedmanSurvivors(const std::vector<std::vector<double>>& costs, double alpha);
+
+    /**
+     * Gets the ranges searched by default.
+     *
+     * Returns:
+     *   Ranges for the LNS parameters.
+     */
+    static std::vector<ParameterRange> getDefaultRanges();
+
+    /**
+     * Gets the number of training instances.
+     *
+     * Returns:
+     *   Instance count.
+     */
+    int getInstanceCount() const { return static_cast<int>(instances.size()); }
+
+private:
+    RaceSettings settings;
+    std::vector<FlatInstance> instances;
+    std::vector<MachineSequences> starts; // SPT schedule of each instance
+
+    /**
+     * Samples one candidate, uniformly or around a parent.
+     *
+     * Args:
+     *   parent: Config to start from.
+     *   ranges: Ranges to sample.
+     *   spread: 0 for uniform sampling, else the standard deviation as a
+     *           fraction of each range.
+     *   rng: Random engine state.
+     *
+     * Returns:
+     *   Sampled config.
+     */
+    static SolverConfig sample(const SolverConfig& parent, const std::vector<ParameterRange>& ranges,
+                               double spread, std::mt19937_64& rng);
+};
+
+#endif // PARAMETER_TUNER_HPP
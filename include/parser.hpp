@@ -19,6 +19,10 @@ public:
      * First line: num_jobs num_machines
      * Following lines: job_id machine_id processing_time (one line per operation)
      *
+     * The file is read with FastParser; invalid operation lines are skipped
+     * and summarized in a single warning. Binary .jsspb files are recognized
+     * by their magic and loaded with BinaryInstance.
+     *
      * Args:
      *   filename: Path to input file.
      *
@@ -56,7 +60,8 @@ public:
     static std::shared_ptr<ProblemInstance> generateSimpleProblem();
 
     /**
-     * Loads a solution from a file. Supports TEXT, JSON, and XML formats.
+     * Loads a solution from a file. Supports TEXT, JSON, XML, and binary
+     * formats; binary files are recognized by their magic.
      *
      * Args:
      *   filename: Path to solution file.
@@ -78,7 +83,10 @@ public:
     static std::shared_ptr<ScheduleResult> loadTextSolution(const std::string& filename);
 
     /**
-     * Loads a solution from JSON format.
+     * Loads a solution from JSON format. The file is parsed with a SAX
+     * handler that fills the model directly, in any key order, instead of
+     * building a json document first. Throws std::runtime_error on
+     * malformed JSON or missing fields.
      *
      * Args:
      *   filename: Path to JSON solution file.
@@ -89,7 +97,10 @@ public:
     static std::shared_ptr<ScheduleResult> loadJSONSolution(const std::string& filename);
 
     /**
-     * Loads a solution from XML format.
+     * Loads a solution from XML format. The mapped file is read once by a
+     * pull parser, and machine entries are matched to operations through
+     * an index, so loading is linear in the file size. Throws
+     * std::runtime_error on unbalanced tags.
      *
      * Args:
      *   filename: Path to XML solution file.
@@ -99,30 +110,17 @@ public:
      */
     static std::shared_ptr<ScheduleResult> loadXMLSolution(const std::string& filename);
 
-private:
     /**
-     * Helper function to extract integer from XML tag.
+     * Loads a solution from the compact binary format (see BinarySolution).
+     * Throws std::runtime_error if the file is corrupt.
      *
      * Args:
-     *   content: XML content string.
-     *   tag: XML tag name.
+     *   filename: Path to binary solution file.
      *
      * Returns:
-     *   Extracted integer value.
-     */
-    static int extractIntFromXML(const std::string& content, const std::string& tag);
-
-    /**
-     * Helper function to extract double from XML tag.
-     *
-     * Args:
-     *   content: XML content string.
-     *   tag: XML tag name.
-     *
-     * Returns:
-     *   Extracted double value.
+     *   Loaded schedule result.
      */
-    static double extractDoubleFromXML(const std::string& content, const std::string& tag);
+    static std::shared_ptr<ScheduleResult> loadBinarySolution(const std::string& filename);
 };
 
 #endif // PARSER_HPP
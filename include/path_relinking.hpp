@@ -0,0 +1,102 @@
+#ifndef PATH_RELINKING_HPP
+#define PATH_RELINKING_HPP
+
+#include "elite_pool.hpp"
+#include "flat_instance.hpp"
+#include <cstdint>
+
+class EvaluationCache;
+
+/**
+ * Outcome of relinking one pair of schedules.
+ */
+struct RelinkResult {
+    MachineSequences sequences; // best intermediate schedule
+    int makespan;               // its makespan, or -1 if no step was possible
+    int steps;                  // swaps performed along the path
+};
+
+/**
+ * Path relinking between elite schedules.
+ *
+ * Starting from an initiating schedule, each step swaps one adjacent pair
+ * of operations that the guiding schedule orders the other way, so the
+ * distance to the guide drops by exactly one. Among the candidate swaps of a
+ * step (sampled up to a limit), the one with the lowest makespan is taken.
+ * Intermediates are timed with SequenceSchedule::swapAdjacent, so a step
+ * only re-times the operations downstream of the swap. With an
+ * EvaluationCache, each candidate is hashed incrementally from its parent
+ * and a schedule already timed on any path is not timed again.
+ */
+class PathRelinker {
+public:
+    /**
+     * Constructor for PathRelinker.
+     *
+     * Args:
+     *   instance: Flat instance of the problem. Must outlive the relinker.
+     */
+    explicit PathRelinker(const FlatInstance& instance);
+
+    /**
+     * Sets how many candidate swaps are timed per step.
+     *
+     * Args:
+     *   limit: Candidates per step; 0 times all of them.
+     */
+    void setCandidateLimit(int limit) { candidateLimit = limit; }
+
+    /**
+     * Sets the maximum number of steps per path.
+     *
+     * Args:
+     *   steps: Step limit; 0 walks until the guiding schedule is reached.
+     */
+    void setMaxSteps(int steps) { maxSteps = steps; }
+
+    /**
+     * Sets a cache of schedule makespans shared by all paths.
+     *
+     * Args:
+     *   evaluations: Cache to read and fill, or nullptr. Must outlive the
+     *     relinker or be unset.
+     */
+    void setCache(EvaluationCache* evaluations) { cache = evaluations; }
+
+    /**
+     * Walks from initiating towards guiding and keeps the best intermediate.
+     * The guiding schedule itself is not reported.
+     *
+     * Args:
+     *   initiating: Start schedule; must be acyclic.
+     *   guiding: Target schedule over the same operations.
+     *   seed: Seed for candidate sampling.
+     *
+     * Returns:
+     *   Best intermediate schedule found.
+     */
+    RelinkResult relink(const MachineSequences& initiating, const MachineSequences& guiding, uint64_t seed) const;
+
+    /**
+     * Relinks every pair of pool members in both directions on a thread
+     * pool and offers each result back to the pool. Meant to run after an
+     * improvement engine has filled the pool.
+     *
+     * Args:
+     *   pool: Elite pool to read from and insert into.
+     *   threads: Worker count; 0 uses all hardware threads.
+     *   seed: Base seed; each path uses a derived seed.
+     *
+     * Returns:
+     *   Best makespan in the pool after the phase, or -1 if it is empty.
+     */
+    int runPhase(ElitePool& pool, int threads = 0, uint64_t seed = 0) const;
+
+private:
+    const FlatInstance& instance;
+    int candidateLimit;
+    int maxSteps;
+    EvaluationCache* cache;
+};
+
+#endif // PATH_RELINKING_HPP
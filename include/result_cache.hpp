@@ -0,0 +1,189 @@
+#ifndef RESULT_CACHE_HPP
+#define RESULT_CACHE_HPP
+
+#include "models.hpp"
+#include "solver.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+/**
+ * Counters of a ResultCache since it was opened.
+ */
+struct CacheStatistics {
+    long hits = 0;
+    long misses = 0;
+    long rejected = 0;  // entries that failed verification, also counted as misses
+    long stores = 0;
+    long evictions = 0;
+};
+
+/**
+ * On-disk cache of solved schedules, keyed by instance content and solver
+ * settings.
+ *
+ * Each entry is a BinarySolution file named <key>.jsol in the cache
+ * directory. The key hashes the jobs, machines and processing times of the
+ * instance, the algorithm and, for the search algorithms, the engine config;
+ * operation ids and object identity do not matter, so a re-parsed copy of an
+ * instance finds the entries of the original.
+ *
+ * A hit is verified before it is used: the entry must decode with a valid
+ * checksum, list the instance's operations with the same machines and
+ * processing times, and pass ScheduleValidator. An entry that fails is
+ * deleted and the lookup counts as a miss.
+ *
+ * The least recently used entries are deleted when a store exceeds the size
+ * or entry limit. Recency is the file modification time, refreshed on every
+ * hit, so the order carries over to the next process that opens the
+ * directory. Entries are written to a temporary file and renamed into place;
+ * the methods are thread-safe.
+ */
+class ResultCache {
+public:
+    static constexpr uint64_t DEFAULT_MAX_BYTES = 256ull << 20;
+
+    /**
+     * Opens a cache directory, creating it if needed, and indexes the
+     * entries already in it. Throws std::runtime_error if the directory
+     * cannot be created.
+     *
+     * Args:
+     *   directory: Cache directory.
+     *   maxBytes: Size limit of all entries together.
+     *   maxEntries: Entry limit; 0 for none.
+     */
+    explicit ResultCache(const std::string& directory, uint64_t maxBytes = DEFAULT_MAX_BYTES, size_t maxEntries = 0);
+
+    ResultCache(const ResultCache&) = delete;
+    ResultCache& operator=(const ResultCache&) = delete;
+
+    /**
+     * Computes the cache key of a solve.
+     *
+     * Args:
+     *   problem: Problem instance.
+     *   algorithm: Scheduling algorithm.
+     *   config: Engine parameters; only part of the key for LNS and ISLANDS.
+     *
+     * Returns:
+     *   Key such as "spt-" followed by 32 hex digits.
+     */
+    static std::string makeKey(const ProblemInstance& problem, SchedulingAlgorithm algorithm,
+                               const SolverConfig& config);
+
+    /**
+     * Looks up a key and, on a verified hit, schedules the problem's
+     * operations and machines as in the cached solution. On a miss the
+     * problem is left unchanged.
+     *
+     * Args:
+     *   key: Cache key from makeKey.
+     *   problem: Problem instance the key was computed from.
+     *
+     * Returns:
+     *   True on a hit.
+     */
+    bool lookup(const std::string& key, ProblemInstance& problem);
+
+    /**
+     * Stores a solved schedule, then evicts entries beyond the limits.
+     * Throws std::runtime_error if the entry cannot be written.
+     *
+     * Args:
+     *   key: Cache key from makeKey.
+     *   result: Schedule of the instance the key was computed from.
+     */
+    void store(const std::string& key, const ScheduleResult& result);
+
+    /**
+     * Checks whether an entry is indexed, without verifying it or counting
+     * a lookup.
+     *
+     * Args:
+     *   key: Cache key.
+     *
+     * Returns:
+     *   True if the entry is indexed.
+     */
+    bool contains(const std::string& key) const;
+
+    /**
+     * Deletes every entry. The counters are kept.
+     */
+    void clear();
+
+    /**
+     * Gets the number of entries.
+     *
+     * Returns:
+     *   Entry count.
+     */
+    size_t size() const;
+
+    /**
+     * Gets the size of all entries together.
+     *
+     * Returns:
+     *   Size in bytes.
+     */
+    uint64_t getBytes() const;
+
+    /**
+     * Gets the hit, miss, store and eviction counters.
+     *
+     * Returns:
+     *   Copy of the counters.
+     */
+    CacheStatistics getStatistics() const;
+
+    /**
+     * Gets the cache directory.
+     *
+     * Returns:
+     *   Directory path.
+     */
+    const std::string& getDirectory() const { return directory; }
+
+private:
+    struct Entry {
+        uint64_t bytes;
+        std::list<std::string>::iterator position; // in recency
+    };
+
+    std::string directory;
+    uint64_t maxBytes;
+    size_t maxEntries;
+    mutable std::mutex mutex;
+    std::list<std::string> recency; // keys, most recently used first
+    std::unordered_map<std::string, Entry> entries;
+    uint64_t totalBytes;
+    uint64_t tempCounter;
+    CacheStatistics stats;
+
+    /**
+     * Gets the file path of an entry.
+     */
+    std::string pathOf(const std::string& key) const;
+
+    /**
+     * Indexes an entry as the most recently used one. Call with the mutex held.
+     */
+    void touch(const std::string& key, uint64_t bytes);
+
+    /**
+     * Drops an entry from the index and deletes its file. Call with the mutex held.
+     */
+    void erase(const std::string& key);
+
+    /**
+     * Evicts least recently used entries until the limits hold. Call with
+     * the mutex held.
+     */
+    void evict();
+};
+
+#endif // RESULT_CACHE_HPP
@@ -0,0 +1,131 @@
+#ifndef SCHEDULE_VALIDATOR_HPP
+#define SCHEDULE_VALIDATOR_HPP
+
+#include "models.hpp"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * Kinds of schedule defects found by ScheduleValidator.
+ */
+enum class ViolationType {
+    DURATION_MISMATCH,    // end - start differs from the processing time
+    NEGATIVE_START,       // operation starts before time 0
+    PRECEDENCE,           // operation starts before its job predecessor ends
+    MACHINE_OVERLAP,      // operation starts before another one on its machine ends
+    UNKNOWN_OPERATION,    // machine entry names an operation no job has
+    WRONG_MACHINE,        // machine entry is on another machine than its operation
+    TIME_MISMATCH,        // machine entry times differ from the job operation's
+    DUPLICATE_OPERATION,  // operation appears more than once in the machine schedules
+    MISSING_FROM_MACHINE, // operation appears in no machine schedule
+    MAKESPAN_MISMATCH     // reported makespan differs from the latest end time
+};
+
+/**
+ * One schedule defect. Fields that do not apply to the type are -1.
+ */
+struct Violation {
+    ViolationType type;
+    int jobId = -1;
+    int operationId = -1;
+    int machineId = -1;
+    int otherJobId = -1;       // the conflicting operation, for PRECEDENCE and MACHINE_OVERLAP
+    int otherOperationId = -1;
+    long long expected = -1;   // required value, e.g. the earliest allowed start
+    long long actual = -1;     // value found in the schedule
+
+    /**
+     * Describes the violation in one line.
+     *
+     * Returns:
+     *   Human-readable description.
+     */
+    std::string describe() const;
+};
+
+/**
+ * What a validation found. Only the first
+ * ScheduleValidator::MAX_REPORTED_VIOLATIONS defects are described in
+ * violations, but all of them are counted.
+ */
+struct ValidationReport {
+    std::vector<Violation> violations;
+    std::vector<size_t> counts; // per ViolationType
+    size_t total = 0;           // violations found
+    size_t operations = 0;      // job operations checked
+    size_t machineEntries = 0;  // machine schedule entries checked
+    long long makespan = 0;     // latest end time of any operation
+
+    /**
+     * Checks whether the schedule is feasible.
+     *
+     * Returns:
+     *   True if no violation was found.
+     */
+    bool ok() const { return total == 0; }
+
+    /**
+     * Gets how many violations of one type were found.
+     *
+     * Args:
+     *   type: Violation type.
+     *
+     * Returns:
+     *   Violation count.
+     */
+    size_t count(ViolationType type) const;
+
+    /**
+     * Summarizes the counts per type in one line.
+     *
+     * Returns:
+     *   "feasible", or the counts of the types found.
+     */
+    std::string summary() const;
+};
+
+/**
+ * Independent feasibility check of a ScheduleResult.
+ *
+ * The job operations are the schedule: each must last its processing time,
+ * start no earlier than 0 and no earlier than its job predecessor ends. The
+ * machine schedules must list every job operation exactly once, on its own
+ * machine and with its own times, and no two operations of positive length
+ * may overlap on a machine. Machine entries are matched to job operations
+ * by (jobId, operationId), so results whose machine schedules hold copies,
+ * such as loaded text solutions, are checked the same way.
+ *
+ * Unique, dense operation ids are looked up through a direct table, and a
+ * machine sequence is sorted by start time only if it is not already, so a
+ * normal schedule is checked in linear time. Other ids fall back to a
+ * sorted table, and the check takes O(n log n).
+ */
+class ScheduleValidator {
+public:
+    static constexpr size_t MAX_REPORTED_VIOLATIONS = 1000;
+
+    /**
+     * Validates a schedule.
+     *
+     * Args:
+     *   result: Schedule to check.
+     *
+     * Returns:
+     *   Report of the defects found.
+     */
+    static ValidationReport validate(const ScheduleResult& result);
+
+    /**
+     * Gets the name of a violation type.
+     *
+     * Args:
+     *   type: Violation type.
+     *
+     * Returns:
+     *   Name such as "MACHINE_OVERLAP".
+     */
+    static std::string typeName(ViolationType type);
+};
+
+#endif // SCHEDULE_VALIDATOR_HPP
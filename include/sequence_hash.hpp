@@ -0,0 +1,206 @@
+#ifndef SEQUENCE_HASH_HPP
+#define SEQUENCE_HASH_HPP
+
+#include "flat_instance.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * Zobrist-style hashing of per-machine operation sequences.
+ *
+ * The hash of a schedule is the XOR of one key per (operation, position)
+ * pair, where position is the operation's index on its machine. Since each
+ * operation runs on exactly one machine, the machine is implied by the
+ * operation. Keys are derived with splitmix64 instead of being stored, so
+ * there is no table to size or share between threads.
+ */
+class SequenceHasher {
+public:
+    /**
+     * Gets the key of an operation at a machine position.
+     *
+     * Args:
+     *   op: Flat operation index.
+     *   position: Index of the operation on its machine.
+     *
+     * Returns:
+     *   64-bit key.
+     */
+    static uint64_t key(int op, int position) {
+        uint64_t z = (static_cast<uint64_t>(static_cast<uint32_t>(op)) << 32 |
+                      static_cast<uint32_t>(position)) + 0x9e3779b97f4a7c15ULL;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+    /**
+     * Hashes the sequence of a single machine.
+     *
+     * Args:
+     *   sequence: Flat operation indices in processing order.
+     *
+     * Returns:
+     *   Hash of the machine sequence.
+     */
+    static uint64_t hash(const std::vector<int>& sequence);
+
+    /**
+     * Hashes all machine sequences of a schedule.
+     *
+     * Args:
+     *   sequences: Flat operation indices per machine.
+     *
+     * Returns:
+     *   Schedule hash.
+     */
+    static uint64_t hash(const MachineSequences& sequences);
+
+    /**
+     * Hashes the machine sequences stored in Machine::scheduledOperations.
+     *
+     * Args:
+     *   instance: Flat instance of the problem.
+     *   scheduled: Problem instance whose machines hold scheduled operations.
+     *
+     * Returns:
+     *   Schedule hash.
+     */
+    static uint64_t hash(const FlatInstance& instance, const ProblemInstance& scheduled);
+
+    /**
+     * Computes the hash change of swapping two positions on one machine.
+     * XOR it into the current hash before or after applying the swap.
+     *
+     * Args:
+     *   sequence: Machine sequence before the swap.
+     *   i: First position.
+     *   j: Second position.
+     *
+     * Returns:
+     *   Hash delta.
+     */
+    static uint64_t swapDelta(const std::vector<int>& sequence, int i, int j);
+
+    /**
+     * Computes the hash change of moving the operation at position from to
+     * position to, shifting the operations in between. Costs O(|from - to|).
+     *
+     * Args:
+     *   sequence: Machine sequence before the move.
+     *   from: Current position of the moved operation.
+     *   to: Target position.
+     *
+     * Returns:
+     *   Hash delta.
+     */
+    static uint64_t moveDelta(const std::vector<int>& sequence, int from, int to);
+};
+
+/**
+ * Bounded, thread-safe cache from schedule hash to makespan.
+ *
+ * The table is direct-mapped with a fixed power-of-two capacity and always
+ * replaces on collision, so memory never grows. Entries are two relaxed
+ * atomics with the key stored XORed into the payload; a torn write by a
+ * concurrent store just reads as a miss. No locks are taken.
+ */
+class EvaluationCache {
+public:
+    /**
+     * Constructor for EvaluationCache.
+     *
+     * Args:
+     *   capacity: Number of entries, rounded up to a power of two.
+     */
+    explicit EvaluationCache(size_t capacity);
+
+    /**
+     * Looks up a schedule hash.
+     *
+     * Args:
+     *   hash: Schedule hash.
+     *   makespan: Set to the cached makespan on a hit.
+     *
+     * Returns:
+     *   True on a hit.
+     */
+    bool lookup(uint64_t hash, int& makespan) const;
+
+    /**
+     * Stores the makespan of a schedule hash, replacing whatever occupied
+     * the slot.
+     *
+     * Args:
+     *   hash: Schedule hash.
+     *   makespan: Non-negative makespan.
+     */
+    void store(uint64_t hash, int makespan);
+
+    /**
+     * Removes all entries. Not safe to call concurrently with lookups.
+     */
+    void clear();
+
+    /**
+     * Gets the number of entries.
+     *
+     * Returns:
+     *   Table capacity.
+     */
+    size_t getCapacity() const { return mask + 1; }
+
+    /**
+     * Gets the number of lookups since the last statistics reset.
+     *
+     * Returns:
+     *   Lookup count.
+     */
+    uint64_t getLookups() const { return lookups.load(std::memory_order_relaxed); }
+
+    /**
+     * Gets the number of lookup hits since the last statistics reset.
+     *
+     * Returns:
+     *   Hit count.
+     */
+    uint64_t getHits() const { return hits.load(std::memory_order_relaxed); }
+
+    /**
+     * Gets the number of stores since the last statistics reset.
+     *
+     * Returns:
+     *   Store count.
+     */
+    uint64_t getStores() const { return stores.load(std::memory_order_relaxed); }
+
+    /**
+     * Gets the fraction of lookups that hit.
+     *
+     * Returns:
+     *   Hit rate in [0, 1], or 0 before the first lookup.
+     */
+    double getHitRate() const;
+
+    /**
+     * Resets the lookup, hit and store counters.
+     */
+    void resetStatistics();
+
+private:
+    struct Entry {
+        std::atomic<uint64_t> check; // hash ^ data
+        std::atomic<uint64_t> data;  // valid flag << 32 | makespan
+    };
+
+    std::unique_ptr<Entry[]> entries;
+    size_t mask;
+    mutable std::atomic<uint64_t> lookups;
+    mutable std::atomic<uint64_t> hits;
+    std::atomic<uint64_t> stores;
+};
+
+#endif // SEQUENCE_HASH_HPP
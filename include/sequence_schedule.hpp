@@ -0,0 +1,136 @@
+#ifndef SEQUENCE_SCHEDULE_HPP
+#define SEQUENCE_SCHEDULE_HPP
+
+#include "flat_instance.hpp"
+#include <vector>
+
+/**
+ * Semi-active timing of a schedule given as per-machine sequences.
+ *
+ * Each operation starts as soon as its job predecessor and its machine
+ * predecessor have finished (the disjunctive graph longest path). load()
+ * evaluates a full schedule; swapAdjacent() re-times only the operations
+ * reachable from the swapped pair, which is what neighbourhood searches
+ * and path relinking spend their time on.
+ */
+class SequenceSchedule {
+public:
+    /**
+     * Constructor for SequenceSchedule.
+     *
+     * Args:
+     *   instance: Flat instance to time against. Must outlive the schedule.
+     */
+    explicit SequenceSchedule(const FlatInstance& instance);
+
+    /**
+     * Loads machine sequences and times every operation. Throws
+     * std::invalid_argument if the sequences do not hold each operation
+     * exactly once on its own machine.
+     *
+     * Args:
+     *   sequences: Flat operation indices per machine.
+     *
+     * Returns:
+     *   False if the sequences contradict job order (cyclic schedule).
+     */
+    bool load(const MachineSequences& sequences);
+
+    /**
+     * Swaps the operations at position and position + 1 on a machine and
+     * re-times the affected operations. A swap that would create a cycle is
+     * undone.
+     *
+     * Args:
+     *   machine: Machine index.
+     *   position: Position of the first operation of the pair.
+     *
+     * Returns:
+     *   False if the swap was rejected.
+     */
+    bool swapAdjacent(int machine, int position);
+
+    /**
+     * Gets the makespan of the current schedule.
+     *
+     * Returns:
+     *   Makespan.
+     */
+    int getMakespan() const { return makespan; }
+
+    /**
+     * Gets the start time of an operation.
+     *
+     * Args:
+     *   op: Flat operation index.
+     *
+     * Returns:
+     *   Start time.
+     */
+    int startTime(int op) const { return start[op]; }
+
+    /**
+     * Gets the position of an operation on its machine.
+     *
+     * Args:
+     *   op: Flat operation index.
+     *
+     * Returns:
+     *   Machine position.
+     */
+    int machinePosition(int op) const { return position[op]; }
+
+    /**
+     * Gets the current machine sequences.
+     *
+     * Returns:
+     *   Flat operation indices per machine.
+     */
+    const MachineSequences& getSequences() const { return sequences; }
+
+    /**
+     * Writes start times and machine order back into a problem instance so
+     * the rest of the application (metrics, export, Gantt) can use it.
+     *
+     * Args:
+     *   problem: Problem instance the flat instance was built from.
+     */
+    void applyTo(ProblemInstance& problem) const;
+
+private:
+    const FlatInstance& instance;
+    MachineSequences sequences;
+    std::vector<int> position; // op -> index on its machine
+    std::vector<int> start;    // op -> start time
+    int makespan;
+
+    // Scratch for incremental re-timing
+    std::vector<int> inDegree;
+    std::vector<int> saved;
+    std::vector<int> stack;
+    std::vector<int> affected;
+    std::vector<char> visited;
+
+    int jobPredecessor(int op) const { return op > instance.jobStart(instance.job(op)) ? op - 1 : -1; }
+    int jobSuccessor(int op) const { return op + 1 < instance.jobStart(instance.job(op) + 1) ? op + 1 : -1; }
+    int machinePredecessor(int op) const;
+    int machineSuccessor(int op) const;
+
+    /**
+     * Recomputes the makespan from the last operation of each job.
+     */
+    void updateMakespan();
+
+    /**
+     * Re-times every operation reachable from root in topological order.
+     *
+     * Args:
+     *   root: First operation whose predecessors changed.
+     *
+     * Returns:
+     *   False if the reachable part of the graph contains a cycle.
+     */
+    bool retimeFrom(int root);
+};
+
+#endif // SEQUENCE_SCHEDULE_HPP
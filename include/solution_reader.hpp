@@ -0,0 +1,66 @@
+#ifndef SOLUTION_READER_HPP
+#define SOLUTION_READER_HPP
+
+#include "models.hpp"
+#include <cstddef>
+#include <memory>
+
+/**
+ * Single-pass readers for the TEXT, JSON and XML solution formats written
+ * by SolutionSerializer. They read a buffer, normally a mapped file, and
+ * collect flat records as they go. The model is built once at the end, in
+ * whatever order the sections appeared. Machine entries are matched to
+ * their operations through a (jobId, operationId) index, so loading is
+ * linear in the file size.
+ *
+ * As before, operations of unknown jobs, machines with unknown ids and
+ * machine entries for unknown operations are dropped. Machine entries
+ * override the times of the operations they refer to.
+ */
+class SolutionReader {
+public:
+    /**
+     * Reads a text solution. Operation and machine lines are parsed in
+     * place against their fixed grammar; lines that do not match are
+     * skipped, and unreadable metadata counts as 0. As before, machine
+     * schedules get their own Operation objects rather than sharing the
+     * job entries.
+     *
+     * Args:
+     *   data: Solution text.
+     *   size: Number of bytes.
+     *
+     * Returns:
+     *   Loaded schedule result.
+     */
+    static std::shared_ptr<ScheduleResult> readText(const char* data, size_t size);
+
+    /**
+     * Reads a JSON solution with a SAX handler. Unknown keys are skipped.
+     * Throws std::runtime_error on malformed JSON or missing fields.
+     *
+     * Args:
+     *   data: JSON text.
+     *   size: Number of bytes.
+     *
+     * Returns:
+     *   Loaded schedule result.
+     */
+    static std::shared_ptr<ScheduleResult> readJSON(const char* data, size_t size);
+
+    /**
+     * Reads an XML solution with a pull parser. Unknown elements are
+     * skipped, and missing or unreadable values count as 0. Throws
+     * std::runtime_error on unbalanced or unterminated tags.
+     *
+     * Args:
+     *   data: XML text.
+     *   size: Number of bytes.
+     *
+     * Returns:
+     *   Loaded schedule result.
+     */
+    static std::shared_ptr<ScheduleResult> readXML(const char* data, size_t size);
+};
+
+#endif // SOLUTION_READER_HPP
@@ -16,7 +16,8 @@ using json = nlohmann::json;
 enum class ExportFormat {
     TEXT,
     JSON,
-    XML
+    XML,
+    BINARY
 };
 
 /**
@@ -47,7 +48,21 @@ public:
                           const std::string& filename);
     
     /**
-     * Exports a ScheduleResult to JSON format.
+     * Streams a ScheduleResult in text format. Integers are formatted with
+     * std::to_chars into a fixed-size buffer; the bytes are the same as
+     * writing each value to the stream with operator<<.
+     *
+     * Args:
+     *   result: Schedule result to write.
+     *   out: Output stream.
+     */
+    static void writeText(const std::shared_ptr<ScheduleResult>& result, 
+                          std::ostream& out);
+    
+    /**
+     * Exports a ScheduleResult to JSON format. The document is streamed
+     * through a fixed-size buffer, so memory use does not grow with the
+     * schedule.
      *
      * Args:
      *   result: Schedule result to export.
@@ -56,6 +71,17 @@ public:
     static void exportJSON(const std::shared_ptr<ScheduleResult>& result, 
                           const std::string& filename);
     
+    /**
+     * Streams a ScheduleResult as JSON, byte-identical to dumping the
+     * equivalent nlohmann::json document with std::setw(4).
+     *
+     * Args:
+     *   result: Schedule result to write.
+     *   out: Output stream.
+     */
+    static void writeJSON(const std::shared_ptr<ScheduleResult>& result, 
+                         std::ostream& out);
+    
     /**
      * Exports a ScheduleResult to XML format.
      *
@@ -67,7 +93,31 @@ public:
                          const std::string& filename);
     
     /**
-     * Detects format from filename extension.
+     * Streams a ScheduleResult in XML format. Integers are formatted with
+     * std::to_chars into a fixed-size buffer; the bytes are the same as
+     * writing each value to the stream with operator<<.
+     *
+     * Args:
+     *   result: Schedule result to write.
+     *   out: Output stream.
+     */
+    static void writeXML(const std::shared_ptr<ScheduleResult>& result, 
+                         std::ostream& out);
+    
+    /**
+     * Exports a ScheduleResult to the compact binary format (see
+     * BinarySolution).
+     *
+     * Args:
+     *   result: Schedule result to export.
+     *   filename: Output file path.
+     */
+    static void exportBinary(const std::shared_ptr<ScheduleResult>& result, 
+                            const std::string& filename);
+    
+    /**
+     * Detects format from filename extension. The file is not opened, so
+     * this is safe for export targets; loaders sniff the content instead.
      *
      * Args:
      *   filename: File path.
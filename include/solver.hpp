@@ -2,18 +2,25 @@
 #define SOLVER_HPP
 
 #include "models.hpp"
+#include "solver_config.hpp"
+#include "flat_instance.hpp"
 #include <queue>
 #include <algorithm>
 #include <functional>
 #include <iostream>
 
+class ElitePool;
+class ResultCache;
+
 /**
  * Enumeration for scheduling algorithms.
  */
 enum class SchedulingAlgorithm {
     FIFO,
     SPT, // Shortest Processing Time
-    LPT  // Longest Processing Time
+    LPT, // Longest Processing Time
+    LNS, // Large Neighborhood Search, seeded with SPT
+    ISLANDS // Island-model LNS in parallel worker processes, seeded with SPT
 };
 
 /**
@@ -22,6 +29,10 @@ enum class SchedulingAlgorithm {
 class Solver {
 private:
     SchedulingAlgorithm algorithm;
+    SolverConfig config;
+    std::string checkpointPath;
+    double checkpointInterval;
+    std::shared_ptr<ResultCache> cache;
     
     // Helper methods for different algorithms
     /**
@@ -48,6 +59,37 @@ private:
      */
     void scheduleLPT(std::shared_ptr<ProblemInstance> problem);
 
+    /**
+     * Schedules operations with SPT, then improves the schedule with LNS
+     * and relinks the elite schedules it passed through.
+     *
+     * Args:
+     *   problem: Problem instance to schedule.
+     */
+    void scheduleLNS(std::shared_ptr<ProblemInstance> problem);
+
+    /**
+     * Schedules operations with SPT, then improves the schedule with LNS on
+     * several migrating worker processes and relinks their elite schedules.
+     *
+     * Args:
+     *   problem: Problem instance to schedule.
+     */
+    void scheduleIslands(std::shared_ptr<ProblemInstance> problem);
+
+    /**
+     * Runs path relinking between the members of an elite pool, in
+     * parallel, after an improvement engine filled it. Replaces the best
+     * schedule if relinking found a better one.
+     *
+     * Args:
+     *   flat: Flat instance of the problem.
+     *   elites: Elite pool; relinked schedules are inserted into it.
+     *   best: Best schedule of the engine; updated.
+     *   bestMakespan: Its makespan; updated.
+     */
+    void relinkElites(const FlatInstance& flat, ElitePool& elites, MachineSequences& best, int& bestMakespan) const;
+
     // Generic scheduling helper
     /**
      * Schedules operations using a custom priority comparison.
@@ -85,6 +127,86 @@ public:
      */
     SchedulingAlgorithm getAlgorithm() const;
 
+    /**
+     * Sets the number of LNS iterations used by SchedulingAlgorithm::LNS.
+     *
+     * Args:
+     *   iterations: Iteration count.
+     */
+    void setLNSIterations(int iterations);
+
+    /**
+     * Gets the number of LNS iterations.
+     *
+     * Returns:
+     *   Iteration count.
+     */
+    int getLNSIterations() const;
+
+    /**
+     * Sets the hyperparameters of the improvement engines.
+     *
+     * Args:
+     *   newConfig: Engine parameters.
+     */
+    void setConfig(const SolverConfig& newConfig);
+
+    /**
+     * Gets the hyperparameters of the improvement engines.
+     *
+     * Returns:
+     *   Current engine parameters.
+     */
+    const SolverConfig& getConfig() const;
+
+    /**
+     * Loads engine hyperparameters from a config file, such as one written
+     * by the tuning tool.
+     *
+     * Args:
+     *   filename: Path to config file.
+     */
+    void loadConfig(const std::string& filename);
+
+    /**
+     * Enables checkpointing of the LNS search. If the file holds a
+     * checkpoint of the same instance, the next LNS solve resumes from it
+     * and only runs the remaining iterations; otherwise it starts afresh.
+     * The search state is saved every intervalSeconds and when the search
+     * ends. Island solves ignore the checkpoint and print a warning.
+     *
+     * Args:
+     *   path: Checkpoint file path; empty disables checkpointing.
+     *   intervalSeconds: Time between checkpoints.
+     */
+    void setCheckpoint(const std::string& path, double intervalSeconds = 5.0);
+
+    /**
+     * Gets the checkpoint file path.
+     *
+     * Returns:
+     *   Checkpoint path, empty if checkpointing is disabled.
+     */
+    const std::string& getCheckpointPath() const;
+
+    /**
+     * Sets a result cache. Solves whose instance, algorithm and engine
+     * config match a cached solution take the verified cached schedule
+     * instead of running the algorithm; other solves are stored in it.
+     *
+     * Args:
+     *   resultCache: Cache to use; nullptr disables caching.
+     */
+    void setCache(std::shared_ptr<ResultCache> resultCache);
+
+    /**
+     * Gets the result cache.
+     *
+     * Returns:
+     *   Cache in use, or nullptr.
+     */
+    std::shared_ptr<ResultCache> getCache() const;
+
     /**
      * Solves the problem instance using the current algorithm.
      *
@@ -121,6 +243,22 @@ public:
      */
     static std::shared_ptr<Solver> createLPTSolver();
 
+    /**
+     * Creates a LNS solver.
+     *
+     * Returns:
+     *   LNS solver instance.
+     */
+    static std::shared_ptr<Solver> createLNSSolver();
+
+    /**
+     * Creates an island-model LNS solver.
+     *
+     * Returns:
+     *   Island solver instance.
+     */
+    static std::shared_ptr<Solver> createIslandSolver();
+
     // Get algorithm name
     /**
      * Gets the name of the algorithm.
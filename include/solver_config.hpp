@@ -0,0 +1,104 @@
+#ifndef SOLVER_CONFIG_HPP
+#define SOLVER_CONFIG_HPP
+
+#include "lns_engine.hpp"
+#include <string>
+#include <vector>
+
+/**
+ * Hyperparameters of the improvement engines, as stored in a config file.
+ *
+ * The file format is one "key = value" pair per line. Blank lines and text
+ * after '#' are ignored, and keys that are not listed keep their defaults:
+ *
+ *   lns_iterations = 200
+ *   block_size = 6
+ *   machines_per_subproblem = 2
+ *   node_limit = 2000
+ *   threads = 0
+ *   tabu_tenure = 16
+ *   seed = 1
+ *   islands = 4
+ *   migration_interval = 50
+ *   elite_size = 8
+ */
+struct SolverConfig {
+    int lnsIterations = 200;
+    LNSConfig lns;
+    int islands = 4;            // worker processes of the island model
+    int migrationInterval = 50; // LNS iterations between migrations
+    int eliteSize = 8;          // elite schedules relinked after a search; 0 = no relinking
+
+    /**
+     * Parses a config from "key = value" text. Throws std::invalid_argument
+     * on unknown keys, malformed lines, or values out of range.
+     *
+     * Args:
+     *   text: Config file contents.
+     *
+     * Returns:
+     *   Parsed config.
+     */
+    static SolverConfig parseString(const std::string& text);
+
+    /**
+     * Loads a config file. Throws std::runtime_error if it cannot be read.
+     *
+     * Args:
+     *   filename: Path to config file.
+     *
+     * Returns:
+     *   Parsed config.
+     */
+    static SolverConfig loadFromFile(const std::string& filename);
+
+    /**
+     * Saves the config in the format read by loadFromFile.
+     *
+     * Args:
+     *   filename: Output file path.
+     */
+    void saveToFile(const std::string& filename) const;
+
+    /**
+     * Formats the config as "key = value" lines.
+     *
+     * Returns:
+     *   Config file contents.
+     */
+    std::string toString() const;
+
+    /**
+     * Reads a parameter by its config key.
+     *
+     * Args:
+     *   key: Config key, e.g. "block_size".
+     *
+     * Returns:
+     *   Parameter value.
+     */
+    long getValue(const std::string& key) const;
+
+    /**
+     * Writes a parameter by its config key. Throws std::invalid_argument on
+     * unknown keys or values out of range.
+     *
+     * Args:
+     *   key: Config key.
+     *   value: New value.
+     */
+    void setValue(const std::string& key, long value);
+
+    /**
+     * Gets all config keys in file order.
+     *
+     * Returns:
+     *   Config keys.
+     */
+    static const std::vector<std::string>& getKeys();
+
+    bool operator==(const SolverConfig& other) const;
+    bool operator!=(const SolverConfig& other) const { return !(*this == other); }
+};
+
+#endif // SOLVER_CONFIG_HPP
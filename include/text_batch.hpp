@@ -0,0 +1,122 @@
+#ifndef TEXT_BATCH_HPP
+#define TEXT_BATCH_HPP
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Batches many short labels into one vertex array per character size,
+ * textured from the font's glyph atlas, so they are drawn with one draw
+ * call per size instead of one sf::Text each.
+ *
+ * The glyph layout of each string is computed once per character size, the
+ * way sf::Text lays out regular single-line text, and cached; adding a
+ * label copies its cached quads with an offset and a color. Labels are
+ * meant to be added when a chart is rebuilt and drawn every frame until the
+ * next rebuild. A cache that reaches MAX_LAYOUTS strings of one size is
+ * emptied, which bounds it when labels keep changing, as time axis labels
+ * do while panning.
+ *
+ * The font must outlive the batch. Glyph texture coordinates are in
+ * pixels, so they stay valid when the font grows its atlas for new glyphs.
+ */
+class TextBatch {
+public:
+    static constexpr size_t MAX_LAYOUTS = 4096;
+
+    /**
+     * Constructor for TextBatch.
+     *
+     * Args:
+     *   font: Font to lay out and draw with.
+     */
+    explicit TextBatch(const sf::Font& font);
+
+    /**
+     * Removes all labels. Cached layouts are kept.
+     */
+    void clear();
+
+    /**
+     * Adds a label. The offset is rounded to whole pixels, so glyphs are
+     * sampled from the atlas without blurring.
+     *
+     * Args:
+     *   text: Label text; one line.
+     *   size: Character size.
+     *   position: Position of the anchor point.
+     *   color: Text color.
+     *   anchor: Fraction of the text size the label is moved back by;
+     *     (0, 0) places the text origin at the position as with sf::Text,
+     *     (0.5, 0.5) centers the text on it.
+     */
+    void add(const std::string& text, unsigned size, sf::Vector2f position, sf::Color color,
+             sf::Vector2f anchor = sf::Vector2f(0, 0));
+
+    /**
+     * Gets the bounds of a string, as sf::Text::getLocalBounds would.
+     *
+     * Args:
+     *   text: Text.
+     *   size: Character size.
+     *
+     * Returns:
+     *   Bounds relative to the text origin.
+     */
+    sf::FloatRect getLocalBounds(const std::string& text, unsigned size);
+
+    /**
+     * Draws all labels, one draw call per character size.
+     *
+     * Args:
+     *   target: Window or render texture to draw to.
+     */
+    void draw(sf::RenderTarget& target);
+
+    /**
+     * Gets the number of glyphs added since the last clear().
+     *
+     * Returns:
+     *   Glyph count.
+     */
+    size_t getGlyphCount() const;
+
+    /**
+     * Gets the number of cached layouts over all character sizes.
+     *
+     * Returns:
+     *   Layout count.
+     */
+    size_t getLayoutCount() const;
+
+private:
+    /**
+     * Glyph quads of a string placed at the origin, and its bounds.
+     */
+    struct Layout {
+        std::vector<sf::Vertex> vertices;
+        sf::FloatRect bounds;
+    };
+
+    /**
+     * Labels and cached layouts of one character size.
+     */
+    struct Page {
+        sf::VertexArray vertices{sf::Triangles};
+        std::unordered_map<std::string, Layout> layouts;
+    };
+
+    const sf::Font& font;
+    std::map<unsigned, Page> pages; // by character size
+
+    /**
+     * Gets the cached layout of a string, computing it on first use.
+     */
+    const Layout& layout(Page& page, const std::string& text, unsigned size);
+};
+
+#endif // TEXT_BATCH_HPP
@@ -0,0 +1,77 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+/**
+ * Fixed-size pool of worker threads running submitted tasks in FIFO order.
+ */
+class ThreadPool {
+public:
+    /**
+     * Constructor for ThreadPool.
+     *
+     * Args:
+     *   threads: Worker count; 0 uses all hardware threads.
+     */
+    explicit ThreadPool(int threads = 0);
+
+    /**
+     * Destructor. Finishes queued tasks, then joins the workers.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * Queues a task.
+     *
+     * Args:
+     *   task: Callable taking no arguments.
+     *
+     * Returns:
+     *   Future holding the task's result or exception.
+     */
+    template <typename F>
+    auto submit(F task) -> std::future<decltype(task())> {
+        using Result = decltype(task());
+        auto packaged = std::make_shared<std::packaged_task<Result()>>(std::move(task));
+        std::future<Result> future = packaged->get_future();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            tasks.emplace([packaged]() { (*packaged)(); });
+        }
+        available.notify_one();
+        return future;
+    }
+
+    /**
+     * Gets the number of worker threads.
+     *
+     * Returns:
+     *   Worker count.
+     */
+    int getThreadCount() const { return static_cast<int>(workers.size()); }
+
+private:
+    std::vector<std::thread> workers;
+    std::queue<std::function<void()>> tasks;
+    std::mutex mutex;
+    std::condition_variable available;
+    bool stopping;
+
+    /**
+     * Worker loop: runs tasks until the pool stops and the queue is empty.
+     */
+    void workerLoop();
+};
+
+#endif // THREAD_POOL_HPP
@@ -0,0 +1,585 @@
+#include "batch_evaluator.hpp"
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <thread>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define JSSP_X86_SIMD 1
+#include <immintrin.h>
+#else
+#define JSSP_X86_SIMD 0
+#endif
+
+namespace {
+
+/**
+ * Share of the scalar time a SIMD backend must stay under to be selected.
+ */
+const double MIN_SPEEDUP = 0.9;
+
+/**
+ * Defaults the thread count to the hardware threads.
+ */
+int defaultThreadCount() {
+    return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+}
+
+} // namespace
+
+/**
+ * Constructor for BatchEvaluator using the fastest backend of this CPU.
+ *
+ * Args:
+ *   instance: Flat instance to evaluate against.
+ */
+BatchEvaluator::BatchEvaluator(const FlatInstance& instance)
+    : instance(instance), backend(selectBackend()), threadCount(defaultThreadCount()) {}
+
+/**
+ * Constructor for BatchEvaluator with an explicit backend.
+ *
+ * Args:
+ *   instance: Flat instance to evaluate against.
+ *   backend: Requested backend.
+ */
+BatchEvaluator::BatchEvaluator(const FlatInstance& instance, EvaluatorBackend backend)
+    : instance(instance), backend(isSupported(backend) ? backend : selectBackend()),
+      threadCount(defaultThreadCount()) {}
+
+/**
+ * Detects the widest backend supported by the running CPU.
+ *
+ * Returns:
+ *   Widest available backend.
+ */
+EvaluatorBackend BatchEvaluator::detectBackend() {
+    if (isSupported(EvaluatorBackend::AVX512)) return EvaluatorBackend::AVX512;
+    if (isSupported(EvaluatorBackend::AVX2)) return EvaluatorBackend::AVX2;
+    return EvaluatorBackend::Scalar;
+}
+
+/**
+ * Selects the backend that decodes fastest on this CPU. The first call
+ * times every supported backend on a random 50x15 instance; a SIMD backend
+ * is only picked if it beats scalar by 10%. Later calls return the same
+ * choice.
+ *
+ * Returns:
+ *   Fastest backend.
+ */
+EvaluatorBackend BatchEvaluator::selectBackend() {
+    static const EvaluatorBackend selected = calibrate();
+    return selected;
+}
+
+/**
+ * Times each supported backend on a random instance and candidate batch.
+ *
+ * Returns:
+ *   Fastest backend, scalar unless a SIMD backend is clearly faster.
+ */
+EvaluatorBackend BatchEvaluator::calibrate() {
+    const int jobs = 50;
+    const int machines = 15;
+    const int n = jobs * machines;
+    const int count = 256;
+
+    // Random routes and durations, one operation per machine and job
+    auto arrays = std::make_shared<std::vector<int32_t>>();
+    std::vector<int32_t>& data = *arrays;
+    data.resize(static_cast<size_t>(jobs + 1) + 4 * static_cast<size_t>(n));
+    int32_t* jobStarts = data.data();
+    int32_t* jobOf = jobStarts + jobs + 1;
+    int32_t* machineOf = jobOf + n;
+    int32_t* durations = machineOf + n;
+    int32_t* ids = durations + n;
+    std::mt19937 rng(1);
+    std::vector<int32_t> route(machines);
+    for (int j = 0; j <= jobs; ++j) {
+        jobStarts[j] = j * machines;
+    }
+    for (int j = 0; j < jobs; ++j) {
+        for (int m = 0; m < machines; ++m) {
+            route[m] = m;
+        }
+        std::shuffle(route.begin(), route.end(), rng);
+        for (int k = 0; k < machines; ++k) {
+            int op = j * machines + k;
+            jobOf[op] = j;
+            machineOf[op] = route[k];
+            durations[op] = 1 + static_cast<int32_t>(rng() % 99);
+            ids[op] = op;
+        }
+    }
+    FlatInstance flat = FlatInstance::fromArrays(jobs, machines, n, jobStarts, jobOf, machineOf, durations, ids,
+                                                 arrays);
+
+    std::vector<int32_t> sequences;
+    sequences.reserve(static_cast<size_t>(count) * n);
+    std::vector<int32_t> base(jobOf, jobOf + n);
+    for (int c = 0; c < count; ++c) {
+        std::shuffle(base.begin(), base.end(), rng);
+        sequences.insert(sequences.end(), base.begin(), base.end());
+    }
+    std::vector<int32_t> makespans(count);
+
+    // Best of three single-threaded runs per backend
+    auto time = [&](EvaluatorBackend candidate) {
+        BatchEvaluator evaluator(flat, candidate);
+        evaluator.setThreadCount(1);
+        double best = std::numeric_limits<double>::max();
+        for (int run = 0; run < 3; ++run) {
+            auto start = std::chrono::steady_clock::now();
+            evaluator.evaluateBatch(sequences.data(), count, makespans.data());
+            best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+        }
+        return best;
+    };
+
+    EvaluatorBackend fastest = EvaluatorBackend::Scalar;
+    double fastestTime = time(EvaluatorBackend::Scalar) * MIN_SPEEDUP;
+    for (auto candidate : {EvaluatorBackend::AVX2, EvaluatorBackend::AVX512}) {
+        if (isSupported(candidate)) {
+            double elapsed = time(candidate);
+            if (elapsed < fastestTime) {
+                fastest = candidate;
+                fastestTime = elapsed;
+            }
+        }
+    }
+    return fastest;
+}
+
+/**
+ * Checks whether a backend can run on this CPU.
+ *
+ * Args:
+ *   backend: Backend to check.
+ *
+ * Returns:
+ *   True if supported.
+ */
+bool BatchEvaluator::isSupported(EvaluatorBackend backend) {
+    switch (backend) {
+        case EvaluatorBackend::Scalar:
+            return true;
+#if JSSP_X86_SIMD
+        case EvaluatorBackend::AVX2:
+            return __builtin_cpu_supports("avx2");
+        case EvaluatorBackend::AVX512:
+            return __builtin_cpu_supports("avx512f");
+#endif
+        default:
+            return false;
+    }
+}
+
+/**
+ * Gets the name of a backend.
+ *
+ * Args:
+ *   backend: Backend type.
+ *
+ * Returns:
+ *   Backend name string.
+ */
+std::string BatchEvaluator::getBackendName(EvaluatorBackend backend) {
+    switch (backend) {
+        case EvaluatorBackend::Scalar: return "Scalar";
+        case EvaluatorBackend::AVX2: return "AVX2 (8 lanes)";
+        case EvaluatorBackend::AVX512: return "AVX-512 (16 lanes)";
+        default: return "Unknown";
+    }
+}
+
+/**
+ * Gets the number of candidates decoded in lockstep.
+ *
+ * Returns:
+ *   Lane count of the active backend.
+ */
+int BatchEvaluator::getLaneCount() const {
+    switch (backend) {
+        case EvaluatorBackend::AVX2: return 8;
+        case EvaluatorBackend::AVX512: return 16;
+        default: return 1;
+    }
+}
+
+/**
+ * Sets how many threads share a batch.
+ *
+ * Args:
+ *   threads: Thread count; 0 uses all hardware threads.
+ */
+void BatchEvaluator::setThreadCount(int threads) {
+    if (threads <= 0) {
+        threads = static_cast<int>(std::thread::hardware_concurrency());
+    }
+    threadCount = std::max(1, threads);
+}
+
+/**
+ * Decodes one sequence with plain scalar code, validating it on the way.
+ *
+ * Args:
+ *   sequence: Job-repetition sequence.
+ *   scratch: Worker scratch buffers.
+ *
+ * Returns:
+ *   Makespan.
+ */
+int BatchEvaluator::decodeScalar(const int32_t* sequence, LaneScratch& scratch) const {
+    const int numJobs = instance.getNumJobs();
+    const int32_t* jobStarts = instance.jobStarts();
+    const int32_t* machines = instance.machines();
+    const int32_t* durations = instance.durations();
+
+    scratch.jobNext.assign(jobStarts, jobStarts + numJobs);
+    scratch.jobReady.assign(numJobs, 0);
+    scratch.machineReady.assign(instance.getNumMachines(), 0);
+    int32_t* next = scratch.jobNext.data();
+    int32_t* jobEnd = scratch.jobReady.data();
+    int32_t* machineEnd = scratch.machineReady.data();
+
+    int makespan = 0;
+    for (int k = 0; k < instance.getNumOperations(); ++k) {
+        int job = sequence[k];
+        if (job < 0 || job >= numJobs || next[job] >= jobStarts[job + 1]) {
+            throw std::invalid_argument("Invalid job sequence at position " + std::to_string(k));
+        }
+        int op = next[job]++;
+        int machine = machines[op];
+        int end = std::max(jobEnd[job], machineEnd[machine]) + durations[op];
+        jobEnd[job] = end;
+        machineEnd[machine] = end;
+        makespan = std::max(makespan, end);
+    }
+    return makespan;
+}
+
+/**
+ * Evaluates a single sequence with the scalar decoder.
+ *
+ * Args:
+ *   sequence: Job-repetition sequence.
+ *
+ * Returns:
+ *   Makespan of the decoded schedule.
+ */
+int BatchEvaluator::evaluate(const std::vector<int>& sequence) const {
+    if (static_cast<int>(sequence.size()) != instance.getNumOperations()) {
+        throw std::invalid_argument("Sequence length does not match operation count");
+    }
+    LaneScratch scratch;
+    return decodeScalar(sequence.data(), scratch);
+}
+
+/**
+ * Evaluates a batch of sequences.
+ *
+ * Args:
+ *   sequences: Job-repetition sequences.
+ *
+ * Returns:
+ *   Makespan per sequence, in input order.
+ */
+std::vector<int> BatchEvaluator::evaluateBatch(const std::vector<std::vector<int>>& sequences) const {
+    std::vector<int> makespans(sequences.size(), 0);
+    if (sequences.empty()) {
+        return makespans;
+    }
+
+    // Gather rows into one buffer so both overloads share the lane kernels
+    const int n = instance.getNumOperations();
+    std::vector<int32_t> rows;
+    rows.reserve(sequences.size() * static_cast<size_t>(n));
+    for (const auto& sequence : sequences) {
+        if (static_cast<int>(sequence.size()) != n) {
+            throw std::invalid_argument("Sequence length does not match operation count");
+        }
+        rows.insert(rows.end(), sequence.begin(), sequence.end());
+    }
+    evaluateBatch(rows.data(), static_cast<int>(sequences.size()), makespans.data());
+    return makespans;
+}
+
+/**
+ * Evaluates a batch stored row-major in one contiguous buffer.
+ *
+ * Args:
+ *   sequences: count * numOperations job indices.
+ *   count: Number of sequences.
+ *   makespans: Output array of count makespans.
+ */
+void BatchEvaluator::evaluateBatch(const int32_t* sequences, int count, int32_t* makespans) const {
+    const int n = instance.getNumOperations();
+    const int lanes = getLaneCount();
+
+    // Split on lane-group boundaries; tiny batches are not worth a thread
+    int groups = (count + lanes - 1) / lanes;
+    int workers = std::min(threadCount, groups / 4);
+    if (workers <= 1) {
+        LaneScratch scratch;
+        evaluateRange(sequences, count, makespans, scratch);
+        return;
+    }
+
+    std::vector<std::thread> threads;
+    std::vector<std::exception_ptr> errors(workers);
+    int groupsPerWorker = (groups + workers - 1) / workers;
+    for (int w = 0; w < workers; ++w) {
+        int first = std::min(count, w * groupsPerWorker * lanes);
+        int last = std::min(count, (w + 1) * groupsPerWorker * lanes);
+        threads.emplace_back([this, sequences, makespans, first, last, n, &errors, w]() {
+            try {
+                LaneScratch scratch;
+                evaluateRange(sequences + static_cast<size_t>(first) * n, last - first, makespans + first, scratch);
+            } catch (...) {
+                errors[w] = std::current_exception();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+/**
+ * Evaluates a contiguous range of sequences on the calling thread.
+ *
+ * Args:
+ *   sequences: First sequence of the range.
+ *   count: Number of sequences.
+ *   makespans: Output array of count makespans.
+ *   scratch: Worker scratch buffers.
+ */
+void BatchEvaluator::evaluateRange(const int32_t* sequences, int count, int32_t* makespans,
+                                   LaneScratch& scratch) const {
+    const int n = instance.getNumOperations();
+    const int lanes = getLaneCount();
+
+    // Lane offsets are 32-bit gather indices, so huge instances stay scalar
+    bool vectorized = backend != EvaluatorBackend::Scalar &&
+                      static_cast<int64_t>(n) * lanes < std::numeric_limits<int32_t>::max();
+    if (!vectorized) {
+        for (int c = 0; c < count; ++c) {
+            makespans[c] = decodeScalar(sequences + static_cast<size_t>(c) * n, scratch);
+        }
+        return;
+    }
+
+    alignas(64) int32_t laneMakespans[16];
+    for (int first = 0; first < count; first += lanes) {
+        int groupSize = std::min(lanes, count - first);
+        const int32_t* group = sequences + static_cast<size_t>(first) * n;
+        resetLanes(scratch, lanes);
+
+        bool valid = backend == EvaluatorBackend::AVX512
+                         ? decodeGroupAVX512(group, groupSize, scratch, laneMakespans)
+                         : decodeGroupAVX2(group, groupSize, scratch, laneMakespans);
+        if (!valid || !countsMatch(scratch, lanes)) {
+            // Rerun lane by lane so the error names the offending position
+            for (int l = 0; l < groupSize; ++l) {
+                decodeScalar(group + static_cast<size_t>(l) * n, scratch);
+            }
+        }
+        std::copy(laneMakespans, laneMakespans + groupSize, makespans + first);
+    }
+}
+
+/**
+ * Resets per-lane job and machine state before decoding a lane group.
+ *
+ * Args:
+ *   scratch: Worker scratch buffers.
+ *   lanes: Lane count.
+ */
+void BatchEvaluator::resetLanes(LaneScratch& scratch, int lanes) const {
+    const int numJobs = instance.getNumJobs();
+    const int32_t* jobStarts = instance.jobStarts();
+    scratch.jobNext.resize(static_cast<size_t>(numJobs) * lanes);
+    for (int j = 0; j < numJobs; ++j) {
+        std::fill_n(scratch.jobNext.begin() + static_cast<size_t>(j) * lanes, lanes, jobStarts[j]);
+    }
+    scratch.jobReady.assign(static_cast<size_t>(numJobs) * lanes, 0);
+    scratch.machineReady.assign(static_cast<size_t>(instance.getNumMachines()) * lanes, 0);
+}
+
+/**
+ * Checks that every lane consumed each job exactly jobLength times.
+ *
+ * Args:
+ *   scratch: Worker scratch buffers after decoding a lane group.
+ *   lanes: Lane count.
+ *
+ * Returns:
+ *   True if all lanes held valid job-repetition sequences.
+ */
+bool BatchEvaluator::countsMatch(const LaneScratch& scratch, int lanes) const {
+    const int32_t* jobStarts = instance.jobStarts();
+    const int32_t* next = scratch.jobNext.data();
+    for (int j = 0; j < instance.getNumJobs(); ++j) {
+        for (int l = 0; l < lanes; ++l) {
+            if (next[static_cast<size_t>(j) * lanes + l] != jobStarts[j + 1]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+#if JSSP_X86_SIMD
+
+/**
+ * Decodes one lane group with AVX2 (8 lanes). Lane l reads sequence l of the
+ * group; lanes past groupSize replay sequence 0.
+ *
+ * Args:
+ *   sequences: First sequence of the group, row-major.
+ *   groupSize: Number of real sequences in the group.
+ *   scratch: Worker scratch buffers, reset for 8 lanes.
+ *   makespans: Output makespans of the 8 lanes.
+ *
+ * Returns:
+ *   False if a lane read a job index out of range.
+ */
+__attribute__((target("avx2")))
+bool BatchEvaluator::decodeGroupAVX2(const int32_t* sequences, int groupSize, LaneScratch& scratch,
+                                     int32_t* makespans) const {
+    const int n = instance.getNumOperations();
+    const int* machines = instance.machines();
+    const int* durations = instance.durations();
+    int* next = scratch.jobNext.data();
+    int* jobEnd = scratch.jobReady.data();
+    int* machineEnd = scratch.machineReady.data();
+
+    const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i jobLimit = _mm256_set1_epi32(instance.getNumJobs());
+    const __m256i lastOp = _mm256_set1_epi32(n - 1);
+    __m256i position = _mm256_and_si256(_mm256_mullo_epi32(lane, _mm256_set1_epi32(n)),
+                                        _mm256_cmpgt_epi32(_mm256_set1_epi32(groupSize), lane));
+    __m256i makespan = _mm256_setzero_si256();
+    __m256i invalid = _mm256_setzero_si256();
+    alignas(32) int32_t jobSlots[8], machineSlots[8], ops[8], ends[8];
+
+    for (int k = 0; k < n; ++k) {
+        __m256i job = _mm256_i32gather_epi32(sequences, position, 4);
+        position = _mm256_add_epi32(position, one);
+
+        // Out-of-range jobs are redirected to job 0 and reported after the pass
+        __m256i inRange = _mm256_andnot_si256(_mm256_cmpgt_epi32(_mm256_setzero_si256(), job),
+                                              _mm256_cmpgt_epi32(jobLimit, job));
+        invalid = _mm256_or_si256(invalid, _mm256_andnot_si256(inRange, _mm256_set1_epi32(-1)));
+        __m256i jobSlot = _mm256_add_epi32(_mm256_slli_epi32(_mm256_and_si256(job, inRange), 3), lane);
+
+        __m256i op = _mm256_i32gather_epi32(next, jobSlot, 4);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(ops), _mm256_add_epi32(op, one));
+        _mm256_store_si256(reinterpret_cast<__m256i*>(jobSlots), jobSlot);
+        op = _mm256_min_epi32(op, lastOp);
+
+        __m256i machineSlot = _mm256_add_epi32(_mm256_slli_epi32(_mm256_i32gather_epi32(machines, op, 4), 3), lane);
+        __m256i end = _mm256_add_epi32(_mm256_max_epi32(_mm256_i32gather_epi32(jobEnd, jobSlot, 4),
+                                                        _mm256_i32gather_epi32(machineEnd, machineSlot, 4)),
+                                       _mm256_i32gather_epi32(durations, op, 4));
+        makespan = _mm256_max_epi32(makespan, end);
+
+        // AVX2 has no scatter; slots never alias because each one carries its lane
+        _mm256_store_si256(reinterpret_cast<__m256i*>(machineSlots), machineSlot);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(ends), end);
+        for (int l = 0; l < 8; ++l) {
+            next[jobSlots[l]] = ops[l];
+            jobEnd[jobSlots[l]] = ends[l];
+            machineEnd[machineSlots[l]] = ends[l];
+        }
+    }
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(makespans), makespan);
+    return _mm256_testz_si256(invalid, invalid);
+}
+
+// GCC 12 flags the intentionally undefined source registers inside the AVX-512 headers
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+/**
+ * Decodes one lane group with AVX-512 (16 lanes). Lane l reads sequence l of
+ * the group; lanes past groupSize replay sequence 0.
+ *
+ * Args:
+ *   sequences: First sequence of the group, row-major.
+ *   groupSize: Number of real sequences in the group.
+ *   scratch: Worker scratch buffers, reset for 16 lanes.
+ *   makespans: Output makespans of the 16 lanes.
+ *
+ * Returns:
+ *   False if a lane read a job index out of range.
+ */
+__attribute__((target("avx512f")))
+bool BatchEvaluator::decodeGroupAVX512(const int32_t* sequences, int groupSize, LaneScratch& scratch,
+                                       int32_t* makespans) const {
+    const int n = instance.getNumOperations();
+    const int* machines = instance.machines();
+    const int* durations = instance.durations();
+    int* next = scratch.jobNext.data();
+    int* jobEnd = scratch.jobReady.data();
+    int* machineEnd = scratch.machineReady.data();
+
+    const __m512i lane = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    const __m512i one = _mm512_set1_epi32(1);
+    const __m512i jobLimit = _mm512_set1_epi32(instance.getNumJobs());
+    const __m512i lastOp = _mm512_set1_epi32(n - 1);
+    __mmask16 realLanes = static_cast<__mmask16>((1u << groupSize) - 1);
+    __m512i position = _mm512_maskz_mullo_epi32(realLanes, lane, _mm512_set1_epi32(n));
+    __m512i makespan = _mm512_setzero_si512();
+    __mmask16 invalid = 0;
+
+    for (int k = 0; k < n; ++k) {
+        __m512i job = _mm512_i32gather_epi32(position, sequences, 4);
+        position = _mm512_add_epi32(position, one);
+
+        // Unsigned compare also rejects negatives; bad lanes fall back to job 0
+        __mmask16 inRange = _mm512_cmplt_epu32_mask(job, jobLimit);
+        invalid |= static_cast<__mmask16>(~inRange);
+        __m512i jobSlot = _mm512_add_epi32(_mm512_slli_epi32(_mm512_maskz_mov_epi32(inRange, job), 4), lane);
+
+        __m512i op = _mm512_i32gather_epi32(jobSlot, next, 4);
+        _mm512_i32scatter_epi32(next, jobSlot, _mm512_add_epi32(op, one), 4);
+        op = _mm512_min_epi32(op, lastOp);
+
+        __m512i machineSlot = _mm512_add_epi32(_mm512_slli_epi32(_mm512_i32gather_epi32(op, machines, 4), 4), lane);
+        __m512i end = _mm512_add_epi32(_mm512_max_epi32(_mm512_i32gather_epi32(jobSlot, jobEnd, 4),
+                                                        _mm512_i32gather_epi32(machineSlot, machineEnd, 4)),
+                                       _mm512_i32gather_epi32(op, durations, 4));
+        makespan = _mm512_max_epi32(makespan, end);
+
+        _mm512_i32scatter_epi32(jobEnd, jobSlot, end, 4);
+        _mm512_i32scatter_epi32(machineEnd, machineSlot, end, 4);
+    }
+    _mm512_storeu_si512(makespans, makespan);
+    return invalid == 0;
+}
+
+#pragma GCC diagnostic pop
+
+#else
+
+// Non-x86 builds only ever select the scalar backend
+bool BatchEvaluator::decodeGroupAVX2(const int32_t*, int, LaneScratch&, int32_t*) const {
+    throw std::logic_error("AVX2 backend is not available on this platform");
+}
+
+bool BatchEvaluator::decodeGroupAVX512(const int32_t*, int, LaneScratch&, int32_t*) const {
+    throw std::logic_error("AVX-512 backend is not available on this platform");
+}
+
+#endif
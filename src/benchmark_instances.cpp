@@ -0,0 +1,460 @@
+#include "benchmark_instances.hpp"
+#include "mapped_file.hpp"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <climits>
+#include <numeric>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+namespace {
+
+const int32_t LEHMER_MODULUS = 2147483647;
+
+/**
+ * Seeds from Taillard's table for the 15x15, 20x15 and 20x20 classes.
+ */
+const std::vector<std::pair<std::string, TaillardSeeds>>& publishedSeeds() {
+    static const std::vector<std::pair<std::string, TaillardSeeds>> table = {
+        {"ta01", {15, 15, 840612802, 398197754}},
+        {"ta02", {15, 15, 1314640371, 386720536}},
+        {"ta03", {15, 15, 1227221349, 316176388}},
+        {"ta04", {15, 15, 342269428, 1806358582}},
+        {"ta05", {15, 15, 1603221416, 1501949241}},
+        {"ta06", {15, 15, 1357584978, 1734077082}},
+        {"ta07", {15, 15, 44531661, 1374316395}},
+        {"ta08", {15, 15, 302545136, 2092186050}},
+        {"ta09", {15, 15, 1153780144, 1393392374}},
+        {"ta10", {15, 15, 73896786, 1544979948}},
+        {"ta11", {20, 15, 533484900, 317419073}},
+        {"ta12", {20, 15, 1894307698, 1474268163}},
+        {"ta13", {20, 15, 874340513, 509669280}},
+        {"ta14", {20, 15, 1124986343, 1209573668}},
+        {"ta15", {20, 15, 1463788335, 529048107}},
+        {"ta16", {20, 15, 1056908795, 25321885}},
+        {"ta17", {20, 15, 195672285, 1717580117}},
+        {"ta18", {20, 15, 961965583, 1353003786}},
+        {"ta19", {20, 15, 1610169733, 1734469503}},
+        {"ta20", {20, 15, 532794656, 998486810}},
+        {"ta21", {20, 20, 1035939303, 773961798}},
+        {"ta22", {20, 20, 5997802, 1872541150}},
+        {"ta23", {20, 20, 1357503601, 722225039}},
+        {"ta24", {20, 20, 806159563, 1166962073}},
+        {"ta25", {20, 20, 1902815253, 1879990068}},
+        {"ta26", {20, 20, 1503184031, 1850351876}},
+        {"ta27", {20, 20, 1032645967, 99711329}},
+        {"ta28", {20, 20, 229894219, 1158117804}},
+        {"ta29", {20, 20, 823349822, 108033225}},
+        {"ta30", {20, 20, 1297900341, 489486403}},
+    };
+    return table;
+}
+
+bool isBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+/**
+ * Integers of the data lines of a text, in order. A data line is one whose
+ * first non-blank character is a digit or a minus sign.
+ */
+class DataLines {
+public:
+    DataLines(const std::string& text, size_t start) {
+        size_t pos = start;
+        while (pos < text.size()) {
+            size_t end = text.find('\n', pos);
+            if (end == std::string::npos) {
+                end = text.size();
+            }
+            addLine(text.data() + pos, text.data() + end);
+            pos = end + 1;
+        }
+    }
+
+    bool empty() const { return lines.empty(); }
+    const std::vector<long>& header() const { return lines.front(); }
+
+    /**
+     * Concatenates the values of the lines after the header until count
+     * values have been read.
+     */
+    std::vector<long> body(size_t count) const {
+        std::vector<long> values;
+        values.reserve(count);
+        for (size_t i = 1; i < lines.size() && values.size() < count; ++i) {
+            values.insert(values.end(), lines[i].begin(), lines[i].end());
+        }
+        if (values.size() < count) {
+            throw std::invalid_argument("Truncated instance: expected " + std::to_string(count) +
+                                        " values, found " + std::to_string(values.size()));
+        }
+        values.resize(count);
+        return values;
+    }
+
+private:
+    std::vector<std::vector<long>> lines;
+
+    void addLine(const char* p, const char* end) {
+        while (p < end && isBlank(*p)) {
+            ++p;
+        }
+        if (p == end || !(std::isdigit(static_cast<unsigned char>(*p)) || *p == '-')) {
+            return;
+        }
+        std::vector<long> values;
+        while (p < end) {
+            long value = 0;
+            std::from_chars_result result = std::from_chars(p, end, value);
+            if (result.ec != std::errc() || (result.ptr < end && !isBlank(*result.ptr))) {
+                throw std::invalid_argument("Malformed data line: " + std::string(p, end));
+            }
+            values.push_back(value);
+            p = result.ptr;
+            while (p < end && isBlank(*p)) {
+                ++p;
+            }
+        }
+        lines.push_back(std::move(values));
+    }
+};
+
+/**
+ * Reads and checks the "jobs machines" header.
+ */
+std::pair<int, int> readDimensions(const DataLines& data) {
+    if (data.empty() || data.header().size() < 2) {
+        throw std::invalid_argument("Missing instance header");
+    }
+    long jobs = data.header()[0];
+    long machines = data.header()[1];
+    if (jobs <= 0 || machines <= 0 || jobs > INT_MAX / machines) {
+        throw std::invalid_argument("Invalid number of jobs or machines");
+    }
+    return {static_cast<int>(jobs), static_cast<int>(machines)};
+}
+
+/**
+ * Creates an empty instance with room for one operation per machine per job.
+ */
+std::shared_ptr<ProblemInstance> createInstance(int jobs, int machines) {
+    auto problem = std::make_shared<ProblemInstance>();
+    problem->createJobs(jobs);
+    problem->createMachines(machines);
+    for (auto& job : problem->jobs) {
+        job->operations.reserve(machines);
+    }
+    return problem;
+}
+
+/**
+ * Appends operation k of job j after checking its machine and duration.
+ */
+void addOperation(ProblemInstance& problem, int j, int k, long machine, long time) {
+    if (machine < 0 || machine >= problem.numMachines) {
+        throw std::invalid_argument("Job " + std::to_string(j) + " operation " + std::to_string(k) +
+                                    ": machine " + std::to_string(machine) + " out of range");
+    }
+    if (time <= 0 || time > INT_MAX) {
+        throw std::invalid_argument("Job " + std::to_string(j) + " operation " + std::to_string(k) +
+                                    ": invalid processing time " + std::to_string(time));
+    }
+    int id = j * problem.numMachines + k;
+    problem.jobs[j]->operations.push_back(
+        std::make_shared<Operation>(j, static_cast<int>(machine), static_cast<int>(time), id));
+}
+
+/**
+ * Gets the first whitespace-separated word of a line.
+ */
+std::string firstWord(const std::string& text, size_t pos, size_t end) {
+    while (pos < end && isBlank(text[pos])) {
+        ++pos;
+    }
+    size_t stop = pos;
+    while (stop < end && !isBlank(text[stop])) {
+        ++stop;
+    }
+    return text.substr(pos, stop - pos);
+}
+
+} // namespace
+
+/**
+ * Parses an instance in OR-Library layout. When a name is given, the text
+ * may be a collection such as jobshop1.txt and the instance that follows
+ * the line "instance <name>" is read.
+ *
+ * Args:
+ *   text: File contents.
+ *   name: Instance to read from a collection, or empty for the first.
+ *
+ * Returns:
+ *   Parsed problem instance.
+ */
+std::shared_ptr<ProblemInstance> BenchmarkReader::parseORLibrary(const std::string& text, const std::string& name) {
+    size_t start = 0;
+    if (!name.empty()) {
+        start = std::string::npos;
+        size_t pos = 0;
+        while (pos < text.size()) {
+            size_t end = std::min(text.find('\n', pos), text.size());
+            std::string line = text.substr(pos, end - pos);
+            line.erase(std::remove(line.begin(), line.end(), '\r'), line.end());
+            size_t word = line.find_first_not_of(" \t");
+            if (word != std::string::npos && line.compare(word, 9, "instance ") == 0) {
+                size_t from = line.find_first_not_of(" \t", word + 9);
+                size_t to = line.find_last_not_of(" \t");
+                if (from != std::string::npos && line.substr(from, to - from + 1) == name) {
+                    start = end;
+                    break;
+                }
+            }
+            pos = end + 1;
+        }
+        if (start == std::string::npos) {
+            throw std::invalid_argument("Instance not found: " + name);
+        }
+    }
+
+    DataLines data(text, start);
+    auto [jobs, machines] = readDimensions(data);
+    std::vector<long> values = data.body(2 * static_cast<size_t>(jobs) * machines);
+
+    auto problem = createInstance(jobs, machines);
+    size_t index = 0;
+    for (int j = 0; j < jobs; ++j) {
+        for (int k = 0; k < machines; ++k) {
+            addOperation(*problem, j, k, values[index], values[index + 1]);
+            index += 2;
+        }
+    }
+    return problem;
+}
+
+/**
+ * Parses an instance in Taillard layout.
+ *
+ * Args:
+ *   text: File contents.
+ *
+ * Returns:
+ *   Parsed problem instance.
+ */
+std::shared_ptr<ProblemInstance> BenchmarkReader::parseTaillard(const std::string& text) {
+    DataLines data(text, 0);
+    auto [jobs, machines] = readDimensions(data);
+    size_t cells = static_cast<size_t>(jobs) * machines;
+    std::vector<long> values = data.body(2 * cells);
+
+    auto problem = createInstance(jobs, machines);
+    for (int j = 0; j < jobs; ++j) {
+        for (int k = 0; k < machines; ++k) {
+            size_t cell = static_cast<size_t>(j) * machines + k;
+            addOperation(*problem, j, k, values[cells + cell] - 1, values[cell]);
+        }
+    }
+    return problem;
+}
+
+/**
+ * Reads the seeds from the header of a published Taillard file, whose first
+ * data line is "jobs machines timeSeed machineSeed upper lower".
+ *
+ * Args:
+ *   text: File contents.
+ *   seeds: Receives the seeds.
+ *
+ * Returns:
+ *   True if the header holds seeds.
+ */
+bool BenchmarkReader::readTaillardSeeds(const std::string& text, TaillardSeeds& seeds) {
+    DataLines data(text, 0);
+    if (data.empty() || data.header().size() < 4) {
+        return false;
+    }
+    const std::vector<long>& header = data.header();
+    for (size_t i = 0; i < 4; ++i) {
+        if (header[i] <= 0 || header[i] > (i < 2 ? INT_MAX : LEHMER_MODULUS - 1)) {
+            return false;
+        }
+    }
+    seeds.jobs = static_cast<int>(header[0]);
+    seeds.machines = static_cast<int>(header[1]);
+    seeds.timeSeed = static_cast<int32_t>(header[2]);
+    seeds.machineSeed = static_cast<int32_t>(header[3]);
+    return true;
+}
+
+/**
+ * Guesses the layout of a file: Taillard if it has "Times" or "Machines"
+ * labels, OR-Library otherwise.
+ *
+ * Args:
+ *   text: File contents.
+ *
+ * Returns:
+ *   Detected format.
+ */
+BenchmarkFormat BenchmarkReader::detectFormat(const std::string& text) {
+    size_t pos = 0;
+    while (pos < text.size()) {
+        size_t end = std::min(text.find('\n', pos), text.size());
+        std::string word = firstWord(text, pos, end);
+        if (word == "Times" || word == "Machines") {
+            return BenchmarkFormat::TAILLARD;
+        }
+        pos = end + 1;
+    }
+    return BenchmarkFormat::OR_LIBRARY;
+}
+
+/**
+ * Loads an instance file. Throws std::runtime_error if it cannot be read.
+ *
+ * Args:
+ *   filename: Path to instance file.
+ *   format: Layout of the file.
+ *
+ * Returns:
+ *   Parsed problem instance.
+ */
+std::shared_ptr<ProblemInstance> BenchmarkReader::loadFile(const std::string& filename, BenchmarkFormat format) {
+    MappedFile file(filename);
+    std::string text(file.view());
+    return format == BenchmarkFormat::TAILLARD ? parseTaillard(text) : parseORLibrary(text);
+}
+
+/**
+ * Loads an instance file, detecting its layout.
+ *
+ * Args:
+ *   filename: Path to instance file.
+ *
+ * Returns:
+ *   Parsed problem instance.
+ */
+std::shared_ptr<ProblemInstance> BenchmarkReader::loadFile(const std::string& filename) {
+    MappedFile file(filename);
+    std::string text(file.view());
+    return detectFormat(text) == BenchmarkFormat::TAILLARD ? parseTaillard(text) : parseORLibrary(text);
+}
+
+/**
+ * Generates an instance from its seeds.
+ *
+ * Args:
+ *   seeds: Dimensions and seeds.
+ *
+ * Returns:
+ *   Generated problem instance.
+ */
+std::shared_ptr<ProblemInstance> TaillardGenerator::generate(const TaillardSeeds& seeds) {
+    if (seeds.jobs <= 0 || seeds.machines <= 0 || seeds.jobs > INT_MAX / seeds.machines) {
+        throw std::invalid_argument("Invalid number of jobs or machines");
+    }
+    if (seeds.timeSeed <= 0 || seeds.timeSeed >= LEHMER_MODULUS ||
+        seeds.machineSeed <= 0 || seeds.machineSeed >= LEHMER_MODULUS) {
+        throw std::invalid_argument("Taillard seeds must be in 1..2147483646");
+    }
+
+    int32_t timeSeed = seeds.timeSeed;
+    std::vector<int> durations(static_cast<size_t>(seeds.jobs) * seeds.machines);
+    for (int& duration : durations) {
+        duration = unif(timeSeed, 1, 99);
+    }
+
+    int32_t machineSeed = seeds.machineSeed;
+    auto problem = createInstance(seeds.jobs, seeds.machines);
+    std::vector<int> route(seeds.machines);
+    for (int j = 0; j < seeds.jobs; ++j) {
+        std::iota(route.begin(), route.end(), 0);
+        for (int k = 0; k < seeds.machines; ++k) {
+            std::swap(route[k], route[unif(machineSeed, k, seeds.machines - 1)]);
+        }
+        for (int k = 0; k < seeds.machines; ++k) {
+            addOperation(*problem, j, k, route[k], durations[static_cast<size_t>(j) * seeds.machines + k]);
+        }
+    }
+    return problem;
+}
+
+/**
+ * Generates a published instance by name, e.g. "ta01". Throws
+ * std::invalid_argument if its seeds are not in the built-in table.
+ *
+ * Args:
+ *   name: Instance name.
+ *
+ * Returns:
+ *   Generated problem instance.
+ */
+std::shared_ptr<ProblemInstance> TaillardGenerator::generate(const std::string& name) {
+    TaillardSeeds seeds;
+    if (!findSeeds(name, seeds)) {
+        throw std::invalid_argument("No built-in seeds for instance: " + name);
+    }
+    return generate(seeds);
+}
+
+/**
+ * Looks up the seeds of a published instance.
+ *
+ * Args:
+ *   name: Instance name.
+ *   seeds: Receives the seeds.
+ *
+ * Returns:
+ *   True if the instance is in the built-in table.
+ */
+bool TaillardGenerator::findSeeds(const std::string& name, TaillardSeeds& seeds) {
+    for (const auto& entry : publishedSeeds()) {
+        if (entry.first == name) {
+            seeds = entry.second;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Gets the names of the instances in the built-in table.
+ *
+ * Returns:
+ *   Instance names.
+ */
+std::vector<std::string> TaillardGenerator::getInstanceNames() {
+    std::vector<std::string> names;
+    for (const auto& entry : publishedSeeds()) {
+        names.push_back(entry.first);
+    }
+    return names;
+}
+
+/**
+ * Draws from the paper's uniform generator and advances the seed.
+ *
+ * Args:
+ *   seed: Generator state, in 1..2^31 - 2.
+ *   low: Smallest value.
+ *   high: Largest value.
+ *
+ * Returns:
+ *   Value in low..high.
+ */
+int TaillardGenerator::unif(int32_t& seed, int low, int high) {
+    // Schrage's method: 16807 * seed mod (2^31 - 1) without overflow
+    const int32_t a = 16807;
+    const int32_t b = 127773;
+    const int32_t c = 2836;
+    int32_t k = seed / b;
+    seed = a * (seed % b) - k * c;
+    if (seed < 0) {
+        seed += LEHMER_MODULUS;
+    }
+    double value = static_cast<double>(seed) / LEHMER_MODULUS;
+    return low + static_cast<int>(value * (high - low + 1));
+}
@@ -0,0 +1,283 @@
+#include "binary_instance.hpp"
+#include "mapped_file.hpp"
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+const char MAGIC[4] = {'J', 'S', 'P', 'B'};
+const uint32_t BYTE_ORDER_MARK = 0x01020304;
+const size_t ALIGNMENT = 64;
+const size_t ARRAY_COUNT = 5; // jobStarts, jobs, machines, durations, ids
+
+/**
+ * Fixed-size file header.
+ */
+struct FileHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint32_t headerSize;
+    int32_t numJobs;
+    int32_t numMachines;
+    int32_t numOperations;
+    uint32_t reserved;
+    uint64_t fileSize;
+    uint64_t checksum;
+    uint64_t offsets[ARRAY_COUNT];
+    unsigned char padding[40];
+};
+
+static_assert(sizeof(FileHeader) == 128, ".jsspb header must be 128 bytes");
+
+size_t alignUp(size_t value) {
+    return (value + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+}
+
+/**
+ * Byte sizes of the arrays of an instance.
+ */
+std::array<size_t, ARRAY_COUNT> arraySizes(size_t numJobs, size_t numOperations) {
+    size_t column = numOperations * sizeof(int32_t);
+    return {(numJobs + 1) * sizeof(int32_t), column, column, column, column};
+}
+
+/**
+ * Places the arrays after the header, each on an aligned offset.
+ *
+ * Returns:
+ *   Total file size.
+ */
+size_t layout(size_t numJobs, size_t numOperations, uint64_t* offsets) {
+    std::array<size_t, ARRAY_COUNT> sizes = arraySizes(numJobs, numOperations);
+    size_t offset = sizeof(FileHeader);
+    for (size_t i = 0; i < ARRAY_COUNT; ++i) {
+        offsets[i] = offset;
+        offset = alignUp(offset + sizes[i]);
+    }
+    return offset;
+}
+
+/**
+ * Word-wise FNV-1a. The hashed regions are multiples of the alignment, so
+ * only whole words are ever fed to it.
+ */
+class WordHash {
+public:
+    void update(const void* data, size_t size) {
+        const unsigned char* p = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+            uint64_t word;
+            std::memcpy(&word, p + i, sizeof(word));
+            value = (value ^ word) * 1099511628211ULL;
+        }
+    }
+
+    uint64_t value = 14695981039346656037ULL;
+};
+
+std::runtime_error invalidFile(const std::string& filename, const std::string& reason) {
+    return std::runtime_error("Invalid .jsspb file " + filename + ": " + reason);
+}
+
+/**
+ * Checks that the arrays describe a well-formed flat instance.
+ */
+void verifyArrays(const std::string& filename, const FileHeader& header, const int32_t* jobStarts,
+                  const int32_t* jobs, const int32_t* machines, const int32_t* durations, const int32_t* ids) {
+    if (jobStarts[0] != 0 || jobStarts[header.numJobs] != header.numOperations) {
+        throw invalidFile(filename, "job offsets do not cover the operations");
+    }
+    for (int j = 0; j < header.numJobs; ++j) {
+        if (jobStarts[j + 1] < jobStarts[j]) {
+            throw invalidFile(filename, "job offsets are not ascending");
+        }
+        for (int op = jobStarts[j]; op < jobStarts[j + 1]; ++op) {
+            if (jobs[op] != j || machines[op] < 0 || machines[op] >= header.numMachines || durations[op] < 0 ||
+                (op > jobStarts[j] && ids[op] <= ids[op - 1])) {
+                throw invalidFile(filename, "operation " + std::to_string(op) + " is out of range");
+            }
+        }
+    }
+}
+
+} // namespace
+
+/**
+ * Writes a flat instance as .jsspb. Throws std::runtime_error if the file
+ * cannot be written.
+ *
+ * Args:
+ *   instance: Instance to write.
+ *   filename: Output file path.
+ */
+void BinaryInstance::write(const FlatInstance& instance, const std::string& filename) {
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        throw std::runtime_error("Could not create file: " + filename);
+    }
+    write(instance, file);
+    file.close();
+    if (!file) {
+        throw std::runtime_error("Could not write file: " + filename);
+    }
+}
+
+/**
+ * Writes a flat instance in .jsspb layout to a stream. The caller checks
+ * the stream state.
+ *
+ * Args:
+ *   instance: Instance to write.
+ *   out: Output stream.
+ *
+ * Returns:
+ *   Number of bytes written, a multiple of 64.
+ */
+size_t BinaryInstance::write(const FlatInstance& instance, std::ostream& out) {
+    FileHeader header = {};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.byteOrder = BYTE_ORDER_MARK;
+    header.headerSize = sizeof(FileHeader);
+    header.numJobs = instance.getNumJobs();
+    header.numMachines = instance.getNumMachines();
+    header.numOperations = instance.getNumOperations();
+    header.fileSize = layout(header.numJobs, header.numOperations, header.offsets);
+
+    std::array<const int32_t*, ARRAY_COUNT> arrays = {
+        instance.jobStarts(), instance.operationJobs(), instance.machines(),
+        instance.durations(), instance.operationIds()};
+    std::array<size_t, ARRAY_COUNT> sizes = arraySizes(header.numJobs, header.numOperations);
+    const int32_t emptyStarts[1] = {0};
+    if (!arrays[0]) {
+        arrays[0] = emptyStarts; // default-constructed instance
+    }
+    const char zeros[ALIGNMENT] = {};
+
+    WordHash hash;
+    for (size_t i = 0; i < ARRAY_COUNT; ++i) {
+        size_t end = i + 1 < ARRAY_COUNT ? header.offsets[i + 1] : header.fileSize;
+        // Hash whole words: the array's last partial word is completed by its padding
+        size_t whole = sizes[i] / sizeof(uint64_t) * sizeof(uint64_t);
+        hash.update(arrays[i], whole);
+        unsigned char tail[ALIGNMENT] = {};
+        if (sizes[i] > whole) {
+            std::memcpy(tail, reinterpret_cast<const char*>(arrays[i]) + whole, sizes[i] - whole);
+        }
+        hash.update(tail, end - header.offsets[i] - whole);
+    }
+    header.checksum = hash.value;
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (size_t i = 0; i < ARRAY_COUNT; ++i) {
+        size_t end = i + 1 < ARRAY_COUNT ? header.offsets[i + 1] : header.fileSize;
+        out.write(reinterpret_cast<const char*>(arrays[i]), static_cast<std::streamsize>(sizes[i]));
+        out.write(zeros, static_cast<std::streamsize>(end - header.offsets[i] - sizes[i]));
+    }
+    return header.fileSize;
+}
+
+/**
+ * Writes a problem instance as .jsspb, in the operation order used by
+ * FlatInstance::fromProblem.
+ *
+ * Args:
+ *   problem: Instance to write.
+ *   filename: Output file path.
+ */
+void BinaryInstance::write(const ProblemInstance& problem, const std::string& filename) {
+    write(FlatInstance::fromProblem(problem), filename);
+}
+
+/**
+ * Maps a .jsspb file and returns a flat instance that reads the mapping in
+ * place. Throws std::runtime_error if the file cannot be mapped or is not a
+ * valid .jsspb file.
+ *
+ * Args:
+ *   filename: Path to .jsspb file.
+ *   verify: Also check the checksum and that every index is in range.
+ *
+ * Returns:
+ *   Flat instance backed by the file.
+ */
+FlatInstance BinaryInstance::load(const std::string& filename, bool verify) {
+    auto file = std::make_shared<MappedFile>(filename);
+    return fromBuffer(file->data(), file->size(), file, verify, filename);
+}
+
+/**
+ * Returns a flat instance that reads a .jsspb image in place. Throws
+ * std::runtime_error if the image is not valid.
+ *
+ * Args:
+ *   data: Image bytes, at least 4-byte aligned.
+ *   size: Image size in bytes.
+ *   owner: Keeps the bytes alive.
+ *   verify: Also check the checksum and that every index is in range.
+ *   name: Source named in error messages.
+ *
+ * Returns:
+ *   Flat instance viewing the image.
+ */
+FlatInstance BinaryInstance::fromBuffer(const char* data, size_t size, std::shared_ptr<const void> owner,
+                                        bool verify, const std::string& name) {
+    if (size < sizeof(FileHeader) || std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0) {
+        throw invalidFile(name, "missing header");
+    }
+
+    FileHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (header.byteOrder != BYTE_ORDER_MARK) {
+        throw invalidFile(name, "written with a different byte order");
+    }
+    if (header.version != VERSION || header.headerSize != sizeof(FileHeader)) {
+        throw invalidFile(name, "unsupported version " + std::to_string(header.version));
+    }
+    if (header.numJobs < 0 || header.numMachines < 0 || header.numOperations < 0) {
+        throw invalidFile(name, "negative counts");
+    }
+    uint64_t expected[ARRAY_COUNT];
+    size_t expectedSize = layout(header.numJobs, header.numOperations, expected);
+    if (header.fileSize != expectedSize || std::memcmp(expected, header.offsets, sizeof(expected)) != 0) {
+        throw invalidFile(name, "header does not match its counts");
+    }
+    if (size != expectedSize) {
+        throw invalidFile(name, "truncated");
+    }
+
+    // Mappings are page-aligned and every array offset is 64-byte aligned
+    auto array = [&](size_t i) { return reinterpret_cast<const int32_t*>(data + header.offsets[i]); };
+    if (verify) {
+        WordHash hash;
+        hash.update(data + sizeof(FileHeader), size - sizeof(FileHeader));
+        if (hash.value != header.checksum) {
+            throw invalidFile(name, "checksum mismatch");
+        }
+        verifyArrays(name, header, array(0), array(1), array(2), array(3), array(4));
+    }
+
+    return FlatInstance::fromArrays(header.numJobs, header.numMachines, header.numOperations,
+                                    array(0), array(1), array(2), array(3), array(4), std::move(owner));
+}
+
+/**
+ * Checks whether a file starts with the .jsspb magic.
+ *
+ * Args:
+ *   filename: Path to file.
+ *
+ * Returns:
+ *   True for .jsspb files.
+ */
+bool BinaryInstance::isBinary(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    char magic[sizeof(MAGIC)] = {};
+    return file.read(magic, sizeof(magic)) && std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0;
+}
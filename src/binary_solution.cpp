@@ -0,0 +1,644 @@
+#include "binary_solution.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace {
+
+const char MAGIC[4] = {'J', 'S', 'S', 'L'};
+
+/**
+ * Fixed-size file header.
+ */
+struct SolutionHeader {
+    char magic[4];
+    uint32_t version;
+    int32_t numJobs;
+    int32_t numMachines;
+    int32_t makespan;
+    int32_t totalCompletionTime;
+    double avgFlowTime;
+    uint64_t bodySize;
+    uint64_t directoryOffset;
+    uint64_t checksum;
+    uint64_t reserved;
+};
+
+/**
+ * Directory entry of one machine chunk.
+ */
+struct ChunkEntry {
+    uint64_t offset;
+    uint32_t count;
+    uint32_t bytes;
+};
+
+static_assert(sizeof(SolutionHeader) == BinarySolution::HEADER_SIZE, "Binary solution header must be 64 bytes");
+static_assert(sizeof(ChunkEntry) == 16, "Directory entries must be 16 bytes");
+
+/**
+ * FNV-1a hash of a byte range.
+ */
+uint64_t checksum(const char* data, size_t size) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ static_cast<unsigned char>(data[i])) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+/**
+ * Appends LEB128 varints to a buffer.
+ */
+class VarintWriter {
+public:
+    explicit VarintWriter(std::string& out) : out(out) {}
+
+    void put(uint64_t value) {
+        while (value >= 0x80) {
+            out.push_back(static_cast<char>((value & 0x7f) | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<char>(value));
+    }
+
+    void putSigned(int64_t value) {
+        put((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+    }
+
+    /**
+     * Appends a value that must not be negative.
+     */
+    void putCount(long value, const char* what) {
+        if (value < 0) {
+            throw std::runtime_error(std::string("Cannot encode negative ") + what);
+        }
+        put(static_cast<uint64_t>(value));
+    }
+
+private:
+    std::string& out;
+};
+
+/**
+ * Reads LEB128 varints from a byte range.
+ */
+class VarintReader {
+public:
+    VarintReader(const char* begin, const char* end)
+        : p(reinterpret_cast<const unsigned char*>(begin)), end(reinterpret_cast<const unsigned char*>(end)) {}
+
+    uint64_t get() {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (p == end) {
+                throw std::runtime_error("Corrupt binary solution: truncated varint");
+            }
+            unsigned char byte = *p++;
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if (!(byte & 0x80)) {
+                return value;
+            }
+        }
+        throw std::runtime_error("Corrupt binary solution: varint too long");
+    }
+
+    int64_t getSigned() {
+        uint64_t value = get();
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    /**
+     * Reads a value that must fit in a non-negative int.
+     */
+    int getInt() {
+        uint64_t value = get();
+        if (value > static_cast<uint64_t>(std::numeric_limits<int>::max())) {
+            throw std::runtime_error("Corrupt binary solution: value out of range");
+        }
+        return static_cast<int>(value);
+    }
+
+    /**
+     * Reads a signed value and adds it to a base, checking the int range.
+     */
+    int getOffset(int64_t base) {
+        int64_t value = base + getSigned();
+        if (value < std::numeric_limits<int>::min() || value > std::numeric_limits<int>::max()) {
+            throw std::runtime_error("Corrupt binary solution: value out of range");
+        }
+        return static_cast<int>(value);
+    }
+
+    size_t remaining() const { return static_cast<size_t>(end - p); }
+
+private:
+    const unsigned char* p;
+    const unsigned char* end;
+};
+
+/**
+ * Maps (job, operationId) to the operation's index in its job.
+ */
+class OperationIndex {
+public:
+    explicit OperationIndex(const ProblemInstance& problem) : byJob(problem.jobs.size()) {
+        for (size_t j = 0; j < problem.jobs.size(); ++j) {
+            const auto& operations = problem.jobs[j]->operations;
+            auto& ids = byJob[j];
+            ids.reserve(operations.size());
+            for (size_t k = 0; k < operations.size(); ++k) {
+                ids.emplace_back(operations[k]->operationId, static_cast<int>(k));
+            }
+            if (!std::is_sorted(ids.begin(), ids.end())) {
+                std::sort(ids.begin(), ids.end());
+            }
+        }
+    }
+
+    int find(int jobId, int operationId) const {
+        if (jobId < 0 || static_cast<size_t>(jobId) >= byJob.size()) {
+            return -1;
+        }
+        const auto& ids = byJob[jobId];
+        auto it = std::lower_bound(ids.begin(), ids.end(), std::make_pair(operationId, std::numeric_limits<int>::min()));
+        return it != ids.end() && it->first == operationId ? it->second : -1;
+    }
+
+private:
+    std::vector<std::vector<std::pair<int, int>>> byJob; // (operationId, index), sorted
+};
+
+std::runtime_error corrupt(const std::string& reason) {
+    return std::runtime_error("Corrupt binary solution: " + reason);
+}
+
+} // namespace
+
+/**
+ * Encodes a schedule result.
+ *
+ * Args:
+ *   result: Schedule result to encode.
+ *
+ * Returns:
+ *   Encoded bytes.
+ */
+std::string BinarySolution::encode(const ScheduleResult& result) {
+    const ProblemInstance& problem = result.problem;
+    std::string out(HEADER_SIZE, '\0');
+    out.reserve(HEADER_SIZE + 8 * static_cast<size_t>(problem.getTotalOperations()) + 16 * problem.machines.size());
+    VarintWriter writer(out);
+
+    // Jobs, with the first global index of each job for the extras section
+    std::vector<size_t> jobOffset(problem.jobs.size() + 1, 0);
+    int64_t previousId = -1;
+    for (size_t j = 0; j < problem.jobs.size(); ++j) {
+        const auto& operations = problem.jobs[j]->operations;
+        jobOffset[j + 1] = jobOffset[j] + operations.size();
+        writer.put(operations.size());
+        for (const auto& operation : operations) {
+            writer.putCount(operation->machineId, "machine ID");
+            writer.putCount(operation->processingTime, "processing time");
+            writer.putSigned(operation->operationId - previousId - 1);
+            previousId = operation->operationId;
+        }
+    }
+
+    // Machine chunks
+    OperationIndex index(problem);
+    std::vector<char> placed(jobOffset.back(), 0);
+    std::vector<ChunkEntry> directory(problem.machines.size());
+    for (size_t m = 0; m < problem.machines.size(); ++m) {
+        const Machine& machine = *problem.machines[m];
+        size_t start = out.size();
+        writer.putSigned(machine.availableTime);
+        writer.put(machine.scheduledOperations.size());
+        int64_t previousEnd = 0;
+        for (const auto& operation : machine.scheduledOperations) {
+            int k = index.find(operation->jobId, operation->operationId);
+            if (k < 0) {
+                throw std::runtime_error("Machine schedule refers to an unknown operation");
+            }
+            const Operation& stored = *problem.jobs[operation->jobId]->operations[k];
+            writer.put(static_cast<uint64_t>(operation->jobId));
+            writer.put(static_cast<uint64_t>(k));
+            writer.putSigned(operation->startTime - previousEnd);
+            writer.putSigned(static_cast<int64_t>(operation->endTime) - operation->startTime - stored.processingTime);
+            previousEnd = operation->endTime;
+            placed[jobOffset[operation->jobId] + k] = 1;
+        }
+        directory[m].offset = start;
+        directory[m].count = static_cast<uint32_t>(machine.scheduledOperations.size());
+        directory[m].bytes = static_cast<uint32_t>(out.size() - start);
+    }
+
+    // Times of operations that are not on any machine
+    std::vector<std::pair<size_t, const Operation*>> extras;
+    for (size_t j = 0; j < problem.jobs.size(); ++j) {
+        const auto& operations = problem.jobs[j]->operations;
+        for (size_t k = 0; k < operations.size(); ++k) {
+            if (!placed[jobOffset[j] + k] && (operations[k]->startTime != 0 || operations[k]->endTime != 0)) {
+                extras.emplace_back(jobOffset[j] + k, operations[k].get());
+            }
+        }
+    }
+    writer.put(extras.size());
+    for (const auto& extra : extras) {
+        writer.put(extra.first);
+        writer.putSigned(extra.second->startTime);
+        writer.putSigned(static_cast<int64_t>(extra.second->endTime) - extra.second->startTime);
+    }
+
+    SolutionHeader header = {};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.numJobs = static_cast<int32_t>(problem.jobs.size());
+    header.numMachines = static_cast<int32_t>(problem.machines.size());
+    header.makespan = result.makespan;
+    header.totalCompletionTime = result.totalCompletionTime;
+    header.avgFlowTime = result.avgFlowTime;
+    header.directoryOffset = out.size();
+    out.append(reinterpret_cast<const char*>(directory.data()), directory.size() * sizeof(ChunkEntry));
+    header.bodySize = out.size() - HEADER_SIZE;
+    header.checksum = checksum(out.data() + HEADER_SIZE, header.bodySize);
+    std::memcpy(&out[0], &header, sizeof(header));
+    return out;
+}
+
+/**
+ * Decodes a schedule result.
+ *
+ * Args:
+ *   data: Encoded bytes.
+ *   size: Number of bytes.
+ *
+ * Returns:
+ *   Decoded schedule result.
+ */
+std::shared_ptr<ScheduleResult> BinarySolution::decode(const char* data, size_t size) {
+    if (!hasMagic(data, size) || size < HEADER_SIZE) {
+        throw std::runtime_error("Not a binary solution");
+    }
+    SolutionHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (header.version != VERSION) {
+        throw std::runtime_error("Unsupported binary solution version " + std::to_string(header.version));
+    }
+    if (header.numJobs < 0 || header.numMachines < 0 || header.bodySize != size - HEADER_SIZE ||
+        header.directoryOffset < HEADER_SIZE || header.directoryOffset > size ||
+        size - header.directoryOffset != static_cast<uint64_t>(header.numMachines) * sizeof(ChunkEntry)) {
+        throw corrupt("header does not match the file size");
+    }
+    if (checksum(data + HEADER_SIZE, header.bodySize) != header.checksum) {
+        throw corrupt("checksum mismatch");
+    }
+
+    auto result = std::make_shared<ScheduleResult>();
+    ProblemInstance& problem = result->problem;
+    problem.createJobs(header.numJobs);
+    problem.createMachines(header.numMachines);
+    result->makespan = header.makespan;
+    result->totalCompletionTime = header.totalCompletionTime;
+    result->avgFlowTime = header.avgFlowTime;
+
+    // Jobs
+    VarintReader reader(data + HEADER_SIZE, data + header.directoryOffset);
+    std::vector<Operation*> byGlobalIndex;
+    int64_t previousId = -1;
+    for (int j = 0; j < header.numJobs; ++j) {
+        int count = reader.getInt();
+        if (static_cast<size_t>(count) > reader.remaining()) {
+            throw corrupt("operation count out of range");
+        }
+        auto& operations = problem.jobs[j]->operations;
+        operations.reserve(count);
+        for (int k = 0; k < count; ++k) {
+            int machine = reader.getInt();
+            int processingTime = reader.getInt();
+            int operationId = reader.getOffset(previousId + 1);
+            previousId = operationId;
+            operations.push_back(std::make_shared<Operation>(j, machine, processingTime, operationId));
+            byGlobalIndex.push_back(operations.back().get());
+        }
+    }
+
+    // Machine chunks, located through the directory; they follow each other
+    const char* directory = data + header.directoryOffset;
+    uint64_t chunkEnd = header.directoryOffset - reader.remaining();
+    for (int m = 0; m < header.numMachines; ++m) {
+        ChunkEntry entry;
+        std::memcpy(&entry, directory + m * sizeof(ChunkEntry), sizeof(entry));
+        if (entry.offset != chunkEnd || entry.offset + entry.bytes > header.directoryOffset) {
+            throw corrupt("machine chunk out of range");
+        }
+        chunkEnd = entry.offset + entry.bytes;
+        VarintReader chunk(data + entry.offset, data + entry.offset + entry.bytes);
+        Machine& machine = *problem.machines[m];
+        machine.availableTime = chunk.getOffset(0);
+        if (chunk.get() != entry.count || entry.count > chunk.remaining()) {
+            throw corrupt("machine chunk does not match the directory");
+        }
+        machine.scheduledOperations.reserve(entry.count);
+        int64_t previousEnd = 0;
+        for (uint32_t i = 0; i < entry.count; ++i) {
+            int j = chunk.getInt();
+            int k = chunk.getInt();
+            if (j >= header.numJobs || static_cast<size_t>(k) >= problem.jobs[j]->operations.size()) {
+                throw corrupt("machine schedule refers to an unknown operation");
+            }
+            const auto& operation = problem.jobs[j]->operations[k];
+            int start = chunk.getOffset(previousEnd);
+            int end = chunk.getOffset(static_cast<int64_t>(start) + operation->processingTime);
+            operation->setScheduled(start, end);
+            machine.scheduledOperations.push_back(operation);
+            previousEnd = end;
+        }
+    }
+
+    // Extras follow the last machine chunk
+    VarintReader extras(data + chunkEnd, data + header.directoryOffset);
+    uint64_t count = extras.get();
+    for (uint64_t i = 0; i < count; ++i) {
+        uint64_t global = extras.get();
+        if (global >= byGlobalIndex.size()) {
+            throw corrupt("extra times refer to an unknown operation");
+        }
+        int start = extras.getOffset(0);
+        int end = extras.getOffset(start);
+        byGlobalIndex[global]->setScheduled(start, end);
+    }
+    return result;
+}
+
+/**
+ * Checks whether a buffer starts with the binary solution magic.
+ *
+ * Args:
+ *   data: Buffer.
+ *   size: Number of bytes.
+ *
+ * Returns:
+ *   True for binary solutions.
+ */
+bool BinarySolution::hasMagic(const char* data, size_t size) {
+    return size >= sizeof(MAGIC) && std::memcmp(data, MAGIC, sizeof(MAGIC)) == 0;
+}
+
+/**
+ * Checks whether a file starts with the binary solution magic.
+ *
+ * Args:
+ *   filename: File path.
+ *
+ * Returns:
+ *   True for binary solutions.
+ */
+bool BinarySolution::isBinary(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    char magic[sizeof(MAGIC)] = {};
+    return file.read(magic, sizeof(magic)) && hasMagic(magic, sizeof(magic));
+}
+
+/**
+ * Opens a binary solution file.
+ *
+ * Args:
+ *   filename: Path to the .jsol file.
+ *   verify: Also check the checksum, which reads the whole file.
+ */
+BinarySolutionView::BinarySolutionView(const std::string& filename, bool verify)
+    : file(filename, MappedFile::Access::RANDOM), numEntries(0), jobsLoaded(false) {
+    const char* data = file.data();
+    size_t size = file.size();
+    if (!BinarySolution::hasMagic(data, size) || size < BinarySolution::HEADER_SIZE) {
+        throw std::runtime_error("Not a binary solution: " + filename);
+    }
+    SolutionHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (header.version != BinarySolution::VERSION) {
+        throw std::runtime_error("Unsupported binary solution version " + std::to_string(header.version));
+    }
+    if (header.numJobs < 0 || header.numMachines < 0 || header.bodySize != size - BinarySolution::HEADER_SIZE ||
+        header.directoryOffset < BinarySolution::HEADER_SIZE || header.directoryOffset > size ||
+        size - header.directoryOffset != static_cast<uint64_t>(header.numMachines) * sizeof(ChunkEntry)) {
+        throw corrupt("header does not match the file size");
+    }
+    if (verify && checksum(data + BinarySolution::HEADER_SIZE, header.bodySize) != header.checksum) {
+        throw corrupt("checksum mismatch");
+    }
+    numJobs = header.numJobs;
+    makespan = header.makespan;
+    totalCompletionTime = header.totalCompletionTime;
+    avgFlowTime = header.avgFlowTime;
+    directoryOffset = header.directoryOffset;
+
+    // The chunks follow each other after the job section
+    chunks.resize(header.numMachines);
+    for (int m = 0; m < header.numMachines; ++m) {
+        ChunkEntry entry;
+        std::memcpy(&entry, data + header.directoryOffset + m * sizeof(ChunkEntry), sizeof(entry));
+        uint64_t expected = m == 0 ? entry.offset : chunks[m - 1].offset + chunks[m - 1].bytes;
+        if (entry.offset < BinarySolution::HEADER_SIZE || entry.offset != expected ||
+            entry.offset + entry.bytes > header.directoryOffset) {
+            throw corrupt("machine chunk out of range");
+        }
+        chunks[m] = {entry.offset, entry.count, entry.bytes};
+        numEntries += entry.count;
+    }
+    blocks.resize(chunks.size());
+    indexed.assign(chunks.size(), false);
+    sorted.assign(chunks.size(), true);
+}
+
+/**
+ * Gets the number of entries of one machine.
+ *
+ * Args:
+ *   machine: Machine index.
+ *
+ * Returns:
+ *   Entry count.
+ */
+size_t BinarySolutionView::getMachineSize(int machine) const {
+    return machine >= 0 && static_cast<size_t>(machine) < chunks.size() ? chunks[machine].count : 0;
+}
+
+/**
+ * Calls a function for each operation of a machine that overlaps the time
+ * window [from, to), in machine schedule order.
+ *
+ * Args:
+ *   machine: Machine index.
+ *   from: Window start.
+ *   to: Window end.
+ *   visitor: Called with each overlapping operation.
+ */
+void BinarySolutionView::visit(int machine, int from, int to, const std::function<void(const Operation&)>& visitor) {
+    if (machine < 0 || static_cast<size_t>(machine) >= chunks.size() || from >= to) {
+        return;
+    }
+    if (!indexed[machine]) {
+        indexMachine(machine);
+    }
+
+    // Blocks whose entries all end by the window start are skipped
+    const std::vector<Block>& index = blocks[machine];
+    auto first = std::upper_bound(index.begin(), index.end(), static_cast<int64_t>(from),
+                                  [](int64_t time, const Block& block) { return time < block.maxEnd; });
+    if (first == index.end()) {
+        return;
+    }
+    // A zero-length operation at the window start ends exactly at from
+    while (first != index.begin() && (first - 1)->maxEnd == from) {
+        --first;
+    }
+
+    const Chunk& chunk = chunks[machine];
+    const char* data = file.data();
+    VarintReader reader(data + first->offset, data + chunk.offset + chunk.bytes);
+    int64_t previousEnd = first->previousEnd;
+    size_t remaining = chunk.count - static_cast<size_t>(first - index.begin()) * BLOCK_SIZE;
+    for (size_t i = 0; i < remaining; ++i) {
+        int j = reader.getInt();
+        int k = reader.getInt();
+        if (j >= numJobs || static_cast<size_t>(k) >= jobStart[j + 1] - jobStart[j]) {
+            throw corrupt("machine schedule refers to an unknown operation");
+        }
+        size_t global = jobStart[j] + k;
+        int start = reader.getOffset(previousEnd);
+        int end = reader.getOffset(static_cast<int64_t>(start) + durations[global]);
+        previousEnd = end;
+        if (sorted[machine] && start >= to) {
+            break;
+        }
+        if (start < to && (end > from || (end == start && start >= from))) {
+            Operation operation(j, machine, durations[global],
+                                operationIds.empty() ? static_cast<int>(global) : operationIds[global]);
+            operation.setScheduled(start, end);
+            visitor(operation);
+        }
+    }
+}
+
+/**
+ * Collects the operations of a machine that overlap the time window
+ * [from, to), as visit() finds them.
+ *
+ * Args:
+ *   machine: Machine index.
+ *   from: Window start.
+ *   to: Window end.
+ *
+ * Returns:
+ *   Overlapping operations in machine schedule order.
+ */
+std::vector<Operation> BinarySolutionView::query(int machine, int from, int to) {
+    std::vector<Operation> operations;
+    visit(machine, from, to, [&](const Operation& operation) { operations.push_back(operation); });
+    return operations;
+}
+
+/**
+ * Gets the memory held by the lazily built tables.
+ *
+ * Returns:
+ *   Size in bytes.
+ */
+size_t BinarySolutionView::getIndexBytes() const {
+    size_t bytes = chunks.capacity() * sizeof(Chunk) + jobStart.capacity() * sizeof(size_t) +
+                   durations.capacity() * sizeof(int) + operationIds.capacity() * sizeof(int);
+    for (const auto& index : blocks) {
+        bytes += index.capacity() * sizeof(Block);
+    }
+    return bytes;
+}
+
+/**
+ * Scans the job section into the duration and id tables.
+ */
+void BinarySolutionView::loadJobs() {
+    const char* data = file.data();
+    VarintReader reader(data + BinarySolution::HEADER_SIZE, data + directoryOffset);
+    jobStart.assign(1, 0);
+    jobStart.reserve(numJobs + 1);
+    durations.reserve(numEntries);
+    std::vector<int> ids;
+    bool consecutive = true;
+    int64_t previousId = -1;
+    for (int j = 0; j < numJobs; ++j) {
+        int count = reader.getInt();
+        if (static_cast<size_t>(count) > reader.remaining()) {
+            throw corrupt("operation count out of range");
+        }
+        for (int k = 0; k < count; ++k) {
+            reader.getInt(); // machine
+            int processingTime = reader.getInt();
+            int operationId = reader.getOffset(previousId + 1);
+            if (consecutive && operationId != static_cast<int64_t>(durations.size())) {
+                // Ids are not the global index after all; keep them from here on
+                consecutive = false;
+                ids.resize(durations.size());
+                for (size_t i = 0; i < ids.size(); ++i) {
+                    ids[i] = static_cast<int>(i);
+                }
+            }
+            if (!consecutive) {
+                ids.push_back(operationId);
+            }
+            previousId = operationId;
+            durations.push_back(processingTime);
+        }
+        jobStart.push_back(durations.size());
+    }
+    operationIds.swap(ids);
+    jobsLoaded = true;
+}
+
+/**
+ * Builds the time index of a machine.
+ */
+void BinarySolutionView::indexMachine(int machine) {
+    if (!jobsLoaded) {
+        loadJobs();
+    }
+    const Chunk& chunk = chunks[machine];
+    const char* data = file.data();
+    VarintReader reader(data + chunk.offset, data + chunk.offset + chunk.bytes);
+    reader.getOffset(0); // available time
+    if (reader.get() != chunk.count || chunk.count > reader.remaining()) {
+        throw corrupt("machine chunk does not match the directory");
+    }
+
+    std::vector<Block>& index = blocks[machine];
+    index.clear();
+    index.reserve((chunk.count + BLOCK_SIZE - 1) / BLOCK_SIZE);
+    const char* end = data + chunk.offset + chunk.bytes;
+    int64_t previousEnd = 0;
+    int64_t previousStart = std::numeric_limits<int64_t>::min();
+    int64_t maxEnd = std::numeric_limits<int64_t>::min();
+    bool ordered = true;
+    for (uint32_t i = 0; i < chunk.count; ++i) {
+        if (i % BLOCK_SIZE == 0) {
+            index.push_back({static_cast<uint64_t>(end - data) - reader.remaining(), previousEnd, maxEnd});
+        }
+        int j = reader.getInt();
+        int k = reader.getInt();
+        if (j >= numJobs || static_cast<size_t>(k) >= jobStart[j + 1] - jobStart[j]) {
+            throw corrupt("machine schedule refers to an unknown operation");
+        }
+        int start = reader.getOffset(previousEnd);
+        int finish = reader.getOffset(static_cast<int64_t>(start) + durations[jobStart[j] + k]);
+        ordered = ordered && start >= previousStart;
+        previousStart = start;
+        previousEnd = finish;
+        maxEnd = std::max(maxEnd, static_cast<int64_t>(finish));
+        index.back().maxEnd = maxEnd;
+    }
+    sorted[machine] = ordered;
+    indexed[machine] = true;
+}
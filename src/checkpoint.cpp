@@ -0,0 +1,434 @@
+#include "checkpoint.hpp"
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace {
+
+const char MAGIC[4] = {'J', 'S', 'C', 'K'};
+const uint32_t VERSION = 2; // 2 adds the config fingerprint
+const size_t FILE_HEADER_SIZE = 8;
+const size_t RECORD_HEADER_SIZE = 16; // type, length, checksum
+
+enum RecordType : uint32_t {
+    RECORD_CURRENT = 1,
+    RECORD_BEST = 2,
+    RECORD_ELITES = 3,
+    RECORD_STATE = 4 // commits the sections before it
+};
+
+/**
+ * FNV-1a hash of a byte range.
+ */
+uint64_t checksum(const char* data, size_t size) {
+    uint64_t hash = 1469598103934665603ULL;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+/**
+ * Little-endian encoder into a byte buffer.
+ */
+class Encoder {
+public:
+    explicit Encoder(std::string& out) : out(out) {}
+
+    void u32(uint32_t value) {
+        for (int i = 0; i < 4; ++i) out.push_back(static_cast<char>(value >> (8 * i)));
+    }
+    void u64(uint64_t value) {
+        for (int i = 0; i < 8; ++i) out.push_back(static_cast<char>(value >> (8 * i)));
+    }
+    void i32(int32_t value) { u32(static_cast<uint32_t>(value)); }
+    void i64(int64_t value) { u64(static_cast<uint64_t>(value)); }
+
+    void sequences(const MachineSequences& value) {
+        u32(static_cast<uint32_t>(value.size()));
+        for (const auto& sequence : value) {
+            u32(static_cast<uint32_t>(sequence.size()));
+            for (int op : sequence) i32(op);
+        }
+    }
+
+    /**
+     * Appends a record with its header; the payload is built by fill.
+     */
+    template <typename Fill>
+    void record(RecordType type, Fill fill) {
+        size_t start = out.size();
+        out.append(RECORD_HEADER_SIZE, '\0');
+        fill(*this);
+        size_t length = out.size() - start - RECORD_HEADER_SIZE;
+        uint64_t sum = checksum(out.data() + start + RECORD_HEADER_SIZE, length);
+        std::string header;
+        Encoder(header).u32(type);
+        Encoder(header).u32(static_cast<uint32_t>(length));
+        Encoder(header).u64(sum);
+        out.replace(start, RECORD_HEADER_SIZE, header);
+    }
+
+private:
+    std::string& out;
+};
+
+/**
+ * Bounds-checked little-endian decoder; sets ok to false on overrun.
+ */
+class Decoder {
+public:
+    Decoder(const char* data, size_t size) : data(data), size(size), offset(0), ok(true) {}
+
+    uint32_t u32() {
+        uint32_t value = 0;
+        if (!take(4)) return 0;
+        for (int i = 0; i < 4; ++i) value |= static_cast<uint32_t>(static_cast<unsigned char>(data[offset - 4 + i])) << (8 * i);
+        return value;
+    }
+    uint64_t u64() {
+        uint64_t value = 0;
+        if (!take(8)) return 0;
+        for (int i = 0; i < 8; ++i) value |= static_cast<uint64_t>(static_cast<unsigned char>(data[offset - 8 + i])) << (8 * i);
+        return value;
+    }
+    int32_t i32() { return static_cast<int32_t>(u32()); }
+    int64_t i64() { return static_cast<int64_t>(u64()); }
+
+    MachineSequences sequences() {
+        MachineSequences value(count(4));
+        for (auto& sequence : value) {
+            sequence.resize(count(4));
+            for (int& op : sequence) op = i32();
+        }
+        return value;
+    }
+
+    /**
+     * Reads an element count, rejecting counts the remaining bytes cannot hold.
+     */
+    size_t count(size_t elementSize) {
+        size_t value = u32();
+        if (value * elementSize > size - offset) {
+            ok = false;
+            return 0;
+        }
+        return value;
+    }
+
+    bool good() const { return ok && offset == size; }
+
+private:
+    const char* data;
+    size_t size;
+    size_t offset;
+    bool ok;
+
+    bool take(size_t bytes) {
+        if (!ok || size - offset < bytes) {
+            ok = false;
+            return false;
+        }
+        offset += bytes;
+        return true;
+    }
+};
+
+void encodeElites(Encoder& out, const std::vector<EliteSolution>& elites) {
+    out.u32(static_cast<uint32_t>(elites.size()));
+    for (const auto& elite : elites) {
+        out.i32(elite.makespan);
+        out.u64(elite.hash);
+        out.sequences(elite.sequences);
+    }
+}
+
+void encodeState(Encoder& out, const SearchCheckpoint& state) {
+    out.u64(state.instanceFingerprint);
+    out.u64(state.configFingerprint);
+    out.i32(state.currentMakespan);
+    out.i32(state.bestMakespan);
+    out.i32(state.nextNeighborhood);
+    out.i64(state.statistics.iterations);
+    out.i64(state.statistics.improvements);
+    out.i64(state.statistics.subproblems);
+    out.i64(state.statistics.provenOptimal);
+    out.i64(state.statistics.nodes);
+    out.u32(static_cast<uint32_t>(state.tabu.size()));
+    for (uint64_t key : state.tabu) out.u64(key);
+    out.u32(static_cast<uint32_t>(state.rngState.size()));
+    for (uint64_t word : state.rngState) out.u64(word);
+}
+
+bool decodeState(Decoder& in, SearchCheckpoint& state) {
+    state.instanceFingerprint = in.u64();
+    state.configFingerprint = in.u64();
+    state.currentMakespan = in.i32();
+    state.bestMakespan = in.i32();
+    state.nextNeighborhood = in.i32();
+    state.statistics.iterations = in.i64();
+    state.statistics.improvements = in.i64();
+    state.statistics.subproblems = in.i64();
+    state.statistics.provenOptimal = in.i64();
+    state.statistics.nodes = in.i64();
+    state.tabu.resize(in.count(8));
+    for (auto& key : state.tabu) key = in.u64();
+    state.rngState.resize(in.count(8));
+    for (auto& word : state.rngState) word = in.u64();
+    return in.good();
+}
+
+bool decodeElites(Decoder& in, std::vector<EliteSolution>& elites) {
+    elites.resize(in.count(12));
+    for (auto& elite : elites) {
+        elite.makespan = in.i32();
+        elite.hash = in.u64();
+        elite.sequences = in.sequences();
+    }
+    return in.good();
+}
+
+/**
+ * Writes a whole buffer, retrying on short writes.
+ */
+void writeAll(int fd, const std::string& buffer, const std::string& path) {
+    size_t done = 0;
+    while (done < buffer.size()) {
+        ssize_t written = ::write(fd, buffer.data() + done, buffer.size() - done);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            throw std::runtime_error("Cannot write checkpoint " + path + ": " + std::strerror(errno));
+        }
+        done += static_cast<size_t>(written);
+    }
+}
+
+std::vector<uint64_t> eliteHashes(const std::vector<EliteSolution>& elites) {
+    std::vector<uint64_t> hashes;
+    for (const auto& elite : elites) hashes.push_back(elite.hash);
+    return hashes;
+}
+
+} // namespace
+
+/**
+ * Constructor for CheckpointFile.
+ *
+ * Args:
+ *   path: Checkpoint file path.
+ */
+CheckpointFile::CheckpointFile(const std::string& path)
+    : path(path), fd(-1), fileSize(0), snapshotSize(0) {}
+
+CheckpointFile::~CheckpointFile() {
+    if (fd >= 0) {
+        close(fd);
+    }
+}
+
+/**
+ * Saves a checkpoint, appending only what changed since the last write.
+ *
+ * Args:
+ *   state: State to save.
+ *
+ * Returns:
+ *   Bytes written.
+ */
+size_t CheckpointFile::write(const SearchCheckpoint& state) {
+    // Compact once the log holds several snapshots' worth of records
+    if (fd < 0 || fileSize > 4 * snapshotSize) {
+        return writeSnapshot(state);
+    }
+
+    std::string buffer;
+    Encoder out(buffer);
+    if (state.current != lastCurrent) {
+        out.record(RECORD_CURRENT, [&state](Encoder& e) { e.sequences(state.current); });
+    }
+    if (state.best != lastBest) {
+        out.record(RECORD_BEST, [&state](Encoder& e) { e.sequences(state.best); });
+    }
+    if (eliteHashes(state.elites) != lastElites) {
+        out.record(RECORD_ELITES, [&state](Encoder& e) { encodeElites(e, state.elites); });
+    }
+    out.record(RECORD_STATE, [&state](Encoder& e) { encodeState(e, state); });
+
+    writeAll(fd, buffer, path);
+    fileSize += buffer.size();
+    remember(state);
+    return buffer.size();
+}
+
+/**
+ * Writes a full snapshot and reopens the file for appending.
+ *
+ * Args:
+ *   state: State to save.
+ *
+ * Returns:
+ *   Bytes written.
+ */
+size_t CheckpointFile::writeSnapshot(const SearchCheckpoint& state) {
+    std::string buffer(MAGIC, sizeof(MAGIC));
+    Encoder out(buffer);
+    out.u32(VERSION);
+    out.record(RECORD_CURRENT, [&state](Encoder& e) { e.sequences(state.current); });
+    out.record(RECORD_BEST, [&state](Encoder& e) { e.sequences(state.best); });
+    out.record(RECORD_ELITES, [&state](Encoder& e) { encodeElites(e, state.elites); });
+    out.record(RECORD_STATE, [&state](Encoder& e) { encodeState(e, state); });
+
+    // Replace the old file only once the new snapshot is complete
+    std::string temporary = path + ".tmp";
+    int tmp = open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (tmp < 0) {
+        throw std::runtime_error("Cannot create checkpoint " + temporary + ": " + std::strerror(errno));
+    }
+    try {
+        writeAll(tmp, buffer, temporary);
+    } catch (...) {
+        close(tmp);
+        throw;
+    }
+    close(tmp);
+    if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+        throw std::runtime_error("Cannot replace checkpoint " + path + ": " + std::strerror(errno));
+    }
+
+    if (fd >= 0) {
+        close(fd);
+    }
+    fd = open(path.c_str(), O_WRONLY | O_APPEND);
+    if (fd < 0) {
+        throw std::runtime_error("Cannot open checkpoint " + path + ": " + std::strerror(errno));
+    }
+    fileSize = buffer.size();
+    snapshotSize = buffer.size();
+    remember(state);
+    return buffer.size();
+}
+
+/**
+ * Remembers the sections of a state as written.
+ */
+void CheckpointFile::remember(const SearchCheckpoint& state) {
+    lastCurrent = state.current;
+    lastBest = state.best;
+    lastElites = eliteHashes(state.elites);
+}
+
+/**
+ * Loads the last committed checkpoint.
+ *
+ * Args:
+ *   state: Receives the checkpoint.
+ *
+ * Returns:
+ *   True if a checkpoint was found.
+ */
+bool CheckpointFile::read(SearchCheckpoint& state) const {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (data.size() < FILE_HEADER_SIZE || data.compare(0, sizeof(MAGIC), MAGIC, sizeof(MAGIC)) != 0) {
+        return false;
+    }
+    Decoder header(data.data() + sizeof(MAGIC), 4);
+    if (header.u32() != VERSION) {
+        return false;
+    }
+
+    // Replay records; sections only count once a state record commits them
+    SearchCheckpoint pending;
+    bool committed = false;
+    size_t offset = FILE_HEADER_SIZE;
+    while (data.size() - offset >= RECORD_HEADER_SIZE) {
+        Decoder recordHeader(data.data() + offset, RECORD_HEADER_SIZE);
+        uint32_t type = recordHeader.u32();
+        uint32_t length = recordHeader.u32();
+        uint64_t sum = recordHeader.u64();
+        const char* payload = data.data() + offset + RECORD_HEADER_SIZE;
+        if (length > data.size() - offset - RECORD_HEADER_SIZE || checksum(payload, length) != sum) {
+            break; // torn write
+        }
+
+        Decoder in(payload, length);
+        bool valid = false;
+        if (type == RECORD_CURRENT) {
+            pending.current = in.sequences();
+            valid = in.good();
+        } else if (type == RECORD_BEST) {
+            pending.best = in.sequences();
+            valid = in.good();
+        } else if (type == RECORD_ELITES) {
+            valid = decodeElites(in, pending.elites);
+        } else if (type == RECORD_STATE) {
+            valid = decodeState(in, pending);
+            if (valid) {
+                state = pending;
+                committed = true;
+            }
+        }
+        if (!valid) {
+            break;
+        }
+        offset += RECORD_HEADER_SIZE + length;
+    }
+    return committed;
+}
+
+/**
+ * Deletes the checkpoint file.
+ */
+void CheckpointFile::remove() {
+    if (fd >= 0) {
+        close(fd);
+        fd = -1;
+    }
+    std::remove(path.c_str());
+    fileSize = 0;
+    snapshotSize = 0;
+}
+
+/**
+ * Computes a fingerprint of an instance.
+ *
+ * Args:
+ *   instance: Flat instance.
+ *
+ * Returns:
+ *   64-bit fingerprint.
+ */
+uint64_t CheckpointFile::fingerprint(const FlatInstance& instance) {
+    std::string bytes;
+    Encoder out(bytes);
+    out.i32(instance.getNumJobs());
+    out.i32(instance.getNumMachines());
+    for (int op = 0; op < instance.getNumOperations(); ++op) {
+        out.i32(instance.job(op));
+        out.i32(instance.machine(op));
+        out.i32(instance.duration(op));
+    }
+    return checksum(bytes.data(), bytes.size());
+}
+
+/**
+ * Computes a fingerprint of a configuration.
+ *
+ * Args:
+ *   text: Configuration text.
+ *
+ * Returns:
+ *   64-bit fingerprint.
+ */
+uint64_t CheckpointFile::fingerprint(const std::string& text) {
+    return checksum(text.data(), text.size());
+}
@@ -0,0 +1,220 @@
+#include "elite_pool.hpp"
+#include "sequence_hash.hpp"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+/**
+ * Counts inversions of values with a merge sort, sorting values in place.
+ *
+ * Args:
+ *   values: Values to sort.
+ *   buffer: Scratch buffer of the same size.
+ *   lo: First index.
+ *   hi: One past the last index.
+ *
+ * Returns:
+ *   Number of pairs i < j with values[i] > values[j].
+ */
+long countInversions(std::vector<int>& values, std::vector<int>& buffer, int lo, int hi) {
+    if (hi - lo < 2) {
+        return 0;
+    }
+    int mid = lo + (hi - lo) / 2;
+    long count = countInversions(values, buffer, lo, mid) + countInversions(values, buffer, mid, hi);
+    int i = lo;
+    int j = mid;
+    int k = lo;
+    while (i < mid && j < hi) {
+        if (values[j] < values[i]) {
+            count += mid - i;
+            buffer[k++] = values[j++];
+        } else {
+            buffer[k++] = values[i++];
+        }
+    }
+    while (i < mid) buffer[k++] = values[i++];
+    while (j < hi) buffer[k++] = values[j++];
+    std::copy(buffer.begin() + lo, buffer.begin() + hi, values.begin() + lo);
+    return count;
+}
+
+} // namespace
+
+/**
+ * Constructor for ElitePool.
+ *
+ * Args:
+ *   capacity: Maximum number of schedules.
+ *   minDistance: Minimum distance to every member for non-best entries.
+ */
+ElitePool::ElitePool(int capacity, long minDistance)
+    : capacity(std::max(1, capacity)), minDistance(minDistance) {}
+
+/**
+ * Counts operation pairs ordered differently by two schedules.
+ *
+ * Args:
+ *   a: First schedule.
+ *   b: Second schedule over the same operations.
+ *
+ * Returns:
+ *   Pairwise order distance.
+ */
+long ElitePool::distance(const MachineSequences& a, const MachineSequences& b) {
+    if (a.size() != b.size()) {
+        throw std::invalid_argument("Schedules have different machine counts");
+    }
+
+    int maxOp = -1;
+    for (const auto& sequence : b) {
+        for (int op : sequence) maxOp = std::max(maxOp, op);
+    }
+    std::vector<int> positionInB(maxOp + 1, -1);
+    std::vector<int> mapped;
+    std::vector<int> buffer;
+
+    long total = 0;
+    for (size_t m = 0; m < a.size(); ++m) {
+        if (a[m].size() != b[m].size()) {
+            throw std::invalid_argument("Schedules differ in machine " + std::to_string(m));
+        }
+        for (size_t p = 0; p < b[m].size(); ++p) {
+            positionInB[b[m][p]] = static_cast<int>(p);
+        }
+        mapped.clear();
+        for (int op : a[m]) {
+            if (op < 0 || op > maxOp || positionInB[op] < 0) {
+                throw std::invalid_argument("Schedules differ in machine " + std::to_string(m));
+            }
+            mapped.push_back(positionInB[op]);
+        }
+        buffer.resize(mapped.size());
+        total += countInversions(mapped, buffer, 0, static_cast<int>(mapped.size()));
+        for (int op : b[m]) {
+            positionInB[op] = -1;
+        }
+    }
+    return total;
+}
+
+/**
+ * Offers a schedule to the pool.
+ *
+ * Args:
+ *   sequences: Flat operation indices per machine.
+ *   makespan: Makespan of the schedule.
+ *
+ * Returns:
+ *   True if the schedule was added.
+ */
+bool ElitePool::tryInsert(const MachineSequences& sequences, int makespan) {
+    uint64_t hash = SequenceHasher::hash(sequences);
+    std::lock_guard<std::mutex> lock(mutex);
+
+    bool full = static_cast<int>(solutions.size()) >= capacity;
+    if (full && makespan >= solutions.back().makespan) {
+        return false;
+    }
+    for (const auto& member : solutions) {
+        if (member.hash == hash) {
+            return false;
+        }
+    }
+
+    // Distances to every member; a new best skips the diversity test
+    bool newBest = solutions.empty() || makespan < solutions.front().makespan;
+    std::vector<long> distances;
+    distances.reserve(solutions.size());
+    for (const auto& member : solutions) {
+        long d = distance(sequences, member.sequences);
+        if (!newBest && d < minDistance) {
+            return false;
+        }
+        distances.push_back(d);
+    }
+
+    if (full) {
+        // Replace the most similar member among those the candidate beats
+        int victim = -1;
+        long closest = std::numeric_limits<long>::max();
+        for (size_t i = 0; i < solutions.size(); ++i) {
+            if (solutions[i].makespan >= makespan && distances[i] < closest) {
+                closest = distances[i];
+                victim = static_cast<int>(i);
+            }
+        }
+        solutions.erase(solutions.begin() + victim);
+    }
+
+    EliteSolution entry{sequences, makespan, hash};
+    auto at = std::upper_bound(solutions.begin(), solutions.end(), makespan,
+                               [](int value, const EliteSolution& member) { return value < member.makespan; });
+    solutions.insert(at, std::move(entry));
+    return true;
+}
+
+/**
+ * Copies the current members.
+ *
+ * Returns:
+ *   Pool members sorted by makespan.
+ */
+std::vector<EliteSolution> ElitePool::snapshot() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return solutions;
+}
+
+/**
+ * Gets the best member.
+ *
+ * Returns:
+ *   Copy of the best schedule.
+ */
+EliteSolution ElitePool::getBest() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (solutions.empty()) {
+        throw std::runtime_error("Elite pool is empty");
+    }
+    return solutions.front();
+}
+
+/**
+ * Gets the number of members.
+ *
+ * Returns:
+ *   Pool size.
+ */
+int ElitePool::size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return static_cast<int>(solutions.size());
+}
+
+/**
+ * Removes all members.
+ */
+void ElitePool::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    solutions.clear();
+}
+
+/**
+ * Replaces the members with saved ones.
+ *
+ * Args:
+ *   members: Saved members.
+ */
+void ElitePool::restore(std::vector<EliteSolution> members) {
+    for (auto& member : members) {
+        member.hash = SequenceHasher::hash(member.sequences);
+    }
+    std::stable_sort(members.begin(), members.end(),
+                     [](const EliteSolution& a, const EliteSolution& b) { return a.makespan < b.makespan; });
+    if (static_cast<int>(members.size()) > capacity) {
+        members.resize(capacity);
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    solutions = std::move(members);
+}
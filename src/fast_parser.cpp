@@ -0,0 +1,161 @@
+#include "fast_parser.hpp"
+#include "mapped_file.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+
+namespace {
+
+bool isBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+/**
+ * Splits one line into integers. Returns the number of integers, or -1 if a
+ * token is not an integer, does not fit in an int, or there are more than
+ * capacity of them.
+ */
+int tokenize(const char* begin, const char* end, int* values, int capacity) {
+    int count = 0;
+    const char* p = begin;
+    while (true) {
+        while (p < end && isBlank(*p)) {
+            ++p;
+        }
+        if (p == end) {
+            return count;
+        }
+        if (count == capacity) {
+            return -1;
+        }
+        std::from_chars_result result = std::from_chars(p, end, values[count]);
+        if (result.ec != std::errc() || (result.ptr < end && !isBlank(*result.ptr))) {
+            return -1;
+        }
+        ++count;
+        p = result.ptr;
+    }
+}
+
+/**
+ * Records a rejected line.
+ */
+void reject(ParseReport& report, size_t line, std::string message) {
+    if (report.errors.size() < FastParser::MAX_REPORTED_ERRORS) {
+        report.errors.push_back({line, std::move(message)});
+    }
+    report.skipped++;
+}
+
+/**
+ * Counts the lines of a buffer, including an unterminated last line.
+ */
+size_t countLines(const char* data, size_t size) {
+    size_t lines = 0;
+    const char* p = data;
+    const char* end = data + size;
+    while (p < end) {
+        const void* newline = std::memchr(p, '\n', static_cast<size_t>(end - p));
+        if (!newline) {
+            return lines + 1;
+        }
+        p = static_cast<const char*>(newline) + 1;
+        lines++;
+    }
+    return lines;
+}
+
+} // namespace
+
+/**
+ * Parses a .jssp file. Throws std::runtime_error if the file cannot be read,
+ * the header is invalid, or no operation is valid.
+ *
+ * Args:
+ *   filename: Path to input file.
+ *   report: Receives the accepted and rejected lines.
+ *
+ * Returns:
+ *   Parsed problem instance.
+ */
+std::shared_ptr<ProblemInstance> FastParser::parseFile(const std::string& filename, ParseReport& report) {
+    MappedFile file(filename);
+    return parseBuffer(file.data(), file.size(), report);
+}
+
+/**
+ * Parses .jssp text held in memory, with the same rules as parseFile.
+ *
+ * Args:
+ *   data: Start of the text; need not be null-terminated.
+ *   size: Text length in bytes.
+ *   report: Receives the accepted and rejected lines.
+ *
+ * Returns:
+ *   Parsed problem instance.
+ */
+std::shared_ptr<ProblemInstance> FastParser::parseBuffer(const char* data, size_t size, ParseReport& report) {
+    report = ParseReport();
+    size_t totalLines = countLines(data, size);
+
+    const char* p = data;
+    const char* end = data + size;
+    size_t line = 0;
+    int values[3];
+    int numJobs = 0;
+    int numMachines = 0;
+    std::shared_ptr<ProblemInstance> problem;
+
+    while (p < end) {
+        const char* newline = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(end - p)));
+        const char* lineEnd = newline ? newline : end;
+        line++;
+
+        int count = tokenize(p, lineEnd, values, 3);
+        p = newline ? newline + 1 : end;
+        if (count == 0) {
+            continue;
+        }
+
+        if (!problem) {
+            // The first non-blank line is the header
+            if (count != 2 || values[0] <= 0 || values[1] <= 0) {
+                throw std::runtime_error("Invalid number of jobs or machines");
+            }
+            numJobs = values[0];
+            numMachines = values[1];
+            problem = std::make_shared<ProblemInstance>();
+            problem->createJobs(numJobs);
+            problem->createMachines(numMachines);
+
+            // Every remaining line is at most one operation
+            size_t perJob = (totalLines - line) / static_cast<size_t>(numJobs) + 1;
+            for (auto& job : problem->jobs) {
+                job->operations.reserve(perJob);
+            }
+            continue;
+        }
+
+        if (count != 3) {
+            reject(report, line, "expected job_id machine_id processing_time");
+        } else if (values[0] < 0 || values[0] >= numJobs) {
+            reject(report, line, "job " + std::to_string(values[0]) + " out of range");
+        } else if (values[1] < 0 || values[1] >= numMachines) {
+            reject(report, line, "machine " + std::to_string(values[1]) + " out of range");
+        } else if (values[2] <= 0) {
+            reject(report, line, "processing time " + std::to_string(values[2]) + " is not positive");
+        } else {
+            problem->jobs[values[0]]->operations.push_back(
+                std::make_shared<Operation>(values[0], values[1], values[2], static_cast<int>(report.operations)));
+            report.operations++;
+        }
+    }
+    report.lines = line;
+
+    if (!problem || report.operations == 0) {
+        throw std::runtime_error("No valid operations found in file");
+    }
+    return problem;
+}
@@ -0,0 +1,209 @@
+#include "flat_instance.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+
+/**
+ * Arrays built by fromProblem, shared by all copies of the instance.
+ */
+struct FlatArrays {
+    std::vector<int32_t> jobStarts;
+    std::vector<int32_t> jobs;
+    std::vector<int32_t> machines;
+    std::vector<int32_t> durations;
+    std::vector<int32_t> operationIds;
+};
+
+} // namespace
+
+/**
+ * Builds the flat layout from a problem instance.
+ *
+ * Args:
+ *   problem: Problem instance to flatten.
+ *
+ * Returns:
+ *   Flat instance.
+ */
+FlatInstance FlatInstance::fromProblem(const ProblemInstance& problem) {
+    auto arrays = std::make_shared<FlatArrays>();
+    int numJobs = static_cast<int>(problem.jobs.size());
+    int numMachines = problem.numMachines;
+
+    int total = problem.getTotalOperations();
+    arrays->jobStarts.reserve(numJobs + 1);
+    arrays->jobs.reserve(total);
+    arrays->machines.reserve(total);
+    arrays->durations.reserve(total);
+    arrays->operationIds.reserve(total);
+
+    std::vector<std::shared_ptr<Operation>> ordered;
+    for (int j = 0; j < numJobs; ++j) {
+        arrays->jobStarts.push_back(static_cast<int32_t>(arrays->jobs.size()));
+
+        // Precedence within a job follows operationId, as in Solver
+        ordered = problem.jobs[j]->operations;
+        std::stable_sort(ordered.begin(), ordered.end(),
+                         [](const std::shared_ptr<Operation>& a, const std::shared_ptr<Operation>& b) {
+                             return a->operationId < b->operationId;
+                         });
+
+        for (const auto& operation : ordered) {
+            if (operation->machineId < 0) {
+                throw std::runtime_error("Operation has invalid machine ID");
+            }
+            numMachines = std::max(numMachines, operation->machineId + 1);
+            arrays->jobs.push_back(j);
+            arrays->machines.push_back(operation->machineId);
+            arrays->durations.push_back(operation->processingTime);
+            arrays->operationIds.push_back(operation->operationId);
+        }
+    }
+    arrays->jobStarts.push_back(static_cast<int32_t>(arrays->jobs.size()));
+
+    return fromArrays(numJobs, numMachines, static_cast<int>(arrays->jobs.size()),
+                      arrays->jobStarts.data(), arrays->jobs.data(), arrays->machines.data(),
+                      arrays->durations.data(), arrays->operationIds.data(), arrays);
+}
+
+/**
+ * Wraps arrays stored elsewhere without copying them.
+ *
+ * Args:
+ *   numJobs: Job count.
+ *   numMachines: Machine count.
+ *   numOperations: Operation count.
+ *   jobStarts: numJobs + 1 job start indices.
+ *   jobs: Job of each operation.
+ *   machines: Machine of each operation.
+ *   durations: Processing time of each operation.
+ *   operationIds: Original operationId of each operation.
+ *   owner: Keeps the arrays alive.
+ *
+ * Returns:
+ *   Flat instance viewing the arrays.
+ */
+FlatInstance FlatInstance::fromArrays(int numJobs, int numMachines, int numOperations,
+                                      const int32_t* jobStarts, const int32_t* jobs, const int32_t* machines,
+                                      const int32_t* durations, const int32_t* operationIds,
+                                      std::shared_ptr<const void> owner) {
+    FlatInstance flat;
+    flat.numJobs = numJobs;
+    flat.numMachines = numMachines;
+    flat.numOperations = numOperations;
+    flat.jobStartData = jobStarts;
+    flat.opJobData = jobs;
+    flat.opMachineData = machines;
+    flat.opDurationData = durations;
+    flat.opIdData = operationIds;
+    flat.storage = std::move(owner);
+    return flat;
+}
+
+/**
+ * Builds an unscheduled problem instance with the same jobs and operations.
+ *
+ * Returns:
+ *   Problem instance.
+ */
+std::shared_ptr<ProblemInstance> FlatInstance::toProblem() const {
+    auto problem = std::make_shared<ProblemInstance>();
+    problem->createJobs(numJobs);
+    problem->createMachines(numMachines);
+    for (int j = 0; j < numJobs; ++j) {
+        auto& operations = problem->jobs[j]->operations;
+        operations.reserve(jobLength(j));
+        for (int op = jobStartData[j]; op < jobStartData[j + 1]; ++op) {
+            operations.push_back(std::make_shared<Operation>(j, opMachineData[op], opDurationData[op], opIdData[op]));
+        }
+    }
+    return problem;
+}
+
+/**
+ * Finds the flat index of an operation by job and operation ID.
+ *
+ * Args:
+ *   jobId: Job ID.
+ *   operationId: Operation ID.
+ *
+ * Returns:
+ *   Flat index, or -1 if not found.
+ */
+int FlatInstance::indexOf(int jobId, int operationId) const {
+    if (jobId < 0 || jobId >= numJobs) {
+        return -1;
+    }
+    // Operations inside a job are sorted by operationId
+    const int32_t* first = opIdData + jobStartData[jobId];
+    const int32_t* last = opIdData + jobStartData[jobId + 1];
+    const int32_t* it = std::lower_bound(first, last, operationId);
+    if (it == last || *it != operationId) {
+        return -1;
+    }
+    return static_cast<int>(it - opIdData);
+}
+
+/**
+ * Builds an operation-based sequence from a scheduled problem.
+ *
+ * Args:
+ *   scheduled: Problem instance whose operations carry start times.
+ *
+ * Returns:
+ *   Job-repetition sequence of length numOperations.
+ */
+std::vector<int> FlatInstance::sequenceFromSchedule(const ProblemInstance& scheduled) const {
+    std::vector<std::pair<int, int>> byStart; // (startTime, flat index)
+    byStart.reserve(numOperations);
+    for (const auto& job : scheduled.jobs) {
+        for (const auto& operation : job->operations) {
+            int index = indexOf(job->jobId, operation->operationId);
+            if (index >= 0) {
+                byStart.emplace_back(operation->startTime, index);
+            }
+        }
+    }
+    if (static_cast<int>(byStart.size()) != numOperations) {
+        throw std::runtime_error("Scheduled problem does not match flat instance");
+    }
+
+    // Ties keep job order so predecessors (lower index) come first
+    std::sort(byStart.begin(), byStart.end());
+
+    std::vector<int> sequence;
+    sequence.reserve(numOperations);
+    for (const auto& entry : byStart) {
+        sequence.push_back(opJobData[entry.second]);
+    }
+    return sequence;
+}
+
+/**
+ * Reads the per-machine processing order of a scheduled problem.
+ *
+ * Args:
+ *   scheduled: Problem instance whose machines hold scheduled operations.
+ *
+ * Returns:
+ *   Flat operation indices per machine.
+ */
+MachineSequences FlatInstance::machineSequences(const ProblemInstance& scheduled) const {
+    MachineSequences sequences(numMachines);
+    for (const auto& machine : scheduled.machines) {
+        if (machine->machineId < 0 || machine->machineId >= numMachines) {
+            throw std::runtime_error("Scheduled problem does not match flat instance");
+        }
+        auto& sequence = sequences[machine->machineId];
+        sequence.reserve(machine->scheduledOperations.size());
+        for (const auto& operation : machine->scheduledOperations) {
+            int index = indexOf(operation->jobId, operation->operationId);
+            if (index < 0) {
+                throw std::runtime_error("Scheduled problem does not match flat instance");
+            }
+            sequence.push_back(index);
+        }
+    }
+    return sequences;
+}
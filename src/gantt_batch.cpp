@@ -0,0 +1,149 @@
+#include "gantt_batch.hpp"
+
+namespace {
+
+/**
+ * Appends a rectangle as two triangles.
+ */
+void appendRect(sf::VertexArray& vertices, const sf::FloatRect& rect, sf::Color color) {
+    sf::Vector2f topLeft(rect.left, rect.top);
+    sf::Vector2f topRight(rect.left + rect.width, rect.top);
+    sf::Vector2f bottomRight(rect.left + rect.width, rect.top + rect.height);
+    sf::Vector2f bottomLeft(rect.left, rect.top + rect.height);
+    vertices.append(sf::Vertex(topLeft, color));
+    vertices.append(sf::Vertex(topRight, color));
+    vertices.append(sf::Vertex(bottomRight, color));
+    vertices.append(sf::Vertex(topLeft, color));
+    vertices.append(sf::Vertex(bottomRight, color));
+    vertices.append(sf::Vertex(bottomLeft, color));
+}
+
+/**
+ * Copies a vertex array into a buffer of the same size.
+ *
+ * Returns:
+ *   False if the buffer could not be created.
+ */
+bool upload(const sf::VertexArray& vertices, sf::VertexBuffer& buffer) {
+    size_t count = vertices.getVertexCount();
+    if (count == 0) {
+        return true;
+    }
+    return buffer.create(count) && buffer.update(&vertices[0]);
+}
+
+} // namespace
+
+/**
+ * Constructor for GanttBatch.
+ */
+GanttBatch::GanttBatch()
+    : grid(sf::Triangles), bars(sf::Triangles), outlines(sf::Lines),
+      gridBuffer(sf::Triangles, sf::VertexBuffer::Static), barBuffer(sf::Triangles, sf::VertexBuffer::Static),
+      outlineBuffer(sf::Lines, sf::VertexBuffer::Static), dirty(false), buffered(false) {}
+
+/**
+ * Removes all geometry.
+ */
+void GanttBatch::clear() {
+    grid.clear();
+    bars.clear();
+    outlines.clear();
+    dirty = true;
+}
+
+/**
+ * Adds a filled rectangle to the grid batch.
+ *
+ * Args:
+ *   rect: Rectangle.
+ *   color: Fill color.
+ */
+void GanttBatch::addBackground(const sf::FloatRect& rect, sf::Color color) {
+    appendRect(grid, rect, color);
+    dirty = true;
+}
+
+/**
+ * Adds a one-pixel frame around a rectangle to the grid batch, outside the
+ * rectangle like an sf::Shape outline.
+ *
+ * Args:
+ *   rect: Rectangle.
+ *   color: Frame color.
+ */
+void GanttBatch::addFrame(const sf::FloatRect& rect, sf::Color color) {
+    appendRect(grid, sf::FloatRect(rect.left - 1, rect.top - 1, rect.width + 2, 1), color);
+    appendRect(grid, sf::FloatRect(rect.left - 1, rect.top + rect.height, rect.width + 2, 1), color);
+    appendRect(grid, sf::FloatRect(rect.left - 1, rect.top, 1, rect.height), color);
+    appendRect(grid, sf::FloatRect(rect.left + rect.width, rect.top, 1, rect.height), color);
+    dirty = true;
+}
+
+/**
+ * Adds an operation bar, with a one-pixel outline unless the outline color
+ * is transparent.
+ *
+ * Args:
+ *   rect: Bar rectangle.
+ *   fill: Bar color.
+ *   outline: Outline color.
+ */
+void GanttBatch::addBar(const sf::FloatRect& rect, sf::Color fill, sf::Color outline) {
+    appendRect(bars, rect, fill);
+    if (outline.a > 0) {
+        // Lines through the pixel centers just outside the bar
+        float left = rect.left - 0.5f;
+        float top = rect.top - 0.5f;
+        float right = rect.left + rect.width + 0.5f;
+        float bottom = rect.top + rect.height + 0.5f;
+        sf::Vector2f corners[4] = {{left, top}, {right, top}, {right, bottom}, {left, bottom}};
+        for (int i = 0; i < 4; ++i) {
+            outlines.append(sf::Vertex(corners[i], outline));
+            outlines.append(sf::Vertex(corners[(i + 1) % 4], outline));
+        }
+    }
+    dirty = true;
+}
+
+/**
+ * Draws the batches, uploading them to vertex buffers first if they changed
+ * and the GPU supports buffers.
+ *
+ * Args:
+ *   target: Window or render texture to draw to.
+ */
+void GanttBatch::draw(sf::RenderTarget& target) {
+    if (dirty) {
+        buffered = sf::VertexBuffer::isAvailable() && upload(grid, gridBuffer) && upload(bars, barBuffer) &&
+                   upload(outlines, outlineBuffer);
+        dirty = false;
+    }
+    drawBatch(target, grid, gridBuffer);
+    drawBatch(target, bars, barBuffer);
+    drawBatch(target, outlines, outlineBuffer);
+}
+
+/**
+ * Gets the number of vertices of all batches.
+ *
+ * Returns:
+ *   Vertex count.
+ */
+size_t GanttBatch::getVertexCount() const {
+    return grid.getVertexCount() + bars.getVertexCount() + outlines.getVertexCount();
+}
+
+/**
+ * Draws one batch, from its buffer if it was uploaded.
+ */
+void GanttBatch::drawBatch(sf::RenderTarget& target, const sf::VertexArray& vertices, sf::VertexBuffer& buffer) {
+    if (vertices.getVertexCount() == 0) {
+        return;
+    }
+    if (buffered) {
+        target.draw(buffer);
+    } else {
+        target.draw(vertices);
+    }
+}
@@ -6,7 +6,7 @@
 GanttChartMaker::GanttChartMaker()
     : marginLeft(100), marginTop(50), marginRight(50), marginBottom(50),
       rowHeight(60), timeScale(20), machineLabelWidth(80),
-      fontLoaded(false) {
+      fontLoaded(false), labels(font), chartDirty(true) {
     
     // Initialize window
     window.create(sf::VideoMode(1200, 800), "JSSP Gantt Chart", sf::Style::Close);
@@ -79,139 +79,40 @@ sf::Color GanttChartMaker::getJobColor(int jobId) {
 }
 
 /**
- * Draws the grid for the Gantt chart.
+ * Rebuilds the chart and label batches, unless they were built for this
+ * result with the current layout.
  *
  * Args:
- *   startX: Starting X position.
- *   startY: Starting Y position.
- *   maxTime: Maximum time value.
- *   numMachines: Number of machines.
+ *   result: Schedule result.
  */
-void GanttChartMaker::drawGrid(float startX, float startY, int maxTime, int numMachines) {
-    sf::RectangleShape line(sf::Vector2f(maxTime * timeScale, 1));
-    line.setFillColor(sf::Color(200, 200, 200));
-    
-    // Horizontal lines (machine separators)
-    for (int i = 0; i <= numMachines; i++) {
-        float y = startY + i * rowHeight;
-        line.setPosition(startX, y);
-        line.setSize(sf::Vector2f(maxTime * timeScale, 1));
-        window.draw(line);
+void GanttChartMaker::buildChart(std::shared_ptr<ScheduleResult> result) {
+    if (!chartDirty && !chartResult.expired() && chartResult.lock() == result) {
+        return;
     }
+    chart.clear();
+    labels.clear();
     
-    // Vertical lines (time separators)
-    sf::RectangleShape vline(sf::Vector2f(1, numMachines * rowHeight));
-    vline.setFillColor(sf::Color(200, 200, 200));
-    
-    for (int t = 0; t <= maxTime; t += 5) {
-        float x = startX + t * timeScale;
-        vline.setPosition(x, startY);
-        vline.setSize(sf::Vector2f(1, numMachines * rowHeight));
-        window.draw(vline);
-    }
-}
-
-/**
- * Draws the grid to a render texture.
- *
- * Args:
- *   target: Render texture to draw to.
- *   startX: Starting X position.
- *   startY: Starting Y position.
- *   maxTime: Maximum time.
- *   numMachines: Number of machines.
- */
-void GanttChartMaker::drawGridToTexture(sf::RenderTexture& target, float startX, float startY, int maxTime, int numMachines) {
-    sf::RectangleShape line(sf::Vector2f(maxTime * timeScale, 1));
-    line.setFillColor(sf::Color(200, 200, 200));
+    float startX = marginLeft + machineLabelWidth;
+    float startY = marginTop + 50; // Space for time axis
+    int maxTime = result->makespan;
+    int numMachines = result->problem.numMachines;
+    sf::Color gridColor(200, 200, 200);
     
     // Horizontal lines (machine separators)
     for (int i = 0; i <= numMachines; i++) {
-        float y = startY + i * rowHeight;
-        line.setPosition(startX, y);
-        line.setSize(sf::Vector2f(maxTime * timeScale, 1));
-        target.draw(line);
+        chart.addBackground(sf::FloatRect(startX, startY + i * rowHeight, maxTime * timeScale, 1), gridColor);
     }
     
-    // Vertical lines (time separators)
-    sf::RectangleShape vline(sf::Vector2f(1, numMachines * rowHeight));
-    vline.setFillColor(sf::Color(200, 200, 200));
-    
+    // Vertical lines (time separators) and axis ticks
     for (int t = 0; t <= maxTime; t += 5) {
         float x = startX + t * timeScale;
-        vline.setPosition(x, startY);
-        vline.setSize(sf::Vector2f(1, numMachines * rowHeight));
-        target.draw(vline);
+        chart.addBackground(sf::FloatRect(x, startY, 1, numMachines * rowHeight), gridColor);
+        if (fontLoaded) {
+            chart.addBackground(sf::FloatRect(x, startY - 40, 1, 10), sf::Color(0, 0, 0));
+        }
     }
-}
-
-/**
- * Draws the time axis to a render texture.
- *
- * Args:
- *   target: Render texture to draw to.
- *   startX: Starting X position.
- *   startY: Starting Y position.
- *   maxTime: Maximum time value.
- */
-void GanttChartMaker::drawTimeAxisToTexture(sf::RenderTexture& target, float startX, float startY, int maxTime) {
-    if (!fontLoaded) return;
     
-    for (int t = 0; t <= maxTime; t += 5) {
-        float x = startX + t * timeScale;
-        
-        // Draw tick
-        sf::RectangleShape tick(sf::Vector2f(1, 10));
-        tick.setFillColor(sf::Color(0, 0, 0));
-        tick.setPosition(x, startY - 10);
-        target.draw(tick);
-        
-        // Draw time label
-        sf::Text timeText;
-        timeText.setFont(font);
-        timeText.setString(std::to_string(t));
-        timeText.setCharacterSize(12);
-        timeText.setFillColor(sf::Color(0, 0, 0));
-        timeText.setPosition(x - 5, startY - 25);
-        target.draw(timeText);
-    }
-}
-
-/**
- * Draws machine labels to a render texture.
- *
- * Args:
- *   target: Render texture to draw to.
- *   startX: Starting X position.
- *   startY: Starting Y position.
- *   problem: Problem instance.
- */
-void GanttChartMaker::drawMachineLabelsToTexture(sf::RenderTexture& target, float startX, float startY, std::shared_ptr<ProblemInstance> problem) {
-    if (!fontLoaded) return;
-    
-    for (int i = 0; i < problem->numMachines; i++) {
-        float y = startY + i * rowHeight + rowHeight / 2;
-        
-        sf::Text machineText;
-        machineText.setFont(font);
-        machineText.setString("M" + std::to_string(i));
-        machineText.setCharacterSize(14);
-        machineText.setFillColor(sf::Color(0, 0, 0));
-        machineText.setPosition(startX - machineLabelWidth + 10, y - 7);
-        target.draw(machineText);
-    }
-}
-
-/**
- * Draws operations to a render texture.
- *
- * Args:
- *   target: Render texture to draw to.
- *   startX: Starting X position.
- *   startY: Starting Y position.
- *   result: Schedule result.
- */
-void GanttChartMaker::drawOperationsToTexture(sf::RenderTexture& target, float startX, float startY, std::shared_ptr<ScheduleResult> result) {
+    // Operations
     for (const auto& job : result->problem.jobs) {
         for (const auto& operation : job->operations) {
             if (operation->isScheduled()) {
@@ -219,171 +120,93 @@ void GanttChartMaker::drawOperationsToTexture(sf::RenderTexture& target, float s
                 float y = startY + operation->machineId * rowHeight + 5;
                 float width = operation->getDuration() * timeScale;
                 float height = rowHeight - 10;
+                chart.addBar(sf::FloatRect(x, y, width, height), getJobColor(operation->jobId), sf::Color(0, 0, 0));
                 
-                // Draw operation rectangle
-                sf::RectangleShape rect(sf::Vector2f(width, height));
-                rect.setFillColor(getJobColor(operation->jobId));
-                rect.setOutlineColor(sf::Color(0, 0, 0));
-                rect.setOutlineThickness(1);
-                rect.setPosition(x, y);
-                target.draw(rect);
-                
-                // Draw operation label
                 if (fontLoaded && width > 30) {
-                    sf::Text opText;
-                    opText.setFont(font);
-                    opText.setString("J" + std::to_string(operation->jobId) + " Op" + std::to_string(operation->operationId));
-                    opText.setCharacterSize(10);
-                    opText.setFillColor(sf::Color(0, 0, 0));
-                    opText.setPosition(x + 2, y + height / 2 - 5);
-                    target.draw(opText);
+                    labels.add("J" + std::to_string(operation->jobId) + " Op" + std::to_string(operation->operationId),
+                               10, sf::Vector2f(x + 2, y + height / 2 - 5), sf::Color(0, 0, 0));
                 }
             }
         }
     }
+    
+    if (fontLoaded) {
+        addTimeAxisLabels(startX, startY - 30, maxTime);
+        addMachineLabels(startX, startY, numMachines);
+    }
+    
+    chartResult = result;
+    chartDirty = false;
 }
 
 /**
- * Draws the time axis.
+ * Adds the time axis labels to the label batch. The ticks are part of the
+ * chart batch.
  *
  * Args:
  *   startX: Starting X position.
  *   startY: Starting Y position.
  *   maxTime: Maximum time value.
  */
-void GanttChartMaker::drawTimeAxis(float startX, float startY, int maxTime) {
-    if (!fontLoaded) return;
-    
+void GanttChartMaker::addTimeAxisLabels(float startX, float startY, int maxTime) {
     for (int t = 0; t <= maxTime; t += 5) {
         float x = startX + t * timeScale;
-        
-        // Draw tick
-        sf::RectangleShape tick(sf::Vector2f(1, 10));
-        tick.setFillColor(sf::Color(0, 0, 0));
-        tick.setPosition(x, startY - 10);
-        window.draw(tick);
-        
-        // Draw time label
-        sf::Text timeText;
-        timeText.setFont(font);
-        timeText.setString(std::to_string(t));
-        timeText.setCharacterSize(12);
-        timeText.setFillColor(sf::Color(0, 0, 0));
-        timeText.setPosition(x - 5, startY - 25);
-        window.draw(timeText);
+        labels.add(std::to_string(t), 12, sf::Vector2f(x - 5, startY - 25), sf::Color(0, 0, 0));
     }
 }
 
 /**
- * Draws machine labels.
+ * Adds the machine labels to the label batch.
  *
  * Args:
  *   startX: Starting X position.
  *   startY: Starting Y position.
- *   problem: Problem instance.
+ *   numMachines: Number of machines.
  */
-void GanttChartMaker::drawMachineLabels(float startX, float startY, std::shared_ptr<ProblemInstance> problem) {
-    if (!fontLoaded) return;
-    
-    for (int i = 0; i < problem->numMachines; i++) {
+void GanttChartMaker::addMachineLabels(float startX, float startY, int numMachines) {
+    for (int i = 0; i < numMachines; i++) {
         float y = startY + i * rowHeight + rowHeight / 2;
-        
-        sf::Text machineText;
-        machineText.setFont(font);
-        machineText.setString("M" + std::to_string(i));
-        machineText.setCharacterSize(14);
-        machineText.setFillColor(sf::Color(0, 0, 0));
-        machineText.setPosition(startX - machineLabelWidth + 10, y - 7);
-        window.draw(machineText);
+        labels.add("M" + std::to_string(i), 14, sf::Vector2f(startX - machineLabelWidth + 10, y - 7), sf::Color(0, 0, 0));
     }
 }
 
 /**
- * Draws operations on the chart.
+ * Draws the chart and label batches.
  *
  * Args:
- *   startX: Starting X position.
- *   startY: Starting Y position.
- *   result: Schedule result.
+ *   target: Window or render texture to draw to.
  */
-void GanttChartMaker::drawOperations(float startX, float startY, std::shared_ptr<ScheduleResult> result) {
-    for (const auto& job : result->problem.jobs) {
-        for (const auto& operation : job->operations) {
-            if (operation->isScheduled()) {
-                float x = startX + operation->startTime * timeScale;
-                float y = startY + operation->machineId * rowHeight + 5;
-                float width = operation->getDuration() * timeScale;
-                float height = rowHeight - 10;
-                
-                // Draw operation rectangle
-                sf::RectangleShape rect(sf::Vector2f(width, height));
-                rect.setFillColor(getJobColor(operation->jobId));
-                rect.setOutlineColor(sf::Color(0, 0, 0));
-                rect.setOutlineThickness(1);
-                rect.setPosition(x, y);
-                window.draw(rect);
-                
-                // Draw operation label
-                if (fontLoaded && width > 30) {
-                    sf::Text opText;
-                    opText.setFont(font);
-                    opText.setString("J" + std::to_string(operation->jobId) + " Op" + std::to_string(operation->operationId));
-                    opText.setCharacterSize(10);
-                    opText.setFillColor(sf::Color(0, 0, 0));
-                    opText.setPosition(x + 2, y + height / 2 - 5);
-                    window.draw(opText);
-                }
-            }
-        }
-    }
+void GanttChartMaker::drawOperations(sf::RenderTarget& target) {
+    chart.draw(target);
+    labels.draw(target);
 }
 
 /**
- * Displays the Gantt chart for a schedule result.
+ * Draws the whole chart: title, batches, labels and legend.
  *
  * Args:
- *   result: Schedule result to display.
+ *   target: Window or render texture to draw to.
+ *   result: Schedule result the chart was built for.
+ *   legendY: Y position of the legend.
  */
-void GanttChartMaker::displaySchedule(std::shared_ptr<ScheduleResult> result) {
-    if (!result) {
-        std::cerr << "Error: No schedule result provided" << std::endl;
-        return;
-    }
-    
-    // Calculate layout
-    float startX = marginLeft + machineLabelWidth;
-    float startY = marginTop + 50; // Space for time axis
-    
-    // Clear window
-    window.clear(sf::Color(255, 255, 255));
-    
+void GanttChartMaker::drawChart(sf::RenderTarget& target, const ScheduleResult& result, float legendY) {
     // Draw title
     if (fontLoaded) {
         sf::Text title;
         title.setFont(font);
-        title.setString("JSSP Schedule - Makespan: " + std::to_string(result->makespan));
+        title.setString("JSSP Schedule - Makespan: " + std::to_string(result.makespan));
         title.setCharacterSize(20);
         title.setFillColor(sf::Color(0, 0, 0));
         title.setPosition(marginLeft, 10);
-        window.draw(title);
+        target.draw(title);
     }
     
-    // Draw grid
-    drawGrid(startX, startY, result->makespan, result->problem.numMachines);
-    
-    // Draw time axis
-    drawTimeAxis(startX, startY - 30, result->makespan);
-    
-    // Draw machine labels
-    drawMachineLabels(startX, startY, std::make_shared<ProblemInstance>(result->problem));
-    
-    // Draw operations
-    drawOperations(startX, startY, result);
+    // Draw grid, ticks, operations and labels
+    drawOperations(target);
     
     // Display legend
-    if (fontLoaded && result->problem.numJobs <= static_cast<int>(jobColors.size())) {
-        float legendY = window.getSize().y - marginBottom - 80;
-        for (int i = 0; i < result->problem.numJobs; i++) {
+    if (fontLoaded && result.problem.numJobs <= static_cast<int>(jobColors.size())) {
+        for (int i = 0; i < result.problem.numJobs; i++) {
             float legendX = marginLeft + i * 80;
             
             // Draw color box
@@ -392,7 +215,7 @@ void GanttChartMaker::displaySchedule(std::shared_ptr<ScheduleResult> result) {
             colorBox.setOutlineColor(sf::Color(0, 0, 0));
             colorBox.setOutlineThickness(1);
             colorBox.setPosition(legendX, legendY);
-            window.draw(colorBox);
+            target.draw(colorBox);
             
             // Draw job label
             sf::Text jobText;
@@ -401,24 +224,42 @@ void GanttChartMaker::displaySchedule(std::shared_ptr<ScheduleResult> result) {
             jobText.setCharacterSize(12);
             jobText.setFillColor(sf::Color(0, 0, 0));
             jobText.setPosition(legendX + 20, legendY - 2);
-            window.draw(jobText);
+            target.draw(jobText);
         }
     }
+}
+
+/**
+ * Displays the Gantt chart for a schedule result.
+ *
+ * Args:
+ *   result: Schedule result to display.
+ */
+void GanttChartMaker::displaySchedule(std::shared_ptr<ScheduleResult> result) {
+    if (!result) {
+        std::cerr << "Error: No schedule result provided" << std::endl;
+        return;
+    }
     
+    buildChart(result);
+    window.clear(sf::Color(255, 255, 255));
+    drawChart(window, *result, window.getSize().y - marginBottom - 80);
     window.display();
 }
 
 /**
- * Saves the Gantt chart to a file.
+ * Renders the full Gantt chart into an image.
  *
  * Args:
- *   result: Schedule result to save.
- *   filename: Output file path.
+ *   result: Schedule result to render.
+ *
+ * Returns:
+ *   Rendered chart, or an empty image if there is no result or no render
+ *   texture could be created.
  */
-void GanttChartMaker::saveToFile(std::shared_ptr<ScheduleResult> result, const std::string& filename) {
+sf::Image GanttChartMaker::renderToImage(std::shared_ptr<ScheduleResult> result) {
     if (!result) {
-        std::cerr << "Error: No schedule result provided for saving." << std::endl;
-        return;
+        return sf::Image();
     }
     
     // Calculate required dimensions for the full chart
@@ -435,65 +276,36 @@ void GanttChartMaker::saveToFile(std::shared_ptr<ScheduleResult> result, const s
     sf::RenderTexture renderTexture;
     if (!renderTexture.create(chartWidth, chartHeight)) {
         std::cerr << "Error: Failed to create render texture for saving." << std::endl;
-        return;
+        return sf::Image();
     }
     
-    // Clear the render texture
+    buildChart(result);
     renderTexture.clear(sf::Color(255, 255, 255));
-    
-    // Draw title
-    if (fontLoaded) {
-        sf::Text title;
-        title.setFont(font);
-        title.setString("JSSP Schedule - Makespan: " + std::to_string(result->makespan));
-        title.setCharacterSize(20);
-        title.setFillColor(sf::Color(0, 0, 0));
-        title.setPosition(marginLeft, 10);
-        renderTexture.draw(title);
+    drawChart(renderTexture, *result, chartHeight - marginBottom - 80);
+    renderTexture.display();
+    return renderTexture.getTexture().copyToImage();
+}
+
+/**
+ * Saves the Gantt chart to a file.
+ *
+ * Args:
+ *   result: Schedule result to save.
+ *   filename: Output file path.
+ */
+void GanttChartMaker::saveToFile(std::shared_ptr<ScheduleResult> result, const std::string& filename) {
+    if (!result) {
+        std::cerr << "Error: No schedule result provided for saving." << std::endl;
+        return;
     }
     
-    // Draw grid
-    drawGridToTexture(renderTexture, startX, startY, result->makespan, result->problem.numMachines);
-    
-    // Draw time axis
-    drawTimeAxisToTexture(renderTexture, startX, startY - 30, result->makespan);
-    
-    // Draw machine labels
-    drawMachineLabelsToTexture(renderTexture, startX, startY, std::make_shared<ProblemInstance>(result->problem));
-    
-    // Draw operations
-    drawOperationsToTexture(renderTexture, startX, startY, result);
-    
-    // Display legend
-    if (fontLoaded && result->problem.numJobs <= static_cast<int>(jobColors.size())) {
-        float legendY = chartHeight - marginBottom - 80;
-        for (int i = 0; i < result->problem.numJobs; i++) {
-            float legendX = marginLeft + i * 80;
-            
-            // Draw color box
-            sf::RectangleShape colorBox(sf::Vector2f(15, 15));
-            colorBox.setFillColor(getJobColor(i));
-            colorBox.setOutlineColor(sf::Color(0, 0, 0));
-            colorBox.setOutlineThickness(1);
-            colorBox.setPosition(legendX, legendY);
-            renderTexture.draw(colorBox);
-            
-            // Draw job label
-            sf::Text jobText;
-            jobText.setFont(font);
-            jobText.setString("Job " + std::to_string(i));
-            jobText.setCharacterSize(12);
-            jobText.setFillColor(sf::Color(0, 0, 0));
-            jobText.setPosition(legendX + 20, legendY - 2);
-            renderTexture.draw(jobText);
-        }
+    sf::Image image = renderToImage(result);
+    if (image.getSize().x == 0) {
+        return;
     }
     
-    renderTexture.display();
-    
     // Save to file
-    sf::Texture texture = renderTexture.getTexture();
-    if (texture.copyToImage().saveToFile(filename)) {
+    if (image.saveToFile(filename)) {
         std::cout << "Gantt chart saved successfully to: " << filename << std::endl;
     } else {
         std::cerr << "Error: Failed to save Gantt chart to file: " << filename << std::endl;
@@ -520,6 +332,7 @@ void GanttChartMaker::setWindowSize(unsigned int width, unsigned int height) {
  */
 void GanttChartMaker::setTimeScale(float scale) {
     timeScale = scale;
+    chartDirty = true;
 }
 
 /**
@@ -530,6 +343,7 @@ void GanttChartMaker::setTimeScale(float scale) {
  */
 void GanttChartMaker::setRowHeight(float height) {
     rowHeight = height;
+    chartDirty = true;
 }
 
 /**
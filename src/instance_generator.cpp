@@ -0,0 +1,237 @@
+#include "instance_generator.hpp"
+#include <algorithm>
+#include <charconv>
+#include <climits>
+#include <cmath>
+#include <fstream>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+const size_t WRITE_BUFFER_BYTES = 1 << 20;
+const size_t MAX_LINE_BYTES = 40; // three ints, two spaces and a newline
+
+/**
+ * Draws processing times from the configured distribution.
+ */
+class DurationSampler {
+public:
+    explicit DurationSampler(const GeneratorConfig& config)
+        : config(config),
+          uniform(config.minDuration, config.maxDuration),
+          normal(0.5 * (config.minDuration + config.maxDuration),
+                 std::max(1e-9, (config.maxDuration - config.minDuration) / 6.0)),
+          exponential(1.0 / std::max(1.0, (config.maxDuration - config.minDuration) / 4.0)) {}
+
+    int operator()(std::mt19937_64& rng) {
+        double value = 0.0;
+        switch (config.durations) {
+            case DurationDistribution::UNIFORM:
+                return uniform(rng);
+            case DurationDistribution::NORMAL:
+                value = std::round(normal(rng));
+                break;
+            case DurationDistribution::EXPONENTIAL:
+                value = config.minDuration + std::floor(exponential(rng));
+                break;
+        }
+        return static_cast<int>(std::clamp(value, static_cast<double>(config.minDuration),
+                                           static_cast<double>(config.maxDuration)));
+    }
+
+private:
+    const GeneratorConfig& config;
+    std::uniform_int_distribution<int> uniform;
+    std::normal_distribution<double> normal;
+    std::exponential_distribution<double> exponential;
+};
+
+/**
+ * Appends an integer and a separator to a write buffer.
+ */
+char* append(char* p, int value, char separator) {
+    p = std::to_chars(p, p + 12, value).ptr;
+    *p++ = separator;
+    return p;
+}
+
+} // namespace
+
+/**
+ * Constructor for InstanceGenerator. Throws std::invalid_argument if the
+ * config is out of range.
+ *
+ * Args:
+ *   config: Instance parameters.
+ */
+InstanceGenerator::InstanceGenerator(const GeneratorConfig& config) : config(config) {
+    if (config.jobs <= 0 || config.machines <= 0) {
+        throw std::invalid_argument("Invalid number of jobs or machines");
+    }
+    if (this->config.operationsPerJob == 0) {
+        this->config.operationsPerJob = config.machines;
+    }
+    if (this->config.operationsPerJob < 0 || config.jobs > INT_MAX / this->config.operationsPerJob) {
+        throw std::invalid_argument("Invalid number of operations per job");
+    }
+    if (config.minDuration <= 0 || config.maxDuration < config.minDuration) {
+        throw std::invalid_argument("Durations must satisfy 0 < min <= max");
+    }
+    if (config.routing == RoutingModel::BOTTLENECK &&
+        (config.bottlenecks <= 0 || config.bottlenecks >= config.machines ||
+         !(config.bottleneckShare >= 0.0 && config.bottleneckShare <= 1.0))) {
+        throw std::invalid_argument("Bottleneck routing needs 0 < bottlenecks < machines and a share in [0, 1]");
+    }
+}
+
+/**
+ * Calls emit(job, machine, duration) for every operation in file order.
+ */
+template <typename Emit>
+void InstanceGenerator::forEachOperation(Emit&& emit) const {
+    std::mt19937_64 rng(config.seed);
+    DurationSampler duration(config);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    auto uniform = [&rng](int low, int high) {
+        return std::uniform_int_distribution<int>(low, high)(rng);
+    };
+
+    const int machines = config.machines;
+    const int operations = config.operationsPerJob;
+    std::vector<int> route(machines);
+    std::iota(route.begin(), route.end(), 0);
+
+    for (int job = 0; job < config.jobs; ++job) {
+        switch (config.routing) {
+            case RoutingModel::RANDOM_PERMUTATION:
+                // Incremental Fisher-Yates: one fresh permutation per pass
+                for (int k = 0; k < operations; ++k) {
+                    int position = k % machines;
+                    std::swap(route[position], route[uniform(position, machines - 1)]);
+                    emit(job, route[position], duration(rng));
+                }
+                break;
+
+            case RoutingModel::FLOW:
+                if (operations >= machines) {
+                    for (int k = 0; k < operations; ++k) {
+                        emit(job, k % machines, duration(rng));
+                    }
+                } else {
+                    // Selection sampling keeps the subset in machine order
+                    int needed = operations;
+                    for (int machine = 0; machine < machines && needed > 0; ++machine) {
+                        if (unit(rng) * (machines - machine) < needed) {
+                            emit(job, machine, duration(rng));
+                            needed--;
+                        }
+                    }
+                }
+                break;
+
+            case RoutingModel::BOTTLENECK: {
+                int previous = -1;
+                // Uniform machine in [first, first + count) other than the previous one, or -1
+                auto pick = [&](int first, int count) {
+                    if (previous >= first && previous < first + count) {
+                        if (count == 1) {
+                            return -1;
+                        }
+                        int machine = first + uniform(0, count - 2);
+                        return machine >= previous ? machine + 1 : machine;
+                    }
+                    return first + uniform(0, count - 1);
+                };
+                const int bottlenecks = config.bottlenecks;
+                for (int k = 0; k < operations; ++k) {
+                    bool toBottleneck = unit(rng) < config.bottleneckShare;
+                    int machine = toBottleneck ? pick(0, bottlenecks) : pick(bottlenecks, machines - bottlenecks);
+                    if (machine < 0) {
+                        machine = toBottleneck ? pick(bottlenecks, machines - bottlenecks) : pick(0, bottlenecks);
+                    }
+                    emit(job, machine, duration(rng));
+                    previous = machine;
+                }
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * Builds the instance in memory.
+ *
+ * Returns:
+ *   Generated problem instance.
+ */
+std::shared_ptr<ProblemInstance> InstanceGenerator::generate() const {
+    auto problem = std::make_shared<ProblemInstance>();
+    problem->createJobs(config.jobs);
+    problem->createMachines(config.machines);
+    for (auto& job : problem->jobs) {
+        job->operations.reserve(config.operationsPerJob);
+    }
+
+    int operationId = 0;
+    forEachOperation([&](int job, int machine, int time) {
+        problem->jobs[job]->operations.push_back(std::make_shared<Operation>(job, machine, time, operationId++));
+    });
+    return problem;
+}
+
+/**
+ * Streams the instance in .jssp format.
+ *
+ * Args:
+ *   out: Output stream.
+ *
+ * Returns:
+ *   Number of operations written.
+ */
+size_t InstanceGenerator::write(std::ostream& out) const {
+    std::vector<char> buffer(WRITE_BUFFER_BYTES);
+    char* const begin = buffer.data();
+    char* const limit = begin + buffer.size() - MAX_LINE_BYTES;
+    char* p = append(begin, config.jobs, ' ');
+    p = append(p, config.machines, '\n');
+
+    size_t written = 0;
+    forEachOperation([&](int job, int machine, int time) {
+        p = append(p, job, ' ');
+        p = append(p, machine, ' ');
+        p = append(p, time, '\n');
+        if (p >= limit) {
+            out.write(begin, p - begin);
+            p = begin;
+        }
+        written++;
+    });
+    out.write(begin, p - begin);
+    return written;
+}
+
+/**
+ * Streams the instance to a .jssp file. Throws std::runtime_error if the
+ * file cannot be written.
+ *
+ * Args:
+ *   filename: Output file path.
+ *
+ * Returns:
+ *   Number of operations written.
+ */
+size_t InstanceGenerator::writeFile(const std::string& filename) const {
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("Could not create file: " + filename);
+    }
+    size_t written = write(file);
+    file.close();
+    if (!file) {
+        throw std::runtime_error("Could not write file: " + filename);
+    }
+    return written;
+}
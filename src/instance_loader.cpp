@@ -0,0 +1,130 @@
+#include "instance_loader.hpp"
+#include "binary_instance.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <future>
+#include <numeric>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+
+namespace fs = std::filesystem;
+
+/**
+ * Finds the .jssp and .jsspb files below a directory, recursively.
+ *
+ * Args:
+ *   directory: Directory to search.
+ *
+ * Returns:
+ *   File paths in sorted order.
+ */
+std::vector<std::string> InstanceLoader::discover(const std::string& directory) {
+    std::error_code error;
+    if (!fs::is_directory(directory, error)) {
+        throw std::runtime_error("Not a directory: " + directory);
+    }
+
+    std::vector<std::string> paths;
+    fs::recursive_directory_iterator it(directory, fs::directory_options::skip_permission_denied, error);
+    for (; !error && it != fs::recursive_directory_iterator(); it.increment(error)) {
+        const fs::path& path = it->path();
+        if (it->is_regular_file(error) && (path.extension() == ".jssp" || path.extension() == ".jsspb")) {
+            paths.push_back(path.string());
+        }
+    }
+    if (error) {
+        throw std::runtime_error("Could not list " + directory + ": " + error.message());
+    }
+    std::sort(paths.begin(), paths.end());
+    return paths;
+}
+
+/**
+ * Parses files in parallel, largest first.
+ *
+ * Args:
+ *   paths: Files to read.
+ *   threads: Worker count; 0 uses all hardware threads.
+ *
+ * Returns:
+ *   One entry per path, in the order given.
+ */
+std::vector<InstanceFile> InstanceLoader::loadFiles(const std::vector<std::string>& paths, int threads) {
+    std::vector<uintmax_t> sizes(paths.size(), 0);
+    for (size_t i = 0; i < paths.size(); ++i) {
+        std::error_code error;
+        uintmax_t size = fs::file_size(paths[i], error);
+        sizes[i] = error ? 0 : size;
+    }
+    std::vector<size_t> order(paths.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return sizes[a] > sizes[b]; });
+
+    // No more workers than files
+    if (threads <= 0) {
+        threads = static_cast<int>(std::thread::hardware_concurrency());
+    }
+    threads = std::max(1, std::min(threads, static_cast<int>(paths.size())));
+
+    std::vector<InstanceFile> files(paths.size());
+    {
+        ThreadPool pool(threads);
+        std::vector<std::future<void>> pending;
+        pending.reserve(paths.size());
+        for (size_t index : order) {
+            pending.push_back(pool.submit([&, index]() { files[index] = loadFile(paths[index]); }));
+        }
+        for (auto& task : pending) {
+            task.get();
+        }
+    }
+    return files;
+}
+
+/**
+ * Discovers and parses every instance below a directory.
+ *
+ * Args:
+ *   directory: Directory to search.
+ *   threads: Worker count; 0 uses all hardware threads.
+ *
+ * Returns:
+ *   One entry per file, in sorted path order.
+ */
+std::vector<InstanceFile> InstanceLoader::loadDirectory(const std::string& directory, int threads) {
+    return loadFiles(discover(directory), threads);
+}
+
+/**
+ * Parses a single file on the calling thread.
+ *
+ * Args:
+ *   path: File to read.
+ *
+ * Returns:
+ *   Loaded file and its statistics.
+ */
+InstanceFile InstanceLoader::loadFile(const std::string& path) {
+    InstanceFile file;
+    file.path = path;
+    auto begin = std::chrono::steady_clock::now();
+    try {
+        std::error_code error;
+        uintmax_t size = fs::file_size(path, error);
+        file.bytes = error ? 0 : size;
+        if (BinaryInstance::isBinary(path)) {
+            file.problem = BinaryInstance::load(path, true).toProblem();
+            file.report.operations = file.problem->getTotalOperations();
+        } else {
+            file.problem = FastParser::parseFile(path, file.report);
+        }
+    } catch (const std::exception& e) {
+        file.problem = nullptr;
+        file.error = e.what();
+    }
+    file.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    return file;
+}
@@ -0,0 +1,346 @@
+#include "instance_pack.hpp"
+#include "binary_instance.hpp"
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+
+const char MAGIC[4] = {'J', 'S', 'P', 'K'};
+const uint32_t BYTE_ORDER_MARK = 0x01020304;
+const size_t ALIGNMENT = 64;
+
+/**
+ * Fixed-size pack header.
+ */
+struct PackHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint32_t headerSize;
+    uint64_t count;
+    uint64_t indexOffset;
+    uint64_t indexSize;
+    uint64_t fileSize;
+    uint64_t checksum;
+    unsigned char padding[8];
+};
+
+static_assert(sizeof(PackHeader) == 64, ".jsspk header must be 64 bytes");
+
+/**
+ * Fixed-size index record; the names follow the records.
+ */
+struct IndexRecord {
+    uint64_t offset;
+    uint64_t size;
+    uint64_t nameOffset; // from the start of the names
+    uint32_t nameLength;
+    int32_t numJobs;
+    int32_t numMachines;
+    int32_t numOperations;
+    unsigned char padding[8];
+};
+
+static_assert(sizeof(IndexRecord) == 48, ".jsspk index records must be 48 bytes");
+
+uint64_t fnv1a(const char* data, size_t size) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ static_cast<unsigned char>(data[i])) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+std::runtime_error invalidPack(const std::string& filename, const std::string& reason) {
+    return std::runtime_error("Invalid .jsspk file " + filename + ": " + reason);
+}
+
+/**
+ * Reads and checks the header against the file size.
+ */
+PackHeader readHeader(const std::string& filename, const char* data, size_t size, uint64_t fileSize) {
+    if (size < sizeof(PackHeader) || std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0) {
+        throw invalidPack(filename, "missing header");
+    }
+    PackHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (header.byteOrder != BYTE_ORDER_MARK) {
+        throw invalidPack(filename, "written with a different byte order");
+    }
+    if (header.version != InstancePack::VERSION || header.headerSize != sizeof(PackHeader)) {
+        throw invalidPack(filename, "unsupported version " + std::to_string(header.version));
+    }
+    if (header.fileSize != fileSize || header.indexOffset < sizeof(PackHeader) ||
+        header.indexOffset > fileSize || header.indexSize != fileSize - header.indexOffset ||
+        header.count > header.indexSize / sizeof(IndexRecord)) {
+        throw invalidPack(filename, "header does not match the file size");
+    }
+    return header;
+}
+
+/**
+ * Decodes and checks the index: every image must lie on an aligned offset
+ * between the header and the index.
+ */
+std::vector<PackEntry> readIndex(const std::string& filename, const PackHeader& header, const char* index) {
+    if (fnv1a(index, header.indexSize) != header.checksum) {
+        throw invalidPack(filename, "index checksum mismatch");
+    }
+    size_t recordsSize = header.count * sizeof(IndexRecord);
+    const char* names = index + recordsSize;
+    uint64_t namesSize = header.indexSize - recordsSize;
+
+    std::vector<PackEntry> entries(header.count);
+    for (size_t i = 0; i < entries.size(); ++i) {
+        IndexRecord record;
+        std::memcpy(&record, index + i * sizeof(IndexRecord), sizeof(record));
+        if (record.offset < sizeof(PackHeader) || record.offset % ALIGNMENT != 0 ||
+            record.size > header.indexOffset - record.offset || record.nameOffset > namesSize ||
+            record.nameLength > namesSize - record.nameOffset) {
+            throw invalidPack(filename, "entry " + std::to_string(i) + " is out of range");
+        }
+        PackEntry& entry = entries[i];
+        entry.name.assign(names + record.nameOffset, record.nameLength);
+        entry.offset = record.offset;
+        entry.size = record.size;
+        entry.numJobs = record.numJobs;
+        entry.numMachines = record.numMachines;
+        entry.numOperations = record.numOperations;
+    }
+    return entries;
+}
+
+} // namespace
+
+/**
+ * Constructor for InstancePackWriter. Reserves the header, which finish()
+ * fills in.
+ *
+ * Args:
+ *   filename: Pack file to write.
+ */
+InstancePackWriter::InstancePackWriter(const std::string& filename)
+    : filename(filename), file(filename, std::ios::binary | std::ios::trunc), position(0), finished(false) {
+    if (!file.is_open()) {
+        throw std::runtime_error("Could not create file: " + filename);
+    }
+    const char zeros[sizeof(PackHeader)] = {};
+    file.write(zeros, sizeof(zeros));
+    position = sizeof(PackHeader);
+}
+
+/**
+ * Destructor. A pack that was not finished is left without a header.
+ */
+InstancePackWriter::~InstancePackWriter() = default;
+
+/**
+ * Appends an instance as a .jsspb image.
+ *
+ * Args:
+ *   name: Entry name.
+ *   instance: Instance to append.
+ */
+void InstancePackWriter::add(const std::string& name, const FlatInstance& instance) {
+    if (finished) {
+        throw std::runtime_error("Pack already finished: " + filename);
+    }
+    PackEntry entry;
+    entry.name = name;
+    entry.offset = position;
+    entry.size = BinaryInstance::write(instance, file);
+    entry.numJobs = instance.getNumJobs();
+    entry.numMachines = instance.getNumMachines();
+    entry.numOperations = instance.getNumOperations();
+    if (!file) {
+        throw std::runtime_error("Could not write file: " + filename);
+    }
+    position += entry.size; // images are whole multiples of the alignment
+    entries.push_back(std::move(entry));
+}
+
+/**
+ * Appends a problem instance.
+ *
+ * Args:
+ *   name: Entry name.
+ *   problem: Instance to append.
+ */
+void InstancePackWriter::add(const std::string& name, const ProblemInstance& problem) {
+    add(name, FlatInstance::fromProblem(problem));
+}
+
+/**
+ * Writes the index and the header and closes the file.
+ */
+void InstancePackWriter::finish() {
+    if (finished) {
+        return;
+    }
+    finished = true;
+
+    std::string index(entries.size() * sizeof(IndexRecord), '\0');
+    std::string names;
+    for (size_t i = 0; i < entries.size(); ++i) {
+        const PackEntry& entry = entries[i];
+        IndexRecord record = {};
+        record.offset = entry.offset;
+        record.size = entry.size;
+        record.nameOffset = names.size();
+        record.nameLength = static_cast<uint32_t>(entry.name.size());
+        record.numJobs = entry.numJobs;
+        record.numMachines = entry.numMachines;
+        record.numOperations = entry.numOperations;
+        std::memcpy(&index[i * sizeof(IndexRecord)], &record, sizeof(record));
+        names += entry.name;
+    }
+    index += names;
+
+    PackHeader header = {};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = InstancePack::VERSION;
+    header.byteOrder = BYTE_ORDER_MARK;
+    header.headerSize = sizeof(PackHeader);
+    header.count = entries.size();
+    header.indexOffset = position;
+    header.indexSize = index.size();
+    header.fileSize = position + index.size();
+    header.checksum = fnv1a(index.data(), index.size());
+
+    file.write(index.data(), static_cast<std::streamsize>(index.size()));
+    file.seekp(0);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.close();
+    if (!file) {
+        throw std::runtime_error("Could not write file: " + filename);
+    }
+}
+
+/**
+ * Constructor for InstancePack. Maps the pack and reads its index.
+ *
+ * Args:
+ *   filename: Pack file to map.
+ */
+InstancePack::InstancePack(const std::string& filename)
+    : filename(filename), file(std::make_shared<MappedFile>(filename, MappedFile::Access::RANDOM)) {
+    PackHeader header = readHeader(filename, file->data(), file->size(), file->size());
+    entries = readIndex(filename, header, file->data() + header.indexOffset);
+}
+
+/**
+ * Finds an instance by name.
+ *
+ * Args:
+ *   name: Entry name.
+ *
+ * Returns:
+ *   Index of the first entry with that name, or -1.
+ */
+int InstancePack::find(const std::string& name) const {
+    for (size_t i = 0; i < entries.size(); ++i) {
+        if (entries[i].name == name) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+/**
+ * Returns an instance as a flat view of the mapping.
+ *
+ * Args:
+ *   index: Entry index.
+ *   verify: Also check the checksum and that every index is in range.
+ *
+ * Returns:
+ *   Flat instance backed by the pack.
+ */
+FlatInstance InstancePack::flat(size_t index, bool verify) const {
+    const PackEntry& packed = entry(index);
+    return BinaryInstance::fromBuffer(file->data() + packed.offset, packed.size, file, verify,
+                                      filename + ":" + packed.name);
+}
+
+/**
+ * Builds an unscheduled problem instance from a verified packed instance.
+ *
+ * Args:
+ *   index: Entry index.
+ *
+ * Returns:
+ *   Problem instance.
+ */
+std::shared_ptr<ProblemInstance> InstancePack::problem(size_t index) const {
+    // toProblem indexes the arrays directly, so the image must be checked first
+    return flat(index, true).toProblem();
+}
+
+/**
+ * Checks whether a file starts with the pack magic.
+ *
+ * Args:
+ *   filename: Path to file.
+ *
+ * Returns:
+ *   True for .jsspk files.
+ */
+bool InstancePack::isPack(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    char magic[sizeof(MAGIC)] = {};
+    return file.read(magic, sizeof(magic)) && std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0;
+}
+
+/**
+ * Constructor for InstancePackReader. Reads the header and the index.
+ *
+ * Args:
+ *   filename: Pack file to read.
+ */
+InstancePackReader::InstancePackReader(const std::string& filename)
+    : filename(filename), file(filename, std::ios::binary), current(0) {
+    if (!file.is_open()) {
+        throw std::runtime_error("Could not open file: " + filename);
+    }
+    file.seekg(0, std::ios::end);
+    uint64_t fileSize = static_cast<uint64_t>(file.tellg());
+    file.seekg(0);
+
+    char bytes[sizeof(PackHeader)] = {};
+    file.read(bytes, sizeof(bytes));
+    PackHeader header = readHeader(filename, bytes, static_cast<size_t>(file.gcount()), fileSize);
+
+    std::string index(header.indexSize, '\0');
+    file.seekg(static_cast<std::streamoff>(header.indexOffset));
+    if (!file.read(&index[0], static_cast<std::streamsize>(index.size()))) {
+        throw invalidPack(filename, "truncated index");
+    }
+    entries = readIndex(filename, header, index.data());
+}
+
+/**
+ * Reads the next instance into a buffer of its own.
+ *
+ * Args:
+ *   instance: Receives the instance.
+ *   verify: Also check the checksum and that every index is in range.
+ *
+ * Returns:
+ *   False once every instance has been read.
+ */
+bool InstancePackReader::next(FlatInstance& instance, bool verify) {
+    if (current >= entries.size()) {
+        return false;
+    }
+    const PackEntry& entry = entries[current];
+    // Words keep the image aligned for the int32 arrays
+    auto buffer = std::make_shared<std::vector<uint64_t>>((entry.size + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+    char* bytes = reinterpret_cast<char*>(buffer->data());
+    file.seekg(static_cast<std::streamoff>(entry.offset));
+    if (!file.read(bytes, static_cast<std::streamsize>(entry.size))) {
+        throw std::runtime_error("Could not read " + entry.name + " from " + filename);
+    }
+    instance = BinaryInstance::fromBuffer(bytes, entry.size, buffer, verify, filename + ":" + entry.name);
+    current++;
+    return true;
+}
@@ -0,0 +1,477 @@
+#include "island_model.hpp"
+#include "elite_pool.hpp"
+#include "sequence_hash.hpp"
+#include "sequence_schedule.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <csignal>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "Shared counters must be lock-free");
+static_assert(std::atomic<int>::is_always_lock_free, "Shared counters must be lock-free");
+static_assert(std::atomic<int64_t>::is_always_lock_free, "Shared counters must be lock-free");
+
+/**
+ * Interval at which the parent polls its workers.
+ */
+const std::chrono::milliseconds POLL_INTERVAL(5);
+
+/**
+ * Header of the ring segment; padded so the slots start on their own line.
+ */
+struct alignas(64) RingHeader {
+    std::atomic<uint64_t> next; // ticket of the next publish
+};
+
+/**
+ * Header of one ring slot. The sequence counter is odd while the slot is
+ * written and 2 * (ticket + 1) once the schedule of that ticket is complete.
+ */
+struct SlotHeader {
+    std::atomic<uint64_t> sequence;
+    int32_t sender;
+    int32_t makespan;
+};
+
+/**
+ * Header of one island's report slot.
+ */
+struct ReportHeader {
+    std::atomic<int> state;          // 0 running, 1 done
+    std::atomic<int64_t> progress;   // iterations run, watched for stalls
+    int32_t makespan;
+    int64_t accepted;                // migrants adopted
+};
+
+const size_t SLOT_ALIGN = 64;
+
+/**
+ * Operations stored right after a slot or report header.
+ */
+template <typename Header>
+int32_t* payload(Header* header) {
+    return reinterpret_cast<int32_t*>(reinterpret_cast<unsigned char*>(header) + sizeof(Header));
+}
+
+template <typename Header>
+const int32_t* payload(const Header* header) {
+    return reinterpret_cast<const int32_t*>(reinterpret_cast<const unsigned char*>(header) + sizeof(Header));
+}
+
+size_t alignUp(size_t value) {
+    return (value + SLOT_ALIGN - 1) / SLOT_ALIGN * SLOT_ALIGN;
+}
+
+/**
+ * Maps a zeroed POSIX shared memory segment and unlinks its name, so it is
+ * shared with forked children and freed with the last mapping.
+ */
+unsigned char* mapShared(size_t bytes) {
+    static std::atomic<unsigned> counter{0};
+    std::string name = "/jssp-" + std::to_string(getpid()) + "-" + std::to_string(counter++);
+
+    int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        throw std::runtime_error("Cannot create shared memory " + name + ": " + std::strerror(errno));
+    }
+    shm_unlink(name.c_str());
+    if (ftruncate(fd, static_cast<off_t>(bytes)) != 0) {
+        int error = errno;
+        close(fd);
+        throw std::runtime_error("Cannot size shared memory: " + std::string(std::strerror(error)));
+    }
+    void* memory = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED) {
+        throw std::runtime_error("Cannot map shared memory: " + std::string(std::strerror(errno)));
+    }
+    return static_cast<unsigned char*>(memory);
+}
+
+/**
+ * Concatenates machine sequences in machine order.
+ */
+std::vector<int> flatten(const MachineSequences& sequences) {
+    std::vector<int> flat;
+    for (const auto& sequence : sequences) {
+        flat.insert(flat.end(), sequence.begin(), sequence.end());
+    }
+    return flat;
+}
+
+/**
+ * Splits concatenated sequences using the machine lengths of a template.
+ */
+MachineSequences unflatten(const std::vector<int>& flat, const MachineSequences& shape) {
+    MachineSequences sequences(shape.size());
+    size_t offset = 0;
+    for (size_t m = 0; m < shape.size(); ++m) {
+        sequences[m].assign(flat.begin() + offset, flat.begin() + offset + shape[m].size());
+        offset += shape[m].size();
+    }
+    return sequences;
+}
+
+} // namespace
+
+/**
+ * Constructor for MigrationRing.
+ *
+ * Args:
+ *   slots: Number of schedules kept.
+ *   sequenceLength: Operations per schedule.
+ */
+MigrationRing::MigrationRing(int slots, int sequenceLength)
+    : slots(slots), sequenceLength(sequenceLength), slotBytes(0), bytes(0), base(nullptr) {
+    if (slots < 1 || sequenceLength < 0) {
+        throw std::invalid_argument("Invalid migration ring size");
+    }
+    slotBytes = alignUp(sizeof(SlotHeader) + sizeof(int32_t) * static_cast<size_t>(sequenceLength));
+    bytes = sizeof(RingHeader) + slotBytes * static_cast<size_t>(slots);
+    base = mapShared(bytes);
+    new (base) RingHeader{};
+    for (int s = 0; s < slots; ++s) {
+        new (slot(s)) SlotHeader{};
+    }
+}
+
+MigrationRing::~MigrationRing() {
+    munmap(base, bytes);
+}
+
+unsigned char* MigrationRing::slot(uint64_t ticket) const {
+    return base + sizeof(RingHeader) + slotBytes * static_cast<size_t>(ticket % static_cast<uint64_t>(slots));
+}
+
+/**
+ * Publishes a schedule into the next slot.
+ *
+ * Args:
+ *   sender: Publishing island.
+ *   makespan: Makespan of the schedule.
+ *   sequence: Concatenated machine sequences.
+ *
+ * Returns:
+ *   False if the slot was busy or already reused by a later ticket.
+ */
+bool MigrationRing::publish(int sender, int makespan, const std::vector<int>& sequence) {
+    if (static_cast<int>(sequence.size()) != sequenceLength) {
+        throw std::invalid_argument("Migrant has the wrong number of operations");
+    }
+    auto* header = reinterpret_cast<RingHeader*>(base);
+    uint64_t ticket = header->next.fetch_add(1, std::memory_order_relaxed);
+
+    // Claim the slot only from a completed older ticket, so writers of wrapped
+    // tickets never interleave; a later ticket keeps a slot it already took
+    auto* target = reinterpret_cast<SlotHeader*>(slot(ticket));
+    uint64_t observed = target->sequence.load(std::memory_order_relaxed);
+    do {
+        if ((observed & 1) != 0 || observed >= 2 * ticket + 2) {
+            return false;
+        }
+    } while (!target->sequence.compare_exchange_weak(observed, 2 * ticket + 1, std::memory_order_relaxed));
+    std::atomic_thread_fence(std::memory_order_release);
+    target->sender = sender;
+    target->makespan = makespan;
+    std::memcpy(payload(target), sequence.data(), sizeof(int32_t) * sequence.size());
+    target->sequence.store(2 * ticket + 2, std::memory_order_release);
+    return true;
+}
+
+/**
+ * Reads the schedules published since the cursor by other senders.
+ *
+ * Args:
+ *   reader: Reading island.
+ *   cursor: Ticket of the next unread slot; updated.
+ *
+ * Returns:
+ *   Schedules read, oldest first.
+ */
+std::vector<Migrant> MigrationRing::collect(int reader, uint64_t& cursor) const {
+    const auto* header = reinterpret_cast<const RingHeader*>(base);
+    uint64_t end = header->next.load(std::memory_order_acquire);
+    if (end - cursor > static_cast<uint64_t>(slots)) {
+        cursor = end - static_cast<uint64_t>(slots);
+    }
+
+    std::vector<Migrant> migrants;
+    for (; cursor < end; ++cursor) {
+        const auto* source = reinterpret_cast<const SlotHeader*>(slot(cursor));
+        uint64_t complete = 2 * cursor + 2;
+        if (source->sequence.load(std::memory_order_acquire) != complete || source->sender == reader) {
+            continue; // still being written, already overwritten, or our own
+        }
+        Migrant migrant{source->sender, source->makespan, std::vector<int>(sequenceLength)};
+        std::memcpy(migrant.sequence.data(), payload(source), sizeof(int32_t) * migrant.sequence.size());
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (source->sequence.load(std::memory_order_relaxed) == complete) {
+            migrants.push_back(std::move(migrant));
+        }
+    }
+    return migrants;
+}
+
+/**
+ * Gets the number of schedules published so far.
+ *
+ * Returns:
+ *   Publish count.
+ */
+uint64_t MigrationRing::getPublished() const {
+    return reinterpret_cast<const RingHeader*>(base)->next.load(std::memory_order_acquire);
+}
+
+/**
+ * Constructor for IslandModel.
+ *
+ * Args:
+ *   instance: Flat instance of the problem.
+ *   config: Island model parameters.
+ */
+IslandModel::IslandModel(const FlatInstance& instance, const IslandConfig& config)
+    : instance(instance), config(config) {
+    if (config.islands < 1 || config.iterations < 0 || config.migrationInterval < 1 || config.ringSlots < 0 ||
+        config.memoryLimitMB < 0 || config.stallTimeout < 0) {
+        throw std::invalid_argument("Invalid island model configuration");
+    }
+}
+
+/**
+ * Runs all islands from a schedule and waits for them.
+ *
+ * Args:
+ *   initial: Flat operation indices per machine.
+ *   elites: If set, receives the final and migrated schedules.
+ *
+ * Returns:
+ *   Best schedule over all islands.
+ */
+IslandResult IslandModel::run(const MachineSequences& initial, ElitePool* elites) {
+    const int length = instance.getNumOperations();
+    MigrationRing ring(config.ringSlots > 0 ? config.ringSlots : 2 * config.islands, length);
+
+    const size_t reportBytes = alignUp(sizeof(ReportHeader) + sizeof(int32_t) * static_cast<size_t>(length));
+    const size_t reportsSize = reportBytes * static_cast<size_t>(config.islands);
+    unsigned char* reports = mapShared(reportsSize);
+    for (int i = 0; i < config.islands; ++i) {
+        new (reports + reportBytes * i) ReportHeader{};
+    }
+
+    // Children exit with _exit, so buffered output must not be duplicated into them
+    std::cout.flush();
+    std::vector<std::pair<pid_t, int>> workers; // (pid, island)
+    IslandResult result;
+    for (int island = 0; island < config.islands; ++island) {
+        pid_t pid = fork();
+        if (pid == 0) {
+            int status = 0;
+            try {
+                runIsland(island, initial, ring, reports + reportBytes * island);
+            } catch (...) {
+                status = 1;
+            }
+            _exit(status);
+        }
+        if (pid > 0) {
+            workers.emplace_back(pid, island);
+        }
+    }
+
+    // Workers inherit a copy of every lock held by the parent's other threads at
+    // fork time, so a worker can block forever; kill those that stop making progress
+    struct Worker {
+        pid_t pid;
+        const ReportHeader* report;
+        int64_t progress;
+        std::chrono::steady_clock::time_point lastProgress;
+    };
+    std::vector<Worker> running;
+    for (size_t w = 0; w < workers.size(); ++w) {
+        running.push_back(Worker{workers[w].first,
+                                 reinterpret_cast<const ReportHeader*>(reports + reportBytes * workers[w].second), -1,
+                                 std::chrono::steady_clock::now()});
+    }
+    while (!running.empty()) {
+        auto now = std::chrono::steady_clock::now();
+        for (size_t w = 0; w < running.size();) {
+            Worker& worker = running[w];
+            int status = 0;
+            pid_t waited = waitpid(worker.pid, &status, WNOHANG);
+            bool finished = waited == worker.pid || (waited < 0 && errno != EINTR);
+            if (!finished) {
+                int64_t progress = worker.report->progress.load(std::memory_order_relaxed);
+                if (progress != worker.progress) {
+                    worker.progress = progress;
+                    worker.lastProgress = now;
+                } else if (config.stallTimeout > 0 &&
+                           std::chrono::duration<double>(now - worker.lastProgress).count() > config.stallTimeout) {
+                    kill(worker.pid, SIGKILL);
+                    while (waitpid(worker.pid, &status, 0) < 0 && errno == EINTR) {}
+                    ++result.stalledIslands;
+                    finished = true;
+                }
+            }
+            if (finished) {
+                running.erase(running.begin() + static_cast<long>(w));
+            } else {
+                ++w;
+            }
+        }
+        if (!running.empty()) {
+            std::this_thread::sleep_for(POLL_INTERVAL);
+        }
+    }
+
+    // Schedules are re-timed here; a worker's claimed makespan is not trusted
+    SequenceSchedule schedule(instance);
+    auto retime = [&](const MachineSequences& sequences) {
+        try {
+            return schedule.load(sequences) ? schedule.getMakespan() : -1;
+        } catch (const std::invalid_argument&) {
+            return -1;
+        }
+    };
+
+    for (int island = 0; island < config.islands; ++island) {
+        const auto* report = reinterpret_cast<const ReportHeader*>(reports + reportBytes * island);
+        if (report->state.load(std::memory_order_acquire) != 1) {
+            continue;
+        }
+        std::vector<int> flat(length);
+        std::memcpy(flat.data(), payload(report), sizeof(int32_t) * flat.size());
+        MachineSequences sequences = unflatten(flat, initial);
+        int makespan = retime(sequences);
+        if (makespan < 0) {
+            continue; // a report that does not load counts as failed
+        }
+        ++result.completedIslands;
+        result.migrationsAccepted += report->accepted;
+        if (elites) {
+            elites->tryInsert(sequences, makespan);
+        }
+        if (result.makespan < 0 || makespan < result.makespan) {
+            result.sequences = std::move(sequences);
+            result.makespan = makespan;
+        }
+    }
+    if (elites) {
+        uint64_t cursor = 0;
+        for (const Migrant& migrant : ring.collect(-1, cursor)) {
+            MachineSequences sequences = unflatten(migrant.sequence, initial);
+            int makespan = retime(sequences);
+            if (makespan >= 0) {
+                elites->tryInsert(sequences, makespan);
+            }
+        }
+    }
+    result.failedIslands = config.islands - result.completedIslands;
+    result.migrationsPublished = ring.getPublished();
+    munmap(reports, reportsSize);
+
+    if (result.completedIslands == 0) {
+        throw std::runtime_error("All " + std::to_string(config.islands) + " islands failed");
+    }
+    return result;
+}
+
+/**
+ * Search loop of one worker process.
+ *
+ * Args:
+ *   island: Island index.
+ *   initial: Start schedule.
+ *   ring: Shared migration ring.
+ *   report: Shared report slot of this island.
+ */
+void IslandModel::runIsland(int island, const MachineSequences& initial, MigrationRing& ring,
+                            unsigned char* report) const {
+    if (config.memoryLimitMB > 0) {
+        rlim_t limit = static_cast<rlim_t>(config.memoryLimitMB) * 1024 * 1024;
+        struct rlimit bounds = {limit, limit};
+        if (setrlimit(RLIMIT_AS, &bounds) != 0) {
+            throw std::runtime_error("Cannot set memory limit");
+        }
+    }
+    if (config.workerHook) {
+        config.workerHook(island);
+    }
+
+    auto* header = reinterpret_cast<ReportHeader*>(report);
+    LNSConfig lns = config.lns;
+    lns.seed = config.lns.seed ^ SequenceHasher::key(island, 0);
+    LNSEngine engine(instance, lns);
+    engine.reset(initial);
+
+    MachineSequences best = initial;
+    int bestMakespan = engine.getBestMakespan();
+    int publishedMakespan = INT_MAX;
+    long accepted = 0;
+    uint64_t cursor = 0;
+    SequenceSchedule check(instance);
+
+    for (int done = 0; done < config.iterations;) {
+        // One iteration at a time, so the parent sees progress between migrations
+        int step = std::min(config.migrationInterval, config.iterations - done);
+        for (int i = 0; i < step; ++i) {
+            engine.runIterations(1);
+            header->progress.fetch_add(1, std::memory_order_relaxed);
+        }
+        done += step;
+        if (engine.getBestMakespan() < bestMakespan) {
+            bestMakespan = engine.getBestMakespan();
+            best = engine.getBestSequences();
+        }
+
+        // Emigrate on improvement, immigrate the best foreign schedule if it is better
+        if (bestMakespan < publishedMakespan && ring.publish(island, bestMakespan, flatten(best))) {
+            publishedMakespan = bestMakespan;
+        }
+        std::vector<Migrant> migrants = ring.collect(island, cursor);
+        std::sort(migrants.begin(), migrants.end(),
+                  [](const Migrant& a, const Migrant& b) { return a.makespan < b.makespan; });
+        for (const Migrant& incoming : migrants) {
+            if (incoming.makespan >= bestMakespan || done >= config.iterations) {
+                break;
+            }
+            // The claimed makespan only orders the migrants; adopt what re-times better
+            MachineSequences candidate = unflatten(incoming.sequence, initial);
+            bool valid = false;
+            try {
+                valid = check.load(candidate);
+            } catch (const std::invalid_argument&) {
+                valid = false;
+            }
+            if (valid && check.getMakespan() < bestMakespan) {
+                engine.adopt(candidate);
+                best = engine.getBestSequences();
+                bestMakespan = engine.getBestMakespan();
+                publishedMakespan = bestMakespan;
+                ++accepted;
+                break;
+            }
+        }
+    }
+
+    header->makespan = bestMakespan;
+    header->accepted = accepted;
+    std::vector<int> flat = flatten(best);
+    std::memcpy(payload(header), flat.data(), sizeof(int32_t) * flat.size());
+    header->state.store(1, std::memory_order_release);
+}
@@ -0,0 +1,606 @@
+#include "lns_engine.hpp"
+#include "checkpoint.hpp"
+#include "elite_pool.hpp"
+#include <algorithm>
+#include <climits>
+#include <future>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+
+/**
+ * Depth-first branch and bound over the order of a few machine blocks.
+ *
+ * Blocks are filled left to right, one position per tree level. At every
+ * node the operations not yet placed in a block form an unordered group:
+ * each one follows the last placed operation and precedes the operation
+ * after the block. The longest path of that relaxed graph is a valid lower
+ * bound, and at a leaf it is the exact makespan.
+ */
+class BlockSearch {
+public:
+    struct Block {
+        int machine;
+        int start;
+        int length;
+        int placed;
+    };
+
+    BlockSearch(const FlatInstance& instance, const MachineSequences& base, int nodeLimit)
+        : instance(instance), sequences(base), nodeLimit(nodeLimit), nodes(0), aborted(false),
+          bestMakespan(INT_MAX) {
+        const int n = instance.getNumOperations();
+        position.assign(n, 0);
+        for (const auto& sequence : sequences) {
+            for (size_t p = 0; p < sequence.size(); ++p) position[sequence[p]] = static_cast<int>(p);
+        }
+        head.assign(n, 0);
+        inDegree.assign(n, 0);
+        grouped.assign(n, -1);
+    }
+
+    /**
+     * Searches all orders of the blocks for a makespan below bound.
+     */
+    void run(const std::vector<Block>& freeBlocks, int bound) {
+        blocks = freeBlocks;
+        for (size_t b = 0; b < blocks.size(); ++b) {
+            blocks[b].placed = 0;
+            for (int p = 0; p < blocks[b].length; ++p) {
+                grouped[sequences[blocks[b].machine][blocks[b].start + p]] = static_cast<int>(b);
+            }
+        }
+        bestMakespan = bound;
+        search();
+    }
+
+    long getNodes() const { return nodes; }
+    bool isComplete() const { return !aborted; }
+    bool improved() const { return !bestOrders.empty(); }
+    int getBestMakespan() const { return bestMakespan; }
+    const std::vector<std::vector<int>>& getBestOrders() const { return bestOrders; }
+
+private:
+    const FlatInstance& instance;
+    MachineSequences sequences;
+    std::vector<int> position;
+    std::vector<Block> blocks;
+    std::vector<int> grouped;   // op -> block index while unplaced, else -1
+    std::vector<int> head;
+    std::vector<int> inDegree;
+    std::vector<int> stack;
+    int nodeLimit;
+    long nodes;
+    bool aborted;
+    int bestMakespan;
+    std::vector<std::vector<int>> bestOrders;
+
+    // Positions [groupBegin, groupEnd) of a block hold its unplaced operations
+    int groupBegin(const Block& block) const { return block.start + block.placed; }
+    int groupEnd(const Block& block) const { return block.start + block.length; }
+
+    int jobPredecessor(int op) const { return op > instance.jobStart(instance.job(op)) ? op - 1 : -1; }
+    int jobSuccessor(int op) const { return op + 1 < instance.jobStart(instance.job(op) + 1) ? op + 1 : -1; }
+
+    /**
+     * Counts machine arcs into op in the relaxed graph.
+     */
+    int machineInDegree(int op) const {
+        const auto& sequence = sequences[instance.machine(op)];
+        if (grouped[op] >= 0) {
+            return groupBegin(blocks[grouped[op]]) > 0 ? 1 : 0;
+        }
+        int p = position[op];
+        if (p == 0) return 0;
+        int previous = sequence[p - 1];
+        if (grouped[previous] >= 0) {
+            const Block& block = blocks[grouped[previous]];
+            return groupEnd(block) - groupBegin(block);
+        }
+        return 1;
+    }
+
+    /**
+     * Releases a successor and pushes it once all its predecessors are done.
+     */
+    void release(int next, int end) {
+        head[next] = std::max(head[next], end);
+        if (--inDegree[next] > 0) return;
+
+        // The operation after a group also waits for the whole group to run
+        int p = position[next];
+        if (grouped[next] < 0 && p > 0) {
+            const auto& sequence = sequences[instance.machine(next)];
+            int previous = sequence[p - 1];
+            if (grouped[previous] >= 0) {
+                const Block& block = blocks[grouped[previous]];
+                int earliest = INT_MAX;
+                int total = 0;
+                for (int q = groupBegin(block); q < groupEnd(block); ++q) {
+                    earliest = std::min(earliest, head[sequence[q]]);
+                    total += instance.duration(sequence[q]);
+                }
+                head[next] = std::max(head[next], earliest + total);
+            }
+        }
+        stack.push_back(next);
+    }
+
+    /**
+     * Times the relaxed graph.
+     *
+     * Returns:
+     *   Lower bound on the makespan, or INT_MAX if the graph is cyclic.
+     */
+    int evaluate() {
+        const int n = instance.getNumOperations();
+        stack.clear();
+        for (int op = 0; op < n; ++op) {
+            head[op] = 0;
+            inDegree[op] = (jobPredecessor(op) >= 0) + machineInDegree(op);
+            if (inDegree[op] == 0) stack.push_back(op);
+        }
+
+        int processed = 0;
+        int makespan = 0;
+        while (!stack.empty()) {
+            int op = stack.back();
+            stack.pop_back();
+            ++processed;
+            int end = head[op] + instance.duration(op);
+            makespan = std::max(makespan, end);
+
+            int next = jobSuccessor(op);
+            if (next >= 0) release(next, end);
+
+            const auto& sequence = sequences[instance.machine(op)];
+            int p = position[op];
+            if (grouped[op] >= 0) {
+                int after = groupEnd(blocks[grouped[op]]);
+                if (after < static_cast<int>(sequence.size())) release(sequence[after], end);
+            } else if (p + 1 < static_cast<int>(sequence.size())) {
+                int following = sequence[p + 1];
+                if (grouped[following] >= 0) {
+                    const Block& block = blocks[grouped[following]];
+                    for (int q = groupBegin(block); q < groupEnd(block); ++q) release(sequence[q], end);
+                } else {
+                    release(following, end);
+                }
+            }
+        }
+        return processed == n ? makespan : INT_MAX;
+    }
+
+    /**
+     * Explores the subtree below the current partial order.
+     */
+    void search() {
+        if (nodes >= nodeLimit) {
+            aborted = true;
+            return;
+        }
+        ++nodes;
+
+        int bound = evaluate();
+        if (bound >= bestMakespan) {
+            return;
+        }
+
+        int b = 0;
+        while (b < static_cast<int>(blocks.size()) && blocks[b].placed == blocks[b].length) ++b;
+        if (b == static_cast<int>(blocks.size())) {
+            bestMakespan = bound;
+            bestOrders.clear();
+            for (const auto& block : blocks) {
+                const auto& sequence = sequences[block.machine];
+                bestOrders.emplace_back(sequence.begin() + block.start, sequence.begin() + block.start + block.length);
+            }
+            return;
+        }
+
+        // Try the earliest-starting operations first to find good leaves early
+        Block& block = blocks[b];
+        auto& sequence = sequences[block.machine];
+        std::vector<std::pair<int, int>> candidates;
+        for (int q = groupBegin(block); q < groupEnd(block); ++q) {
+            candidates.emplace_back(head[sequence[q]], sequence[q]);
+        }
+        std::sort(candidates.begin(), candidates.end());
+
+        for (const auto& candidate : candidates) {
+            int op = candidate.second;
+            int slot = groupBegin(block);
+            int other = sequence[slot];
+            std::swap(sequence[slot], sequence[position[op]]);
+            std::swap(position[op], position[other]);
+            grouped[op] = -1;
+            ++block.placed;
+
+            search();
+
+            --block.placed;
+            grouped[op] = b;
+            if (aborted) return;
+        }
+    }
+};
+
+} // namespace
+
+/**
+ * Constructor for LNSEngine.
+ *
+ * Args:
+ *   instance: Flat instance of the problem.
+ *   config: Engine parameters.
+ */
+LNSEngine::LNSEngine(const FlatInstance& instance, const LNSConfig& config)
+    : instance(instance), config(config), workers(new ThreadPool(config.threads)), rng(config.seed),
+      nextNeighborhood(0), schedule(instance), currentMakespan(0), bestMakespan(0), elites(nullptr) {
+    if (config.blockSize < 2 || config.machinesPerSubproblem < 1 || config.nodeLimit < 1) {
+        throw std::invalid_argument("Invalid LNS configuration");
+    }
+}
+
+/**
+ * Gets the name of a neighbourhood type.
+ *
+ * Args:
+ *   type: Neighbourhood type.
+ *
+ * Returns:
+ *   Neighbourhood name string.
+ */
+std::string LNSEngine::getNeighborhoodName(NeighborhoodType type) {
+    switch (type) {
+        case NeighborhoodType::TimeWindow: return "Time window";
+        case NeighborhoodType::Machines: return "Machines";
+        case NeighborhoodType::Jobs: return "Jobs";
+        default: return "Unknown";
+    }
+}
+
+/**
+ * Starts a new search from a schedule.
+ *
+ * Args:
+ *   initial: Flat operation indices per machine.
+ */
+void LNSEngine::reset(const MachineSequences& initial) {
+    if (!schedule.load(initial)) {
+        throw std::invalid_argument("Initial schedule is cyclic");
+    }
+    current = initial;
+    currentMakespan = schedule.getMakespan();
+    best = current;
+    bestMakespan = currentMakespan;
+    statistics = LNSStatistics();
+    tabu.clear();
+    rng.seed(config.seed);
+    nextNeighborhood = 0;
+    if (elites) {
+        elites->tryInsert(current, currentMakespan);
+    }
+}
+
+/**
+ * Moves the search to another schedule without restarting it.
+ *
+ * Args:
+ *   sequences: Flat operation indices per machine.
+ */
+void LNSEngine::adopt(const MachineSequences& sequences) {
+    if (!schedule.load(sequences)) {
+        throw std::invalid_argument("Adopted schedule is cyclic");
+    }
+    current = sequences;
+    currentMakespan = schedule.getMakespan();
+    if (currentMakespan < bestMakespan) {
+        best = current;
+        bestMakespan = currentMakespan;
+    }
+    tabu.clear();
+    if (elites) {
+        elites->tryInsert(current, currentMakespan);
+    }
+}
+
+/**
+ * Copies the full search state into a checkpoint.
+ *
+ * Args:
+ *   state: Receives the search state.
+ */
+void LNSEngine::saveState(SearchCheckpoint& state) const {
+    state.current = current;
+    state.currentMakespan = currentMakespan;
+    state.best = best;
+    state.bestMakespan = bestMakespan;
+    state.tabu.assign(tabu.begin(), tabu.end());
+    state.nextNeighborhood = nextNeighborhood;
+    state.statistics = statistics;
+    state.elites = elites ? elites->snapshot() : std::vector<EliteSolution>();
+
+    // The standard generators only expose their state as text
+    std::stringstream text;
+    text << rng;
+    state.rngState.clear();
+    uint64_t word;
+    while (text >> word) state.rngState.push_back(word);
+}
+
+/**
+ * Continues from a checkpoint.
+ *
+ * Args:
+ *   state: Saved search state.
+ */
+void LNSEngine::restoreState(const SearchCheckpoint& state) {
+    std::stringstream text;
+    for (uint64_t word : state.rngState) text << word << ' ';
+    std::mt19937_64 restored;
+    if (!(text >> restored)) {
+        throw std::invalid_argument("Checkpoint has an invalid generator state");
+    }
+    if (state.nextNeighborhood < 0 || state.nextNeighborhood > 2 || !schedule.load(state.best) ||
+        schedule.getMakespan() != state.bestMakespan) {
+        throw std::invalid_argument("Checkpoint does not fit the instance");
+    }
+    for (const auto& elite : state.elites) {
+        if (!schedule.load(elite.sequences) || schedule.getMakespan() != elite.makespan) {
+            throw std::invalid_argument("Checkpoint does not fit the instance");
+        }
+    }
+    // Leaves the schedule timing the current sequences
+    if (!schedule.load(state.current) || schedule.getMakespan() != state.currentMakespan) {
+        throw std::invalid_argument("Checkpoint does not fit the instance");
+    }
+
+    current = state.current;
+    currentMakespan = state.currentMakespan;
+    best = state.best;
+    bestMakespan = state.bestMakespan;
+    tabu.assign(state.tabu.begin(), state.tabu.end());
+    nextNeighborhood = state.nextNeighborhood;
+    statistics = state.statistics;
+    rng = restored;
+    if (elites) {
+        elites->restore(state.elites);
+    }
+}
+
+/**
+ * Builds a block of up to blockSize positions centred on a position.
+ *
+ * Args:
+ *   machine: Machine index.
+ *   center: Position to cover.
+ *
+ * Returns:
+ *   Block on the machine.
+ */
+LNSEngine::Block LNSEngine::blockAround(int machine, int center) const {
+    int size = static_cast<int>(current[machine].size());
+    int length = std::min(config.blockSize, size);
+    int start = std::max(0, std::min(center - length / 2, size - length));
+    return Block{machine, start, length};
+}
+
+/**
+ * Checks whether a block was recently tried without success.
+ *
+ * Args:
+ *   block: Block to check.
+ *
+ * Returns:
+ *   True if the block is tabu.
+ */
+bool LNSEngine::isTabu(const Block& block) const {
+    uint64_t key = static_cast<uint64_t>(block.machine) << 32 | static_cast<uint32_t>(block.start);
+    return std::find(tabu.begin(), tabu.end(), key) != tabu.end();
+}
+
+/**
+ * Picks non-overlapping blocks for one subproblem.
+ *
+ * Args:
+ *   type: Neighbourhood type.
+ *   usedMachines: Machines already taken this iteration; updated.
+ *
+ * Returns:
+ *   Chosen blocks, empty if none could be placed.
+ */
+std::vector<LNSEngine::Block> LNSEngine::chooseBlocks(NeighborhoodType type, std::vector<char>& usedMachines) {
+    std::vector<Block> blocks;
+    auto usable = [&](int machine) {
+        return !usedMachines[machine] && current[machine].size() >= 2;
+    };
+    auto take = [&](const Block& block) {
+        if (static_cast<int>(blocks.size()) < config.machinesPerSubproblem && usable(block.machine) && !isTabu(block)) {
+            usedMachines[block.machine] = 1;
+            blocks.push_back(block);
+        }
+    };
+
+    std::vector<int> machines;
+    for (int m = 0; m < instance.getNumMachines(); ++m) {
+        if (usable(m)) machines.push_back(m);
+    }
+    if (machines.empty()) {
+        return blocks;
+    }
+    std::shuffle(machines.begin(), machines.end(), rng);
+
+    switch (type) {
+        case NeighborhoodType::TimeWindow: {
+            int time = static_cast<int>(std::uniform_int_distribution<int>(0, std::max(0, currentMakespan - 1))(rng));
+            for (int m : machines) {
+                // Machine sequences are ordered by start time
+                const auto& sequence = current[m];
+                auto it = std::upper_bound(sequence.begin(), sequence.end(), time,
+                                           [this](int t, int op) { return t < schedule.startTime(op); });
+                int center = std::max(0, static_cast<int>(it - sequence.begin()) - 1);
+                take(blockAround(m, center));
+            }
+            break;
+        }
+        case NeighborhoodType::Machines: {
+            for (int m : machines) {
+                int size = static_cast<int>(current[m].size());
+                take(blockAround(m, std::uniform_int_distribution<int>(0, size - 1)(rng)));
+            }
+            break;
+        }
+        case NeighborhoodType::Jobs: {
+            int job = std::uniform_int_distribution<int>(0, instance.getNumJobs() - 1)(rng);
+            std::vector<int> ops;
+            for (int op = instance.jobStart(job); op < instance.jobStart(job + 1); ++op) ops.push_back(op);
+            std::shuffle(ops.begin(), ops.end(), rng);
+            for (int op : ops) {
+                if (usable(instance.machine(op))) {
+                    take(blockAround(instance.machine(op), schedule.machinePosition(op)));
+                }
+            }
+            break;
+        }
+    }
+    return blocks;
+}
+
+/**
+ * Re-sequences the blocks of one subproblem exactly, within the node limit.
+ *
+ * Args:
+ *   base: Schedule to improve.
+ *   baseMakespan: Its makespan.
+ *   blocks: Blocks to free.
+ *
+ * Returns:
+ *   Best block orders found.
+ */
+LNSEngine::SubproblemResult LNSEngine::solveSubproblem(const MachineSequences& base, int baseMakespan,
+                                                       const std::vector<Block>& blocks) const {
+    std::vector<BlockSearch::Block> freeBlocks;
+    for (const auto& block : blocks) {
+        freeBlocks.push_back(BlockSearch::Block{block.machine, block.start, block.length, 0});
+    }
+
+    BlockSearch search(instance, base, config.nodeLimit);
+    search.run(freeBlocks, baseMakespan);
+
+    SubproblemResult result{blocks, {}, -1, search.getNodes(), search.isComplete()};
+    if (search.improved()) {
+        result.orders = search.getBestOrders();
+        result.makespan = search.getBestMakespan();
+    }
+    return result;
+}
+
+/**
+ * Merges improved subproblems into the current schedule.
+ *
+ * Args:
+ *   results: Subproblem outcomes of one iteration.
+ *
+ * Returns:
+ *   True if the current schedule changed.
+ */
+bool LNSEngine::mergeResults(std::vector<SubproblemResult>& results) {
+    std::sort(results.begin(), results.end(), [](const SubproblemResult& a, const SubproblemResult& b) {
+        return a.makespan < b.makespan;
+    });
+
+    bool changed = false;
+    for (const auto& result : results) {
+        if (result.makespan < 0) continue;
+
+        MachineSequences candidate = current;
+        for (size_t b = 0; b < result.blocks.size(); ++b) {
+            const Block& block = result.blocks[b];
+            std::copy(result.orders[b].begin(), result.orders[b].end(), candidate[block.machine].begin() + block.start);
+        }
+
+        // Subproblems share jobs, so a merge can still create a cycle or lose ground
+        if (schedule.load(candidate) && schedule.getMakespan() <= currentMakespan) {
+            current = std::move(candidate);
+            currentMakespan = schedule.getMakespan();
+            changed = true;
+        } else {
+            schedule.load(current);
+        }
+    }
+    return changed;
+}
+
+/**
+ * Runs LNS iterations from the current schedule.
+ *
+ * Args:
+ *   iterations: Number of iterations.
+ *
+ * Returns:
+ *   Best makespan found so far.
+ */
+int LNSEngine::runIterations(int iterations) {
+    if (current.empty()) {
+        throw std::runtime_error("LNS engine has no schedule; call reset first");
+    }
+    const NeighborhoodType types[] = {NeighborhoodType::TimeWindow, NeighborhoodType::Machines, NeighborhoodType::Jobs};
+
+    for (int iteration = 0; iteration < iterations; ++iteration) {
+        // One subproblem per worker, on disjoint machines
+        std::vector<char> usedMachines(instance.getNumMachines(), 0);
+        std::vector<std::vector<Block>> subproblems;
+        for (int s = 0; s < workers->getThreadCount(); ++s) {
+            std::vector<Block> blocks = chooseBlocks(types[nextNeighborhood], usedMachines);
+            nextNeighborhood = (nextNeighborhood + 1) % 3;
+            if (!blocks.empty()) subproblems.push_back(std::move(blocks));
+        }
+        if (subproblems.empty()) {
+            // Every block on offer is tabu; start afresh next iteration
+            tabu.clear();
+            ++statistics.iterations;
+            continue;
+        }
+
+        std::vector<std::future<SubproblemResult>> futures;
+        for (const auto& blocks : subproblems) {
+            futures.push_back(workers->submit([this, &blocks]() {
+                return solveSubproblem(current, currentMakespan, blocks);
+            }));
+        }
+        std::vector<SubproblemResult> results;
+        for (auto& future : futures) {
+            results.push_back(future.get());
+            statistics.nodes += results.back().nodes;
+            statistics.provenOptimal += results.back().complete ? 1 : 0;
+        }
+        statistics.subproblems += static_cast<long>(results.size());
+
+        // Remember fruitless blocks so the next iterations look elsewhere
+        for (const auto& result : results) {
+            if (result.makespan >= 0) continue;
+            for (const auto& block : result.blocks) {
+                tabu.push_back(static_cast<uint64_t>(block.machine) << 32 | static_cast<uint32_t>(block.start));
+            }
+        }
+        while (static_cast<int>(tabu.size()) > config.tabuTenure) {
+            tabu.pop_front();
+        }
+
+        if (mergeResults(results)) {
+            tabu.clear();
+            if (elites) {
+                elites->tryInsert(current, currentMakespan);
+            }
+            if (currentMakespan < bestMakespan) {
+                best = current;
+                bestMakespan = currentMakespan;
+                ++statistics.improvements;
+            }
+        }
+        ++statistics.iterations;
+    }
+    return bestMakespan;
+}
@@ -0,0 +1,388 @@
+#include "parameter_tuner.hpp"
+#include "lns_engine.hpp"
+#include "sequence_hash.hpp"
+#include "solver.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <cmath>
+#include <future>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+namespace {
+
+/**
+ * Quantile of the standard normal distribution (Acklam's approximation,
+ * relative error below 1.2e-9).
+ */
+double normalQuantile(double p) {
+    static const double a[] = {-3.969683028665376e+01, 2.209460984245205e+02, -2.759285104469687e+02,
+                               1.383577518672690e+02, -3.066479806614716e+01, 2.506628277459239e+00};
+    static const double b[] = {-5.447609879822406e+01, 1.615858368580409e+02, -1.556989798598866e+02,
+                               6.680131188771972e+01, -1.328068155288572e+01};
+    static const double c[] = {-7.784894002430293e-03, -3.223964580411365e-01, -2.400758277161838e+00,
+                               -2.549732539343734e+00, 4.374664141464968e+00, 2.938163982698783e+00};
+    static const double d[] = {7.784695709041462e-03, 3.224671290700398e-01, 2.445134137142996e+00,
+                               3.754408661907416e+00};
+    const double low = 0.02425;
+    if (p < low) {
+        double q = std::sqrt(-2 * std::log(p));
+        return (((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+               ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1);
+    }
+    if (p > 1 - low) {
+        return -normalQuantile(1 - p);
+    }
+    double q = p - 0.5;
+    double r = q * q;
+    return (((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r + a[5]) * q /
+           (((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r + b[4]) * r + 1);
+}
+
+/**
+ * Quantile of the chi-squared distribution (Wilson-Hilferty).
+ */
+double chiSquaredQuantile(double p, double df) {
+    double z = normalQuantile(p);
+    double h = 2.0 / (9.0 * df);
+    return df * std::pow(1.0 - h + z * std::sqrt(h), 3);
+}
+
+/**
+ * Quantile of Student's t distribution (Cornish-Fisher expansion).
+ */
+double studentQuantile(double p, double df) {
+    double z = normalQuantile(p);
+    double z2 = z * z;
+    return z + z * (z2 + 1) / (4 * df) + z * ((5 * z2 + 16) * z2 + 3) / (96 * df * df) +
+           z * (((3 * z2 + 19) * z2 + 17) * z2 - 15) / (384 * df * df * df);
+}
+
+/**
+ * Ranks the values of one block from 1, giving ties their average rank.
+ */
+std::vector<double> rankRow(const std::vector<double>& row) {
+    std::vector<int> order(row.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&row](int a, int b) { return row[a] < row[b]; });
+
+    std::vector<double> ranks(row.size());
+    for (size_t i = 0; i < order.size();) {
+        size_t j = i;
+        while (j + 1 < order.size() && row[order[j + 1]] == row[order[i]]) ++j;
+        double rank = (i + j) / 2.0 + 1.0;
+        for (size_t t = i; t <= j; ++t) ranks[order[t]] = rank;
+        i = j + 1;
+    }
+    return ranks;
+}
+
+} // namespace
+
+/**
+ * Constructor for ParameterTuner.
+ *
+ * Args:
+ *   training: Training instances; they are left scheduled with SPT.
+ *   settings: Race settings.
+ */
+ParameterTuner::ParameterTuner(const std::vector<std::shared_ptr<ProblemInstance>>& training,
+                               const RaceSettings& settings)
+    : settings(settings) {
+    if (training.empty()) {
+        throw std::invalid_argument("Tuning needs at least one training instance");
+    }
+    if (settings.candidates < 1 || settings.races < 1 || settings.firstTest < 1 || settings.maxBlocks < 1 ||
+        settings.alpha <= 0 || settings.alpha >= 1) {
+        throw std::invalid_argument("Invalid race settings");
+    }
+
+    Solver spt(SchedulingAlgorithm::SPT);
+    for (const auto& problem : training) {
+        auto result = spt.solve(problem);
+        instances.push_back(FlatInstance::fromProblem(result->problem));
+        starts.push_back(instances.back().machineSequences(result->problem));
+    }
+}
+
+/**
+ * Runs one engine on one block.
+ *
+ * Args:
+ *   config: Configuration to run.
+ *   block: Block index.
+ *
+ * Returns:
+ *   Best makespan found.
+ */
+int ParameterTuner::evaluate(const SolverConfig& config, int block) const {
+    size_t instance = static_cast<size_t>(block) % instances.size();
+    LNSConfig lns = config.lns;
+    lns.threads = 1;
+    lns.seed = settings.seed ^ SequenceHasher::key(block, 0);
+
+    LNSEngine engine(instances[instance], lns);
+    engine.reset(starts[instance]);
+    return engine.runIterations(config.lnsIterations);
+}
+
+/**
+ * Races fixed candidates against each other.
+ *
+ * Args:
+ *   candidates: Configurations to race.
+ *   firstBlock: Index of the first block.
+ *   budget: Engine runs available; 0 = no limit.
+ *
+ * Returns:
+ *   Surviving configurations and the work done.
+ */
+RaceResult ParameterTuner::race(const std::vector<SolverConfig>& candidates, int firstBlock, long budget) {
+    if (candidates.empty()) {
+        throw std::invalid_argument("Race needs at least one candidate");
+    }
+
+    std::vector<int> alive(candidates.size());
+    std::iota(alive.begin(), alive.end(), 0);
+    std::vector<std::vector<double>> costs; // costs[block][candidate]
+    RaceResult result;
+
+    ThreadPool workers(settings.threads);
+    while (result.blocks < settings.maxBlocks && alive.size() > 1) {
+        // Evaluate several blocks at once when survivors alone cannot fill the pool
+        long aliveCount = static_cast<long>(alive.size());
+        long batch = std::max(1L, workers.getThreadCount() / aliveCount);
+        batch = std::min(batch, static_cast<long>(settings.maxBlocks - result.blocks));
+        if (budget > 0) {
+            batch = std::min(batch, (budget - result.evaluations) / aliveCount);
+        }
+        if (batch <= 0) {
+            break;
+        }
+
+        std::vector<std::vector<std::future<int>>> runs(batch);
+        for (long b = 0; b < batch; ++b) {
+            int block = firstBlock + result.blocks + static_cast<int>(b);
+            for (int index : alive) {
+                const SolverConfig& config = candidates[index];
+                runs[b].push_back(workers.submit([this, &config, block]() { return evaluate(config, block); }));
+            }
+        }
+
+        std::vector<int> evaluated = alive;
+        for (long b = 0; b < batch; ++b) {
+            std::vector<double> row(candidates.size(), std::numeric_limits<double>::quiet_NaN());
+            for (size_t i = 0; i < evaluated.size(); ++i) {
+                row[evaluated[i]] = runs[b][i].get();
+            }
+            costs.push_back(row);
+            result.evaluations += aliveCount;
+            ++result.blocks;
+            if (result.blocks < settings.firstTest || alive.size() < 2) {
+                continue;
+            }
+
+            std::vector<std::vector<double>> aliveCosts;
+            for (const auto& blockCosts : costs) {
+                std::vector<double> aliveRow;
+                for (int index : alive) aliveRow.push_back(blockCosts[index]);
+                aliveCosts.push_back(aliveRow);
+            }
+            std::vector<bool> keep = friedmanSurvivors(aliveCosts, settings.alpha);
+            std::vector<int> survivors;
+            for (size_t i = 0; i < alive.size(); ++i) {
+                if (keep[i]) survivors.push_back(alive[i]);
+            }
+            if (settings.verbose && survivors.size() < alive.size()) {
+                std::cout << "  block " << result.blocks << ": " << survivors.size() << " of "
+                          << alive.size() << " candidates survive" << std::endl;
+            }
+            alive = survivors;
+        }
+    }
+
+    // Order survivors by rank sum over all blocks, then by mean cost
+    std::vector<double> rankSum(candidates.size(), 0.0);
+    std::vector<double> costSum(candidates.size(), 0.0);
+    for (const auto& blockCosts : costs) {
+        std::vector<double> aliveRow;
+        for (int index : alive) aliveRow.push_back(blockCosts[index]);
+        std::vector<double> ranks = rankRow(aliveRow);
+        for (size_t i = 0; i < alive.size(); ++i) {
+            rankSum[alive[i]] += ranks[i];
+            costSum[alive[i]] += aliveRow[i];
+        }
+    }
+    std::stable_sort(alive.begin(), alive.end(), [&](int a, int b) {
+        if (rankSum[a] != rankSum[b]) return rankSum[a] < rankSum[b];
+        return costSum[a] < costSum[b];
+    });
+
+    for (int index : alive) {
+        result.survivors.push_back(candidates[index]);
+    }
+    result.best = result.survivors.front();
+    return result;
+}
+
+/**
+ * Runs iterated races over the given ranges, starting from a base config.
+ *
+ * Args:
+ *   base: Values of keys not being tuned, and the first candidate.
+ *   ranges: Ranges to search.
+ *
+ * Returns:
+ *   Result of the last race, with work summed over all races.
+ */
+RaceResult ParameterTuner::tune(const SolverConfig& base, const std::vector<ParameterRange>& ranges) {
+    for (const auto& range : ranges) {
+        SolverConfig check = base;
+        check.setValue(range.key, range.minValue);
+        check.setValue(range.key, range.maxValue);
+        if (range.minValue > range.maxValue || (range.logScale && range.minValue <= 0)) {
+            throw std::invalid_argument("Invalid range for " + range.key);
+        }
+    }
+
+    std::mt19937_64 rng(settings.seed);
+    std::vector<SolverConfig> elites = {base};
+    long raceBudget = settings.budget > 0 ? settings.budget / settings.races : 0;
+    RaceResult total;
+
+    for (int r = 0; r < settings.races; ++r) {
+        // The first race samples uniformly, later ones around the elites
+        double spread = r == 0 ? 0.0 : 0.5 * std::pow(0.5, r);
+        std::vector<SolverConfig> candidates = elites;
+        int attempts = 0;
+        while (static_cast<int>(candidates.size()) < settings.candidates && attempts++ < 20 * settings.candidates) {
+            const SolverConfig& parent = elites[rng() % elites.size()];
+            SolverConfig candidate = sample(parent, ranges, spread, rng);
+            if (std::find(candidates.begin(), candidates.end(), candidate) == candidates.end()) {
+                candidates.push_back(candidate);
+            }
+        }
+
+        RaceResult result = race(candidates, r * settings.maxBlocks, raceBudget);
+        total.blocks += result.blocks;
+        total.evaluations += result.evaluations;
+        total.best = result.best;
+        total.survivors = result.survivors;
+
+        size_t keep = static_cast<size_t>(std::max(1, settings.candidates / 2));
+        elites.assign(result.survivors.begin(), result.survivors.begin() + std::min(keep, result.survivors.size()));
+
+        if (settings.verbose) {
+            std::cout << "Race " << (r + 1) << "/" << settings.races << ": " << candidates.size()
+                      << " candidates, " << result.blocks << " blocks, " << result.survivors.size()
+                      << " survivors" << std::endl;
+        }
+    }
+    return total;
+}
+
+/**
+ * Applies the Friedman test and its post-hoc comparison to a cost matrix.
+ *
+ * Args:
+ *   costs: costs[block][candidate], lower is better.
+ *   alpha: Significance level.
+ *
+ * Returns:
+ *   For each candidate, whether it survives.
+ */
+std::vector<bool> ParameterTuner::friedmanSurvivors(const std::vector<std::vector<double>>& costs, double alpha) {
+    const size_t k = costs.empty() ? 0 : costs.front().size();
+    std::vector<bool> keep(k, true);
+    const double b = static_cast<double>(costs.size());
+    if (k < 2 || costs.size() < 2) {
+        return keep;
+    }
+
+    std::vector<double> rankSum(k, 0.0);
+    double squares = 0.0;
+    for (const auto& row : costs) {
+        std::vector<double> ranks = rankRow(row);
+        for (size_t j = 0; j < k; ++j) {
+            rankSum[j] += ranks[j];
+            squares += ranks[j] * ranks[j];
+        }
+    }
+
+    const double kd = static_cast<double>(k);
+    double spread = squares - b * kd * (kd + 1) * (kd + 1) / 4.0;
+    if (spread <= 0) {
+        return keep; // every block is a complete tie
+    }
+    double deviation = 0.0;
+    for (double sum : rankSum) {
+        deviation += (sum - b * (kd + 1) / 2.0) * (sum - b * (kd + 1) / 2.0);
+    }
+    double statistic = (kd - 1) * deviation / spread;
+    if (statistic <= chiSquaredQuantile(1 - alpha, kd - 1)) {
+        return keep;
+    }
+
+    // Conover's post-hoc comparison against the best rank sum
+    double df = (b - 1) * (kd - 1);
+    double scale = 2 * b * std::max(0.0, 1 - statistic / (b * (kd - 1))) * spread / df;
+    double critical = studentQuantile(1 - alpha / 2, df) * std::sqrt(scale);
+    double best = *std::min_element(rankSum.begin(), rankSum.end());
+    for (size_t j = 0; j < k; ++j) {
+        keep[j] = rankSum[j] - best <= critical;
+    }
+    return keep;
+}
+
+/**
+ * Gets the ranges searched by default.
+ *
+ * Returns:
+ *   Ranges for the LNS parameters.
+ */
+std::vector<ParameterRange> ParameterTuner::getDefaultRanges() {
+    return {
+        {"block_size", 3, 10, false},
+        {"machines_per_subproblem", 1, 4, false},
+        {"node_limit", 200, 20000, true},
+        {"tabu_tenure", 0, 64, false},
+    };
+}
+
+/**
+ * Samples one candidate, uniformly or around a parent.
+ *
+ * Args:
+ *   parent: Config to start from.
+ *   ranges: Ranges to sample.
+ *   spread: 0 for uniform sampling, else the standard deviation as a
+ *           fraction of each range.
+ *   rng: Random engine state.
+ *
+ * Returns:
+ *   Sampled config.
+ */
+SolverConfig ParameterTuner::sample(const SolverConfig& parent, const std::vector<ParameterRange>& ranges,
+                                    double spread, std::mt19937_64& rng) {
+    SolverConfig config = parent;
+    for (const auto& range : ranges) {
+        // Sample in log space for log-scaled ranges
+        auto forward = [&range](double v) { return range.logScale ? std::log(v) : v; };
+        auto backward = [&range](double v) { return range.logScale ? std::exp(v) : v; };
+        double low = forward(static_cast<double>(range.minValue));
+        double high = forward(static_cast<double>(range.maxValue));
+
+        double value;
+        if (spread <= 0) {
+            value = std::uniform_real_distribution<double>(low, high)(rng);
+        } else {
+            double centre = forward(static_cast<double>(parent.getValue(range.key)));
+            value = std::normal_distribution<double>(centre, spread * (high - low))(rng);
+        }
+        long rounded = std::lround(backward(std::min(high, std::max(low, value))));
+        config.setValue(range.key, std::min(range.maxValue, std::max(range.minValue, rounded)));
+    }
+    return config;
+}
@@ -1,4 +1,11 @@
 #include "parser.hpp"
+#include "binary_instance.hpp"
+#include "binary_solution.hpp"
+#include "fast_parser.hpp"
+#include "mapped_file.hpp"
+#include "solution_reader.hpp"
+#include <cstring>
+#include <string_view>
 
 /**
  * Parses a JSSP instance from file.
@@ -10,55 +17,24 @@
  *   Parsed problem instance.
  */
 std::shared_ptr<ProblemInstance> Parser::parseFile(const std::string& filename) {
-    std::ifstream file(filename);
-    if (!file.is_open()) {
-        throw std::runtime_error("Could not open file: " + filename);
-    }
-    
-    std::shared_ptr<ProblemInstance> problem = std::make_shared<ProblemInstance>();
-    
-    int numJobs, numMachines;
-    if (!(file >> numJobs >> numMachines)) {
-        throw std::runtime_error("No valid operations found in file");
-    }
-    
-    if (numJobs <= 0 || numMachines <= 0) {
-        throw std::runtime_error("Invalid number of jobs or machines");
-    }
-    
-    problem->createJobs(numJobs);
-    problem->createMachines(numMachines);
-    
-    // Read operations
-    int jobId, machineId, processingTime;
-    int operationCount = 0;
-    
-    while (file >> jobId >> machineId >> processingTime) {
-        if (jobId < 0 || jobId >= numJobs || 
-            machineId < 0 || machineId >= numMachines || 
-            processingTime <= 0) {
-            std::cerr << "Warning: Invalid operation data (Job: " << jobId 
-                     << ", Machine: " << machineId 
-                     << ", Time: " << processingTime << ")" << std::endl;
-            continue;
-        }
-        
-        auto operation = std::make_shared<Operation>(jobId, machineId, processingTime, operationCount);
-        auto job = problem->getJob(jobId);
-        if (job) {
-            job->addOperation(operation);
-        }
-        operationCount++;
+    if (BinaryInstance::isBinary(filename)) {
+        auto problem = BinaryInstance::load(filename, true).toProblem();
+        std::cout << "Loaded binary problem: " << problem->numJobs << " jobs, " << problem->numMachines
+                  << " machines, " << problem->getTotalOperations() << " operations" << std::endl;
+        return problem;
     }
     
-    file.close();
+    ParseReport report;
+    std::shared_ptr<ProblemInstance> problem = FastParser::parseFile(filename, report);
     
-    if (operationCount == 0) {
-        throw std::runtime_error("No valid operations found in file");
+    if (!report.ok()) {
+        const ParseError& first = report.errors.front();
+        std::cerr << "Warning: skipped " << report.skipped << " invalid operation line(s), first at line "
+                  << first.line << ": " << first.message << std::endl;
     }
     
-    std::cout << "Parsed problem: " << numJobs << " jobs, " << numMachines 
-              << " machines, " << operationCount << " operations" << std::endl;
+    std::cout << "Parsed problem: " << problem->numJobs << " jobs, " << problem->numMachines 
+              << " machines, " << report.operations << " operations" << std::endl;
     
     return problem;
 }
@@ -154,32 +130,34 @@ std::shared_ptr<ProblemInstance> Parser::generateSimpleProblem() {
     return problem;
 }
 
-// Load a solution from a file (supports TEXT, JSON, and XML formats)
+// Load a solution from a file (supports TEXT, JSON, XML, and binary formats)
 std::shared_ptr<ScheduleResult> Parser::loadSolution(const std::string& filename) {
-    std::ifstream file(filename);
-    if (!file.is_open()) {
-        throw std::runtime_error("Could not open file: " + filename);
-    }
-    
-    // Read first few lines to detect format
-    std::string firstLine;
-    std::getline(file, firstLine);
-    file.close();
-    
-    // Detect format based on content
-    if (firstLine.find("JSSP SOLUTION EXPORT") != std::string::npos) {
-        return loadTextSolution(filename);
-    } else if (firstLine.find("<?xml") != std::string::npos) {
-        return loadXMLSolution(filename);
-    } else if (firstLine.find("{") != std::string::npos || firstLine.find("\"problem\"") != std::string::npos) {
-        return loadJSONSolution(filename);
+    // Map once; the format is sniffed from the same buffer the reader parses
+    MappedFile file(filename);
+    const char* data = file.data();
+    size_t size = file.size();
+    
+    // Binary solutions are recognized by their magic
+    if (BinarySolution::hasMagic(data, size)) {
+        return BinarySolution::decode(data, size);
+    }
+    
+    // Detect format based on the first line
+    const char* newline = size > 0 ? static_cast<const char*>(std::memchr(data, '\n', size)) : nullptr;
+    std::string_view firstLine(data, newline ? newline - data : size);
+    if (firstLine.find("JSSP SOLUTION EXPORT") != std::string_view::npos) {
+        return SolutionReader::readText(data, size);
+    } else if (firstLine.find("<?xml") != std::string_view::npos) {
+        return SolutionReader::readXML(data, size);
+    } else if (firstLine.find("{") != std::string_view::npos || firstLine.find("\"problem\"") != std::string_view::npos) {
+        return SolutionReader::readJSON(data, size);
     } else {
         throw std::runtime_error("Unknown solution file format");
     }
 }
 
 /**
- * Loads a solution from TEXT format.
+ * Loads a solution from TEXT format with SolutionReader's line parser.
  *
  * Args:
  *   filename: Path to TEXT solution file.
@@ -188,156 +166,12 @@ std::shared_ptr<ScheduleResult> Parser::loadSolution(const std::string& filename
  *   Loaded schedule result.
  */
 std::shared_ptr<ScheduleResult> Parser::loadTextSolution(const std::string& filename) {
-    std::ifstream file(filename);
-    if (!file.is_open()) {
-        throw std::runtime_error("Could not open file: " + filename);
-    }
-    
-    auto result = std::make_shared<ScheduleResult>();
-    std::string line;
-    
-    // Skip header
-    std::getline(file, line); // "JSSP SOLUTION EXPORT"
-    std::getline(file, line); // "==================="
-    std::getline(file, line); // empty line
-    
-    // Parse problem metadata
-    std::getline(file, line); // "PROBLEM METADATA:"
-    std::getline(file, line); // "Jobs: X"
-    try {
-        result->problem.numJobs = std::stoi(line.substr(line.find(":") + 1));
-    } catch (const std::exception&) { result->problem.numJobs = 0; }
-    
-    std::getline(file, line); // "Machines: X"
-    try {
-        result->problem.numMachines = std::stoi(line.substr(line.find(":") + 1));
-    } catch (const std::exception&) { result->problem.numMachines = 0; }
-    
-    result->problem.createJobs(result->problem.numJobs);
-    result->problem.createMachines(result->problem.numMachines);
-    
-    // Skip to scheduling results
-    while (std::getline(file, line) && line != "SCHEDULING RESULTS:");
-    
-    // Parse operations
-    while (std::getline(file, line) && line != "MACHINE SCHEDULES:") {
-        if (line.find("Job ") == 0) {
-            // Parse job line
-            int jobId = 0;
-            try {
-                jobId = std::stoi(line.substr(4, line.find(":") - 4));
-            } catch (const std::exception&) { continue; }
-            
-            auto job = result->problem.getJob(jobId);
-            
-            // Parse operations for this job
-            while (std::getline(file, line) && line.find("  Operation ") == 0) {
-                // Parse operation line: " Operation X: Machine Y [start-end]"
-                size_t opStart = line.find("Operation ") + 10;
-                size_t opEnd = line.find(":", opStart);
-                int operationId = 0;
-                try {
-                    operationId = std::stoi(line.substr(opStart, opEnd - opStart));
-                } catch (const std::exception&) { continue; }
-                
-                size_t machineStart = line.find("Machine ") + 8;
-                size_t machineEnd = line.find(" ", machineStart);
-                int machineId = 0;
-                try {
-                    machineId = std::stoi(line.substr(machineStart, machineEnd - machineStart));
-                } catch (const std::exception&) { continue; }
-                
-                size_t timeStart = line.find("[") + 1;
-                size_t timeEnd = line.find("]", timeStart);
-                std::string timeStr = line.substr(timeStart, timeEnd - timeStart);
-                size_t dashPos = timeStr.find("-");
-                int startTime = 0, endTime = 0;
-                try {
-                    startTime = std::stoi(timeStr.substr(0, dashPos));
-                    endTime = std::stoi(timeStr.substr(dashPos + 1));
-                } catch (const std::exception&) { continue; }
-                
-                auto operation = std::make_shared<Operation>(jobId, machineId, endTime - startTime, operationId);
-                operation->setScheduled(startTime, endTime);
-                job->addOperation(operation);
-            }
-        }
-    }
-    
-    // Parse machine schedules
-    while (std::getline(file, line) && line != "PERFORMANCE METRICS:") {
-        if (line.find("Machine ") == 0) {
-            int machineId = 0;
-            try {
-                machineId = std::stoi(line.substr(8, line.find(":") - 8));
-            } catch (const std::exception&) { continue; }
-            
-            auto machine = result->problem.getMachine(machineId);
-            if (!machine) continue;
-            
-            while (std::getline(file, line) && line.find("  Job ") == 0) {
-                // Parse operation line: " Job X Operation Y [start-end]"
-                size_t jobStart = line.find("Job ") + 4;
-                size_t jobEnd = line.find(" Operation", jobStart);
-                int jobId = 0;
-                try {
-                    jobId = std::stoi(line.substr(jobStart, jobEnd - jobStart));
-                } catch (const std::exception&) { continue; }
-                
-                size_t opStart = line.find("Operation ") + 10;
-                size_t opEnd = line.find(" [", opStart);
-                int operationId = 0;
-                try {
-                    operationId = std::stoi(line.substr(opStart, opEnd - opStart));
-                } catch (const std::exception&) { continue; }
-                
-                size_t timeStart = line.find("[") + 1;
-                size_t timeEnd = line.find("]", timeStart);
-                std::string timeStr = line.substr(timeStart, timeEnd - timeStart);
-                size_t dashPos = timeStr.find("-");
-                int startTime = 0, endTime = 0;
-                try {
-                    startTime = std::stoi(timeStr.substr(0, dashPos));
-                    endTime = std::stoi(timeStr.substr(dashPos + 1));
-                } catch (const std::exception&) { continue; }
-                
-                auto operation = std::make_shared<Operation>(jobId, machineId, endTime - startTime, operationId);
-                operation->setScheduled(startTime, endTime);
-                machine->scheduledOperations.push_back(operation);
-                machine->availableTime = endTime;
-            }
-        }
-    }
-    
-    // Parse performance metrics
-    while (std::getline(file, line)) {
-        if (line.find("Makespan: ") == 0) {
-            try {
-                result->makespan = std::stoi(line.substr(10));
-            } catch (const std::exception&) {
-                result->makespan = 0;
-            }
-        } else if (line.find("Total Completion Time: ") == 0) {
-            try {
-                result->totalCompletionTime = std::stoi(line.substr(23));
-            } catch (const std::exception&) {
-                result->totalCompletionTime = 0;
-            }
-        } else if (line.find("Average Flow Time: ") == 0) {
-            try {
-                result->avgFlowTime = std::stod(line.substr(19));
-            } catch (const std::exception&) {
-                result->avgFlowTime = 0.0;
-            }
-        }
-    }
-    
-    file.close();
-    return result;
+    MappedFile file(filename);
+    return SolutionReader::readText(file.data(), file.size());
 }
 
 /**
- * Loads a solution from JSON format.
+ * Loads a solution from JSON format with SolutionReader's SAX handler.
  *
  * Args:
  *   filename: Path to JSON solution file.
@@ -346,80 +180,12 @@ std::shared_ptr<ScheduleResult> Parser::loadTextSolution(const std::string& file
  *   Loaded schedule result.
  */
 std::shared_ptr<ScheduleResult> Parser::loadJSONSolution(const std::string& filename) {
-    std::ifstream file(filename);
-    if (!file.is_open()) {
-        throw std::runtime_error("Could not open file: " + filename);
-    }
-    
-    json j;
-    file >> j;
-    file.close();
-    
-    auto result = std::make_shared<ScheduleResult>();
-    
-    // Parse problem metadata
-    result->problem.numJobs = j["problem"]["numJobs"];
-    result->problem.numMachines = j["problem"]["numMachines"];
-    
-    result->problem.createJobs(result->problem.numJobs);
-    result->problem.createMachines(result->problem.numMachines);
-    
-    // Parse operations
-    for (const auto& opJson : j["operations"]) {
-        int jobId = opJson["jobId"];
-        int machineId = opJson["machineId"];
-        int processingTime = opJson["processingTime"];
-        int operationId = opJson["operationId"];
-        int startTime = opJson["startTime"];
-        int endTime = opJson["endTime"];
-        
-        auto operation = std::make_shared<Operation>(jobId, machineId, processingTime, operationId);
-        operation->setScheduled(startTime, endTime);
-        
-        auto job = result->problem.getJob(jobId);
-        if (job) {
-            job->addOperation(operation);
-        }
-    }
-    
-    // Parse machine schedules
-    for (const auto& machineJson : j["machines"]) {
-        int machineId = machineJson["machineId"];
-        auto machine = result->problem.getMachine(machineId);
-        if (machine) {
-            machine->availableTime = machineJson["availableTime"];
-            
-            for (const auto& opJson : machineJson["scheduledOperations"]) {
-                int jobId = opJson["jobId"];
-                int operationId = opJson["operationId"];
-                int startTime = opJson["startTime"];
-                int endTime = opJson["endTime"];
-                
-                // Find the operation in the job
-                auto job = result->problem.getJob(jobId);
-                if (job) {
-                    for (const auto& operation : job->operations) {
-                        if (operation->operationId == operationId) {
-                            operation->setScheduled(startTime, endTime);
-                            machine->scheduledOperations.push_back(operation);
-                            break;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    
-    // Parse metrics
-    result->makespan = j["metrics"]["makespan"];
-    result->totalCompletionTime = j["metrics"]["totalCompletionTime"];
-    result->avgFlowTime = j["metrics"]["averageFlowTime"];
-    
-    return result;
+    MappedFile file(filename);
+    return SolutionReader::readJSON(file.data(), file.size());
 }
 
 /**
- * Loads a solution from XML format.
+ * Loads a solution from XML format with SolutionReader's pull parser.
  *
  * Args:
  *   filename: Path to XML solution file.
@@ -428,139 +194,20 @@ std::shared_ptr<ScheduleResult> Parser::loadJSONSolution(const std::string& file
  *   Loaded schedule result.
  */
 std::shared_ptr<ScheduleResult> Parser::loadXMLSolution(const std::string& filename) {
-    std::ifstream file(filename);
-    if (!file.is_open()) {
-        throw std::runtime_error("Could not open file: " + filename);
-    }
-    
-    // For simplicity, we'll use a basic string parsing approach
-    // In a production environment, you might want to use a proper XML parser
-    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
-    file.close();
-    
-    auto result = std::make_shared<ScheduleResult>();
-    
-    // Parse basic XML structure using string operations
-    // This is a simplified implementation - a real XML parser would be more robust
-    
-    // Extract problem metadata
-    result->problem.numJobs = extractIntFromXML(content, "numJobs");
-    result->problem.numMachines = extractIntFromXML(content, "numMachines");
-    
-    result->problem.createJobs(result->problem.numJobs);
-    result->problem.createMachines(result->problem.numMachines);
-    
-    // Parse operations
-    size_t opStart = 0;
-    while ((opStart = content.find("<operation>", opStart)) != std::string::npos) {
-        size_t opEnd = content.find("</operation>", opStart);
-        if (opEnd == std::string::npos) break;
-        std::string opContent = content.substr(opStart, opEnd - opStart + 12);
-        
-        int jobId = extractIntFromXML(opContent, "jobId");
-        int machineId = extractIntFromXML(opContent, "machineId");
-        int processingTime = extractIntFromXML(opContent, "processingTime");
-        int operationId = extractIntFromXML(opContent, "operationId");
-        int startTime = extractIntFromXML(opContent, "startTime");
-        int endTime = extractIntFromXML(opContent, "endTime");
-        
-        auto operation = std::make_shared<Operation>(jobId, machineId, processingTime, operationId);
-        operation->setScheduled(startTime, endTime);
-        
-        auto job = result->problem.getJob(jobId);
-        if (job) {
-            job->addOperation(operation);
-        }
-        
-        opStart = opEnd;
-    }
-    
-    // Parse machine schedules
-    size_t machineStart = 0;
-    while ((machineStart = content.find("<machine>", machineStart)) != std::string::npos) {
-        size_t machineEnd = content.find("</machine>", machineStart);
-        if (machineEnd == std::string::npos) break;
-        std::string machineContent = content.substr(machineStart, machineEnd - machineStart + 10);
-        
-        int machineId = extractIntFromXML(machineContent, "machineId");
-        auto machine = result->problem.getMachine(machineId);
-        if (machine) {
-            machine->availableTime = extractIntFromXML(machineContent, "availableTime");
-            
-            size_t opStart = 0;
-            while ((opStart = machineContent.find("<scheduledOperation>", opStart)) != std::string::npos) {
-                size_t opEnd = machineContent.find("</scheduledOperation>", opStart);
-                if (opEnd == std::string::npos) break;
-                std::string opContent = machineContent.substr(opStart, opEnd - opStart + 20);
-                
-                int jobId = extractIntFromXML(opContent, "jobId");
-                int operationId = extractIntFromXML(opContent, "operationId");
-                int startTime = extractIntFromXML(opContent, "startTime");
-                int endTime = extractIntFromXML(opContent, "endTime");
-                
-                // Find the operation in the job
-                auto job = result->problem.getJob(jobId);
-                if (job) {
-                    for (const auto& operation : job->operations) {
-                        if (operation->operationId == operationId) {
-                            operation->setScheduled(startTime, endTime);
-                            machine->scheduledOperations.push_back(operation);
-                            break;
-                        }
-                    }
-                }
-                
-                opStart = opEnd;
-            }
-        }
-        
-        machineStart = machineEnd;
-    }
-    
-    // Parse metrics
-    result->makespan = extractIntFromXML(content, "makespan");
-    result->totalCompletionTime = extractIntFromXML(content, "totalCompletionTime");
-    result->avgFlowTime = extractDoubleFromXML(content, "averageFlowTime");
-    
-    return result;
+    MappedFile file(filename);
+    return SolutionReader::readXML(file.data(), file.size());
 }
 
-// Helper function to extract integer from XML tag
-int Parser::extractIntFromXML(const std::string& content, const std::string& tag) {
-    std::string startTag = "<" + tag + ">";
-    std::string endTag = "</" + tag + ">";
-    
-    size_t startPos = content.find(startTag);
-    if (startPos == std::string::npos) return 0;
-    
-    startPos += startTag.length();
-    size_t endPos = content.find(endTag, startPos);
-    if (endPos == std::string::npos) return 0;
-    
-    std::string valueStr = content.substr(startPos, endPos - startPos);
-    try {
-        return std::stoi(valueStr);
-    } catch (const std::exception&) {
-        return 0;
-    }
-}
-
-// Helper function to extract double from XML tag
-double Parser::extractDoubleFromXML(const std::string& content, const std::string& tag) {
-    std::string startTag = "<" + tag + ">";
-    std::string endTag = "</" + tag + ">";
-    
-    size_t startPos = content.find(startTag);
-    if (startPos == std::string::npos) return 0.0;
-    
-    startPos += startTag.length();
-    size_t endPos = content.find(endTag, startPos);
-    if (endPos == std::string::npos) return 0.0;
-    
-    std::string valueStr = content.substr(startPos, endPos - startPos);
-    try {
-        return std::stod(valueStr);
-    } catch (const std::exception&) {
-        return 0.0;
-    }
+/**
+ * Loads a solution from the compact binary format.
+ *
+ * Args:
+ *   filename: Path to binary solution file.
+ *
+ * Returns:
+ *   Loaded schedule result.
+ */
+std::shared_ptr<ScheduleResult> Parser::loadBinarySolution(const std::string& filename) {
+    MappedFile file(filename);
+    return BinarySolution::decode(file.data(), file.size());
 }
@@ -0,0 +1,145 @@
+#include "path_relinking.hpp"
+#include "sequence_hash.hpp"
+#include "sequence_schedule.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+
+/**
+ * Constructor for PathRelinker.
+ *
+ * Args:
+ *   instance: Flat instance of the problem.
+ */
+PathRelinker::PathRelinker(const FlatInstance& instance)
+    : instance(instance), candidateLimit(32), maxSteps(0), cache(nullptr) {}
+
+/**
+ * Walks from initiating towards guiding and keeps the best intermediate.
+ *
+ * Args:
+ *   initiating: Start schedule; must be acyclic.
+ *   guiding: Target schedule over the same operations.
+ *   seed: Seed for candidate sampling.
+ *
+ * Returns:
+ *   Best intermediate schedule found.
+ */
+RelinkResult PathRelinker::relink(const MachineSequences& initiating, const MachineSequences& guiding,
+                                  uint64_t seed) const {
+    SequenceSchedule schedule(instance);
+    if (!schedule.load(initiating)) {
+        throw std::invalid_argument("Initiating schedule is cyclic");
+    }
+    long remaining = ElitePool::distance(initiating, guiding);
+    uint64_t hash = cache ? SequenceHasher::hash(initiating) : 0;
+
+    std::vector<int> guidePosition(instance.getNumOperations(), 0);
+    for (const auto& sequence : guiding) {
+        for (size_t p = 0; p < sequence.size(); ++p) {
+            guidePosition[sequence[p]] = static_cast<int>(p);
+        }
+    }
+
+    RelinkResult result{MachineSequences(), -1, 0};
+    std::mt19937_64 rng(seed);
+    std::vector<std::pair<int, int>> candidates; // (machine, position)
+
+    // Stop one swap short: the last step would reproduce the guide
+    while (remaining > 1 && (maxSteps == 0 || result.steps < maxSteps)) {
+        candidates.clear();
+        const MachineSequences& current = schedule.getSequences();
+        for (int m = 0; m < static_cast<int>(current.size()); ++m) {
+            for (int p = 0; p + 1 < static_cast<int>(current[m].size()); ++p) {
+                if (guidePosition[current[m][p]] > guidePosition[current[m][p + 1]]) {
+                    candidates.emplace_back(m, p);
+                }
+            }
+        }
+
+        int timed = static_cast<int>(candidates.size());
+        if (candidateLimit > 0 && timed > candidateLimit) {
+            for (int i = 0; i < candidateLimit; ++i) {
+                std::uniform_int_distribution<int> pick(i, timed - 1);
+                std::swap(candidates[i], candidates[pick(rng)]);
+            }
+            timed = candidateLimit;
+        }
+
+        // Time each swap and undo it; undoing an accepted swap cannot create a cycle.
+        // Cached schedules were acyclic when timed, so a hit needs no timing
+        int chosen = -1;
+        int chosenMakespan = 0;
+        uint64_t chosenDelta = 0;
+        for (int i = 0; i < timed; ++i) {
+            int m = candidates[i].first;
+            int p = candidates[i].second;
+            uint64_t delta = cache ? SequenceHasher::swapDelta(schedule.getSequences()[m], p, p + 1) : 0;
+            int makespan = 0;
+            if (!cache || !cache->lookup(hash ^ delta, makespan)) {
+                if (!schedule.swapAdjacent(m, p)) {
+                    continue;
+                }
+                makespan = schedule.getMakespan();
+                schedule.swapAdjacent(m, p);
+                if (cache) {
+                    cache->store(hash ^ delta, makespan);
+                }
+            }
+            if (chosen < 0 || makespan < chosenMakespan) {
+                chosen = i;
+                chosenMakespan = makespan;
+                chosenDelta = delta;
+            }
+        }
+        if (chosen < 0 || !schedule.swapAdjacent(candidates[chosen].first, candidates[chosen].second)) {
+            break;
+        }
+        hash ^= chosenDelta;
+        --remaining;
+        ++result.steps;
+        if (result.makespan < 0 || schedule.getMakespan() < result.makespan) {
+            result.makespan = schedule.getMakespan();
+            result.sequences = schedule.getSequences();
+        }
+    }
+    return result;
+}
+
+/**
+ * Relinks every pair of pool members in both directions on a thread pool.
+ *
+ * Args:
+ *   pool: Elite pool to read from and insert into.
+ *   threads: Worker count; 0 uses all hardware threads.
+ *   seed: Base seed; each path uses a derived seed.
+ *
+ * Returns:
+ *   Best makespan in the pool after the phase, or -1 if it is empty.
+ */
+int PathRelinker::runPhase(ElitePool& pool, int threads, uint64_t seed) const {
+    std::vector<EliteSolution> members = pool.snapshot();
+    if (members.empty()) {
+        return -1;
+    }
+
+    ThreadPool workers(threads);
+    std::vector<std::future<void>> paths;
+    for (size_t i = 0; i < members.size(); ++i) {
+        for (size_t j = 0; j < members.size(); ++j) {
+            if (i == j) continue;
+            uint64_t pathSeed = seed ^ SequenceHasher::key(static_cast<int>(i), static_cast<int>(j));
+            paths.push_back(workers.submit([this, &pool, &members, i, j, pathSeed]() {
+                RelinkResult result = relink(members[i].sequences, members[j].sequences, pathSeed);
+                if (result.makespan >= 0) {
+                    pool.tryInsert(result.sequences, result.makespan);
+                }
+            }));
+        }
+    }
+    for (auto& path : paths) {
+        path.get();
+    }
+    return pool.getBest().makespan;
+}
@@ -0,0 +1,383 @@
+#include "result_cache.hpp"
+#include "binary_solution.hpp"
+#include "mapped_file.hpp"
+#include "schedule_validator.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <unistd.h>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+const char* const ENTRY_EXTENSION = ".jsol";
+
+/**
+ * Two independent 64-bit hashes over a stream of values: FNV-1a and a
+ * multiply-xorshift mix. Together they make accidental key collisions
+ * negligible; hits are verified anyway.
+ */
+class KeyHash {
+public:
+    void add(uint64_t value) {
+        for (int shift = 0; shift < 64; shift += 8) {
+            fnv ^= (value >> shift) & 0xFF;
+            fnv *= 1099511628211ull;
+        }
+        mix = (mix ^ value) * 0xFF51AFD7ED558CCDull;
+        mix ^= mix >> 33;
+    }
+
+    void add(const std::string& text) {
+        add(static_cast<uint64_t>(text.size()));
+        for (unsigned char c : text) {
+            add(static_cast<uint64_t>(c));
+        }
+    }
+
+    std::string hex() const {
+        char text[33];
+        std::snprintf(text, sizeof(text), "%016llx%016llx", static_cast<unsigned long long>(fnv),
+                      static_cast<unsigned long long>(mix));
+        return text;
+    }
+
+private:
+    uint64_t fnv = 1469598103934665603ull;
+    uint64_t mix = 0x9E3779B97F4A7C15ull;
+};
+
+/**
+ * Short lowercase name of an algorithm, used as the key prefix.
+ */
+const char* algorithmToken(SchedulingAlgorithm algorithm) {
+    switch (algorithm) {
+        case SchedulingAlgorithm::FIFO: return "fifo";
+        case SchedulingAlgorithm::SPT: return "spt";
+        case SchedulingAlgorithm::LPT: return "lpt";
+        case SchedulingAlgorithm::LNS: return "lns";
+        case SchedulingAlgorithm::ISLANDS: return "islands";
+    }
+    return "unknown";
+}
+
+/**
+ * Checks that a cached schedule is for this instance: same jobs, with the
+ * same machines and processing times in the same order.
+ */
+bool sameInstance(const ProblemInstance& cached, const ProblemInstance& problem) {
+    if (cached.jobs.size() != problem.jobs.size() || cached.machines.size() != problem.machines.size()) {
+        return false;
+    }
+    for (size_t j = 0; j < problem.jobs.size(); ++j) {
+        const auto& expected = problem.jobs[j]->operations;
+        const auto& actual = cached.jobs[j]->operations;
+        if (actual.size() != expected.size()) {
+            return false;
+        }
+        for (size_t k = 0; k < expected.size(); ++k) {
+            if (actual[k]->machineId != expected[k]->machineId ||
+                actual[k]->processingTime != expected[k]->processingTime) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * Schedules the problem's own operations and machines as in a verified
+ * cached schedule, as the solver would have. The cached operations are
+ * renumbered in job order to find their counterparts, so the cached
+ * schedule must not be used afterwards.
+ */
+void applySchedule(ProblemInstance& cached, ProblemInstance& problem) {
+    std::vector<std::shared_ptr<Operation>> operations;
+    operations.reserve(problem.getTotalOperations());
+    for (size_t j = 0; j < problem.jobs.size(); ++j) {
+        const auto& sources = cached.jobs[j]->operations;
+        const auto& targets = problem.jobs[j]->operations;
+        for (size_t k = 0; k < targets.size(); ++k) {
+            targets[k]->setScheduled(sources[k]->startTime, sources[k]->endTime);
+            sources[k]->operationId = static_cast<int>(operations.size());
+            operations.push_back(targets[k]);
+        }
+    }
+    for (size_t m = 0; m < problem.machines.size(); ++m) {
+        const Machine& source = *cached.machines[m];
+        Machine& target = *problem.machines[m];
+        target.scheduledOperations.clear();
+        target.scheduledOperations.reserve(source.scheduledOperations.size());
+        for (const auto& entry : source.scheduledOperations) {
+            target.scheduledOperations.push_back(operations[entry->operationId]);
+        }
+        target.availableTime = source.availableTime;
+    }
+}
+
+} // namespace
+
+/**
+ * Opens a cache directory, creating it if needed, and indexes the entries
+ * already in it. Throws std::runtime_error if the directory cannot be
+ * created.
+ *
+ * Args:
+ *   directory: Cache directory.
+ *   maxBytes: Size limit of all entries together.
+ *   maxEntries: Entry limit; 0 for none.
+ */
+ResultCache::ResultCache(const std::string& directory, uint64_t maxBytes, size_t maxEntries)
+    : directory(directory), maxBytes(maxBytes), maxEntries(maxEntries), totalBytes(0), tempCounter(0) {
+    std::error_code error;
+    fs::create_directories(directory, error);
+    if (!fs::is_directory(directory)) {
+        throw std::runtime_error("Cannot create cache directory: " + directory);
+    }
+
+    // Index the existing entries from least to most recently used
+    std::vector<std::tuple<fs::file_time_type, std::string, uint64_t>> found;
+    for (const auto& file : fs::directory_iterator(directory, error)) {
+        if (file.is_regular_file(error) && file.path().extension() == ENTRY_EXTENSION) {
+            found.emplace_back(file.last_write_time(error), file.path().stem().string(), file.file_size(error));
+        }
+    }
+    std::sort(found.begin(), found.end());
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto& entry : found) {
+        touch(std::get<1>(entry), std::get<2>(entry));
+    }
+    evict();
+}
+
+/**
+ * Computes the cache key of a solve.
+ *
+ * Args:
+ *   problem: Problem instance.
+ *   algorithm: Scheduling algorithm.
+ *   config: Engine parameters; only part of the key for LNS and ISLANDS.
+ *
+ * Returns:
+ *   Key such as "spt-" followed by 32 hex digits.
+ */
+std::string ResultCache::makeKey(const ProblemInstance& problem, SchedulingAlgorithm algorithm,
+                                 const SolverConfig& config) {
+    KeyHash hash;
+    hash.add(static_cast<uint64_t>(problem.jobs.size()));
+    hash.add(static_cast<uint64_t>(problem.machines.size()));
+    for (const auto& job : problem.jobs) {
+        hash.add(static_cast<uint64_t>(job->operations.size()));
+        for (const auto& operation : job->operations) {
+            hash.add(static_cast<uint64_t>(static_cast<uint32_t>(operation->machineId)) << 32 |
+                     static_cast<uint32_t>(operation->processingTime));
+        }
+    }
+    hash.add(static_cast<uint64_t>(algorithm));
+    if (algorithm == SchedulingAlgorithm::LNS || algorithm == SchedulingAlgorithm::ISLANDS) {
+        hash.add(config.toString());
+    }
+    return std::string(algorithmToken(algorithm)) + "-" + hash.hex();
+}
+
+/**
+ * Looks up a key and, on a verified hit, schedules the problem's operations
+ * and machines as in the cached solution. On a miss the problem is left
+ * unchanged.
+ *
+ * Args:
+ *   key: Cache key from makeKey.
+ *   problem: Problem instance the key was computed from.
+ *
+ * Returns:
+ *   True on a hit.
+ */
+bool ResultCache::lookup(const std::string& key, ProblemInstance& problem) {
+    // Read and verify without the lock; another process may have written the entry
+    std::string path = pathOf(key);
+    std::error_code error;
+    bool found = fs::is_regular_file(path, error);
+    bool valid = false;
+    uint64_t bytes = 0;
+    std::shared_ptr<ScheduleResult> cached;
+    if (found) {
+        try {
+            MappedFile file(path);
+            bytes = file.size();
+            cached = BinarySolution::decode(file.data(), file.size());
+            valid = sameInstance(cached->problem, problem) && ScheduleValidator::validate(*cached).ok();
+        } catch (const std::exception&) {
+            valid = false;
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!found || !valid) {
+            stats.misses++;
+            if (found) {
+                stats.rejected++;
+            }
+            erase(key);
+            return false;
+        }
+        stats.hits++;
+        touch(key, bytes);
+    }
+    fs::last_write_time(path, fs::file_time_type::clock::now(), error);
+    applySchedule(cached->problem, problem);
+    return true;
+}
+
+/**
+ * Stores a solved schedule, then evicts entries beyond the limits. Throws
+ * std::runtime_error if the entry cannot be written.
+ *
+ * Args:
+ *   key: Cache key from makeKey.
+ *   result: Schedule of the instance the key was computed from.
+ */
+void ResultCache::store(const std::string& key, const ScheduleResult& result) {
+    std::string bytes = BinarySolution::encode(result);
+    std::string path = pathOf(key);
+    std::string temp;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        temp = path + ".tmp" + std::to_string(::getpid()) + "." + std::to_string(tempCounter++);
+    }
+
+    std::error_code error;
+    {
+        std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        out.close();
+        if (!out) {
+            fs::remove(temp, error);
+            throw std::runtime_error("Cannot write cache entry: " + temp);
+        }
+    }
+    fs::rename(temp, path, error);
+    if (error) {
+        fs::remove(temp, error);
+        throw std::runtime_error("Cannot write cache entry: " + path);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    stats.stores++;
+    touch(key, bytes.size());
+    evict();
+}
+
+/**
+ * Checks whether an entry is indexed, without verifying it or counting a
+ * lookup.
+ *
+ * Args:
+ *   key: Cache key.
+ *
+ * Returns:
+ *   True if the entry is indexed.
+ */
+bool ResultCache::contains(const std::string& key) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.count(key) > 0;
+}
+
+/**
+ * Deletes every entry. The counters are kept.
+ */
+void ResultCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    while (!recency.empty()) {
+        std::string key = recency.back();
+        erase(key);
+    }
+}
+
+/**
+ * Gets the number of entries.
+ *
+ * Returns:
+ *   Entry count.
+ */
+size_t ResultCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+/**
+ * Gets the size of all entries together.
+ *
+ * Returns:
+ *   Size in bytes.
+ */
+uint64_t ResultCache::getBytes() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return totalBytes;
+}
+
+/**
+ * Gets the hit, miss, store and eviction counters.
+ *
+ * Returns:
+ *   Copy of the counters.
+ */
+CacheStatistics ResultCache::getStatistics() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
+
+/**
+ * Gets the file path of an entry.
+ */
+std::string ResultCache::pathOf(const std::string& key) const {
+    return (fs::path(directory) / (key + ENTRY_EXTENSION)).string();
+}
+
+/**
+ * Indexes an entry as the most recently used one. Call with the mutex held.
+ */
+void ResultCache::touch(const std::string& key, uint64_t bytes) {
+    auto it = entries.find(key);
+    if (it == entries.end()) {
+        recency.push_front(key);
+        entries.emplace(key, Entry{bytes, recency.begin()});
+    } else {
+        totalBytes -= it->second.bytes;
+        it->second.bytes = bytes;
+        recency.splice(recency.begin(), recency, it->second.position);
+    }
+    totalBytes += bytes;
+}
+
+/**
+ * Drops an entry from the index and deletes its file. Call with the mutex held.
+ */
+void ResultCache::erase(const std::string& key) {
+    std::error_code error;
+    fs::remove(pathOf(key), error);
+    auto it = entries.find(key);
+    if (it != entries.end()) {
+        totalBytes -= it->second.bytes;
+        recency.erase(it->second.position);
+        entries.erase(it);
+    }
+}
+
+/**
+ * Evicts least recently used entries until the limits hold. Call with the
+ * mutex held.
+ */
+void ResultCache::evict() {
+    while (!recency.empty() && (totalBytes > maxBytes || (maxEntries > 0 && entries.size() > maxEntries))) {
+        std::string key = recency.back();
+        erase(key);
+        stats.evictions++;
+    }
+}
@@ -0,0 +1,350 @@
+#include "schedule_validator.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+namespace {
+
+const size_t TYPE_COUNT = static_cast<size_t>(ViolationType::MAKESPAN_MISMATCH) + 1;
+
+/**
+ * Collects violations, describing only the first few.
+ */
+class ViolationSink {
+public:
+    explicit ViolationSink(ValidationReport& report) : report(report) {
+        report.counts.assign(TYPE_COUNT, 0);
+    }
+
+    /**
+     * Records a violation of an operation, or of the whole schedule if it is null.
+     */
+    void add(ViolationType type, const Operation* operation, int machineId, long long expected, long long actual,
+             const Operation* other = nullptr) {
+        report.total++;
+        report.counts[static_cast<size_t>(type)]++;
+        if (report.violations.size() >= ScheduleValidator::MAX_REPORTED_VIOLATIONS) {
+            return;
+        }
+        Violation violation;
+        violation.type = type;
+        if (operation) {
+            violation.jobId = operation->jobId;
+            violation.operationId = operation->operationId;
+        }
+        violation.machineId = machineId;
+        if (other) {
+            violation.otherJobId = other->jobId;
+            violation.otherOperationId = other->operationId;
+        }
+        violation.expected = expected;
+        violation.actual = actual;
+        report.violations.push_back(violation);
+    }
+
+private:
+    ValidationReport& report;
+};
+
+/**
+ * Finds job operations by (jobId, operationId) and numbers them in job
+ * order. Operation ids are normally unique and dense, and then a direct id
+ * table answers each lookup with one load; otherwise a sorted
+ * (jobId, operationId) table is binary-searched.
+ */
+class OperationIndex {
+public:
+    static constexpr uint32_t NONE = UINT32_MAX;
+
+    void reserve(size_t count) {
+        operations.reserve(count);
+        jobs.reserve(count);
+    }
+
+    /**
+     * Registers the next operation of job jobIndex.
+     */
+    void add(const Operation* operation, int jobIndex) {
+        operations.push_back(operation);
+        jobs.push_back(jobIndex);
+    }
+
+    /**
+     * Builds the lookup table once every operation is registered.
+     */
+    void build() {
+        int maxId = -1;
+        bool dense = operations.size() < NONE;
+        for (const Operation* operation : operations) {
+            dense = dense && operation->operationId >= 0;
+            maxId = std::max(maxId, operation->operationId);
+        }
+        dense = dense && static_cast<size_t>(maxId) < 4 * operations.size() + 64;
+        if (dense) {
+            byId.assign(static_cast<size_t>(maxId) + 1, NONE);
+            for (size_t number = 0; number < operations.size() && dense; ++number) {
+                uint32_t& slot = byId[operations[number]->operationId];
+                dense = slot == NONE;
+                slot = static_cast<uint32_t>(number);
+            }
+        }
+        if (!dense) {
+            std::vector<uint32_t>().swap(byId);
+            sorted.reserve(operations.size());
+            for (size_t number = 0; number < operations.size(); ++number) {
+                sorted.push_back({jobs[number], operations[number]->operationId, static_cast<uint32_t>(number)});
+            }
+            std::sort(sorted.begin(), sorted.end(), [](const Key& a, const Key& b) {
+                return a.jobId != b.jobId ? a.jobId < b.jobId : a.operationId < b.operationId;
+            });
+        }
+    }
+
+    size_t size() const { return operations.size(); }
+
+    const Operation& operator[](size_t number) const { return *operations[number]; }
+
+    /**
+     * Returns the number of an operation, or NONE if no job has it.
+     */
+    uint32_t find(int jobId, int operationId) const {
+        if (!byId.empty()) {
+            if (operationId < 0 || static_cast<size_t>(operationId) >= byId.size()) {
+                return NONE;
+            }
+            uint32_t number = byId[operationId];
+            return number != NONE && jobs[number] == jobId ? number : NONE;
+        }
+        Key key = {jobId, operationId, 0};
+        auto it = std::lower_bound(sorted.begin(), sorted.end(), key, [](const Key& a, const Key& b) {
+            return a.jobId != b.jobId ? a.jobId < b.jobId : a.operationId < b.operationId;
+        });
+        return it != sorted.end() && it->jobId == jobId && it->operationId == operationId ? it->number : NONE;
+    }
+
+private:
+    struct Key {
+        int jobId;
+        int operationId;
+        uint32_t number;
+    };
+
+    std::vector<const Operation*> operations; // by number
+    std::vector<int> jobs;                    // job index by number
+    std::vector<uint32_t> byId;               // number by operationId, if the ids are dense and unique
+    std::vector<Key> sorted;                  // otherwise, sorted by (jobId, operationId)
+};
+
+/**
+ * A machine entry matched to its job operation.
+ */
+struct Slot {
+    long long start;
+    long long end;
+    const Operation* operation;
+};
+
+} // namespace
+
+/**
+ * Describes the violation in one line.
+ *
+ * Returns:
+ *   Human-readable description.
+ */
+std::string Violation::describe() const {
+    std::string subject = "Job " + std::to_string(jobId) + " operation " + std::to_string(operationId);
+    std::string other = "job " + std::to_string(otherJobId) + " operation " + std::to_string(otherOperationId);
+    std::string machine = "machine " + std::to_string(machineId);
+    switch (type) {
+        case ViolationType::DURATION_MISMATCH:
+            return subject + " lasts " + std::to_string(actual) + " instead of " + std::to_string(expected);
+        case ViolationType::NEGATIVE_START:
+            return subject + " starts at " + std::to_string(actual);
+        case ViolationType::PRECEDENCE:
+            return subject + " starts at " + std::to_string(actual) + ", before " + other + " ends at " +
+                   std::to_string(expected);
+        case ViolationType::MACHINE_OVERLAP:
+            return subject + " starts at " + std::to_string(actual) + " on " + machine + ", before " + other +
+                   " ends at " + std::to_string(expected);
+        case ViolationType::UNKNOWN_OPERATION:
+            return subject + " on " + machine + " is not in any job";
+        case ViolationType::WRONG_MACHINE:
+            return subject + " needs machine " + std::to_string(expected) + " but is scheduled on " + machine;
+        case ViolationType::TIME_MISMATCH:
+            return subject + " starts at " + std::to_string(actual) + " on " + machine + " but at " +
+                   std::to_string(expected) + " in its job";
+        case ViolationType::DUPLICATE_OPERATION:
+            return subject + " is scheduled again on " + machine;
+        case ViolationType::MISSING_FROM_MACHINE:
+            return subject + " is not in any machine schedule";
+        case ViolationType::MAKESPAN_MISMATCH:
+            return "Makespan is reported as " + std::to_string(actual) + " but the last operation ends at " +
+                   std::to_string(expected);
+    }
+    return subject;
+}
+
+/**
+ * Gets how many violations of one type were found.
+ *
+ * Args:
+ *   type: Violation type.
+ *
+ * Returns:
+ *   Violation count.
+ */
+size_t ValidationReport::count(ViolationType type) const {
+    size_t index = static_cast<size_t>(type);
+    return index < counts.size() ? counts[index] : 0;
+}
+
+/**
+ * Summarizes the counts per type in one line.
+ *
+ * Returns:
+ *   "feasible", or the counts of the types found.
+ */
+std::string ValidationReport::summary() const {
+    if (ok()) {
+        return "feasible";
+    }
+    std::string text = std::to_string(total) + " violation(s):";
+    for (size_t i = 0; i < counts.size(); ++i) {
+        if (counts[i] > 0) {
+            text += " " + ScheduleValidator::typeName(static_cast<ViolationType>(i)) + "=" + std::to_string(counts[i]);
+        }
+    }
+    return text;
+}
+
+/**
+ * Validates a schedule.
+ *
+ * Args:
+ *   result: Schedule to check.
+ *
+ * Returns:
+ *   Report of the defects found.
+ */
+ValidationReport ScheduleValidator::validate(const ScheduleResult& result) {
+    const ProblemInstance& problem = result.problem;
+    ValidationReport report;
+    ViolationSink sink(report);
+
+    // Jobs: durations, start times and precedence, in job order
+    OperationIndex index;
+    index.reserve(problem.getTotalOperations());
+    long long makespan = 0;
+    for (size_t j = 0; j < problem.jobs.size(); ++j) {
+        const auto& job = problem.jobs[j];
+        const Operation* previous = nullptr;
+        for (const auto& pointer : job->operations) {
+            const Operation& operation = *pointer;
+            long long start = operation.startTime;
+            long long end = operation.endTime;
+            if (end - start != operation.processingTime) {
+                sink.add(ViolationType::DURATION_MISMATCH, &operation, operation.machineId, operation.processingTime,
+                         end - start);
+            }
+            if (start < 0) {
+                sink.add(ViolationType::NEGATIVE_START, &operation, operation.machineId, 0, start);
+            }
+            if (previous && start < previous->endTime) {
+                sink.add(ViolationType::PRECEDENCE, &operation, operation.machineId, previous->endTime, start, previous);
+            }
+            makespan = std::max(makespan, end);
+            previous = &operation;
+            index.add(&operation, static_cast<int>(j));
+        }
+        report.operations += job->operations.size();
+    }
+    report.makespan = makespan;
+    if (result.makespan != makespan) {
+        sink.add(ViolationType::MAKESPAN_MISMATCH, nullptr, -1, makespan, result.makespan);
+    }
+
+    // Machines: every entry is a job operation, placed once, on its machine
+    index.build();
+    std::vector<uint8_t> placed(index.size(), 0);
+    std::vector<Slot> slots;
+    for (const auto& machine : problem.machines) {
+        const auto& entries = machine->scheduledOperations;
+        report.machineEntries += entries.size();
+        slots.clear();
+        slots.reserve(entries.size());
+        for (const auto& entry : entries) {
+            uint32_t number = index.find(entry->jobId, entry->operationId);
+            if (number == OperationIndex::NONE) {
+                sink.add(ViolationType::UNKNOWN_OPERATION, entry.get(), machine->machineId, -1, -1);
+                continue;
+            }
+            const Operation& operation = index[number];
+            if (operation.machineId != machine->machineId) {
+                sink.add(ViolationType::WRONG_MACHINE, &operation, machine->machineId, operation.machineId,
+                         machine->machineId);
+            }
+            if (entry->startTime != operation.startTime || entry->endTime != operation.endTime) {
+                sink.add(ViolationType::TIME_MISMATCH, &operation, machine->machineId, operation.startTime,
+                         entry->startTime);
+            }
+            if (placed[number]) {
+                sink.add(ViolationType::DUPLICATE_OPERATION, &operation, machine->machineId, -1, -1);
+                continue;
+            }
+            placed[number] = 1;
+            if (operation.endTime > operation.startTime) {
+                slots.push_back({operation.startTime, operation.endTime, &operation});
+            }
+        }
+
+        // Sequences come sorted from the schedulers; sort only if needed
+        auto byStart = [](const Slot& a, const Slot& b) { return a.start < b.start; };
+        if (!std::is_sorted(slots.begin(), slots.end(), byStart)) {
+            std::stable_sort(slots.begin(), slots.end(), byStart);
+        }
+        const Slot* latest = nullptr; // slot with the latest end so far
+        for (const Slot& slot : slots) {
+            if (latest && slot.start < latest->end) {
+                sink.add(ViolationType::MACHINE_OVERLAP, slot.operation, machine->machineId, latest->end, slot.start,
+                         latest->operation);
+            }
+            if (!latest || slot.end > latest->end) {
+                latest = &slot;
+            }
+        }
+    }
+
+    for (size_t number = 0; number < index.size(); ++number) {
+        if (!placed[number]) {
+            const Operation& operation = index[number];
+            sink.add(ViolationType::MISSING_FROM_MACHINE, &operation, operation.machineId, -1, -1);
+        }
+    }
+    return report;
+}
+
+/**
+ * Gets the name of a violation type.
+ *
+ * Args:
+ *   type: Violation type.
+ *
+ * Returns:
+ *   Name such as "MACHINE_OVERLAP".
+ */
+std::string ScheduleValidator::typeName(ViolationType type) {
+    switch (type) {
+        case ViolationType::DURATION_MISMATCH: return "DURATION_MISMATCH";
+        case ViolationType::NEGATIVE_START: return "NEGATIVE_START";
+        case ViolationType::PRECEDENCE: return "PRECEDENCE";
+        case ViolationType::MACHINE_OVERLAP: return "MACHINE_OVERLAP";
+        case ViolationType::UNKNOWN_OPERATION: return "UNKNOWN_OPERATION";
+        case ViolationType::WRONG_MACHINE: return "WRONG_MACHINE";
+        case ViolationType::TIME_MISMATCH: return "TIME_MISMATCH";
+        case ViolationType::DUPLICATE_OPERATION: return "DUPLICATE_OPERATION";
+        case ViolationType::MISSING_FROM_MACHINE: return "MISSING_FROM_MACHINE";
+        case ViolationType::MAKESPAN_MISMATCH: return "MAKESPAN_MISMATCH";
+    }
+    return "UNKNOWN";
+}
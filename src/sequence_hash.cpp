@@ -0,0 +1,196 @@
+#include "sequence_hash.hpp"
+#include <stdexcept>
+
+namespace {
+const uint64_t VALID_FLAG = 1ULL << 32;
+}
+
+/**
+ * Hashes the sequence of a single machine.
+ *
+ * Args:
+ *   sequence: Flat operation indices in processing order.
+ *
+ * Returns:
+ *   Hash of the machine sequence.
+ */
+uint64_t SequenceHasher::hash(const std::vector<int>& sequence) {
+    uint64_t h = 0;
+    for (size_t position = 0; position < sequence.size(); ++position) {
+        h ^= key(sequence[position], static_cast<int>(position));
+    }
+    return h;
+}
+
+/**
+ * Hashes all machine sequences of a schedule.
+ *
+ * Args:
+ *   sequences: Flat operation indices per machine.
+ *
+ * Returns:
+ *   Schedule hash.
+ */
+uint64_t SequenceHasher::hash(const MachineSequences& sequences) {
+    uint64_t h = 0;
+    for (const auto& sequence : sequences) {
+        h ^= hash(sequence);
+    }
+    return h;
+}
+
+/**
+ * Hashes the machine sequences stored in Machine::scheduledOperations.
+ *
+ * Args:
+ *   instance: Flat instance of the problem.
+ *   scheduled: Problem instance whose machines hold scheduled operations.
+ *
+ * Returns:
+ *   Schedule hash.
+ */
+uint64_t SequenceHasher::hash(const FlatInstance& instance, const ProblemInstance& scheduled) {
+    uint64_t h = 0;
+    for (const auto& machine : scheduled.machines) {
+        int position = 0;
+        for (const auto& operation : machine->scheduledOperations) {
+            int op = instance.indexOf(operation->jobId, operation->operationId);
+            if (op < 0) {
+                throw std::runtime_error("Scheduled problem does not match flat instance");
+            }
+            h ^= key(op, position++);
+        }
+    }
+    return h;
+}
+
+/**
+ * Computes the hash change of swapping two positions on one machine.
+ *
+ * Args:
+ *   sequence: Machine sequence before the swap.
+ *   i: First position.
+ *   j: Second position.
+ *
+ * Returns:
+ *   Hash delta.
+ */
+uint64_t SequenceHasher::swapDelta(const std::vector<int>& sequence, int i, int j) {
+    if (i == j) {
+        return 0;
+    }
+    int a = sequence[i];
+    int b = sequence[j];
+    return key(a, i) ^ key(b, j) ^ key(a, j) ^ key(b, i);
+}
+
+/**
+ * Computes the hash change of moving one operation to another position.
+ *
+ * Args:
+ *   sequence: Machine sequence before the move.
+ *   from: Current position of the moved operation.
+ *   to: Target position.
+ *
+ * Returns:
+ *   Hash delta.
+ */
+uint64_t SequenceHasher::moveDelta(const std::vector<int>& sequence, int from, int to) {
+    uint64_t delta = key(sequence[from], from) ^ key(sequence[from], to);
+    // Operations between the two positions shift by one towards from
+    int step = from < to ? 1 : -1;
+    for (int position = from + step; position != to + step; position += step) {
+        delta ^= key(sequence[position], position) ^ key(sequence[position], position - step);
+    }
+    return delta;
+}
+
+/**
+ * Constructor for EvaluationCache.
+ *
+ * Args:
+ *   capacity: Number of entries, rounded up to a power of two.
+ */
+EvaluationCache::EvaluationCache(size_t capacity)
+    : mask(0), lookups(0), hits(0), stores(0) {
+    size_t size = 1;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    entries.reset(new Entry[size]);
+    mask = size - 1;
+    clear();
+}
+
+/**
+ * Looks up a schedule hash.
+ *
+ * Args:
+ *   hash: Schedule hash.
+ *   makespan: Set to the cached makespan on a hit.
+ *
+ * Returns:
+ *   True on a hit.
+ */
+bool EvaluationCache::lookup(uint64_t hash, int& makespan) const {
+    lookups.fetch_add(1, std::memory_order_relaxed);
+    const Entry& entry = entries[hash & mask];
+    uint64_t data = entry.data.load(std::memory_order_relaxed);
+    uint64_t check = entry.check.load(std::memory_order_relaxed);
+
+    // A half-written entry fails the check and counts as a miss
+    if ((data & VALID_FLAG) == 0 || (check ^ data) != hash) {
+        return false;
+    }
+    hits.fetch_add(1, std::memory_order_relaxed);
+    makespan = static_cast<int>(static_cast<uint32_t>(data));
+    return true;
+}
+
+/**
+ * Stores the makespan of a schedule hash.
+ *
+ * Args:
+ *   hash: Schedule hash.
+ *   makespan: Non-negative makespan.
+ */
+void EvaluationCache::store(uint64_t hash, int makespan) {
+    if (makespan < 0) {
+        throw std::invalid_argument("Makespan must be non-negative");
+    }
+    stores.fetch_add(1, std::memory_order_relaxed);
+    Entry& entry = entries[hash & mask];
+    uint64_t data = VALID_FLAG | static_cast<uint32_t>(makespan);
+    entry.check.store(hash ^ data, std::memory_order_relaxed);
+    entry.data.store(data, std::memory_order_relaxed);
+}
+
+/**
+ * Removes all entries.
+ */
+void EvaluationCache::clear() {
+    for (size_t i = 0; i <= mask; ++i) {
+        entries[i].check.store(0, std::memory_order_relaxed);
+        entries[i].data.store(0, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * Gets the fraction of lookups that hit.
+ *
+ * Returns:
+ *   Hit rate in [0, 1].
+ */
+double EvaluationCache::getHitRate() const {
+    uint64_t total = getLookups();
+    return total == 0 ? 0.0 : static_cast<double>(getHits()) / static_cast<double>(total);
+}
+
+/**
+ * Resets the lookup, hit and store counters.
+ */
+void EvaluationCache::resetStatistics() {
+    lookups.store(0, std::memory_order_relaxed);
+    hits.store(0, std::memory_order_relaxed);
+    stores.store(0, std::memory_order_relaxed);
+}
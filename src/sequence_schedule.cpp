@@ -0,0 +1,251 @@
+#include "sequence_schedule.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * Constructor for SequenceSchedule.
+ *
+ * Args:
+ *   instance: Flat instance to time against.
+ */
+SequenceSchedule::SequenceSchedule(const FlatInstance& instance)
+    : instance(instance), makespan(0) {}
+
+/**
+ * Gets the operation processed before op on its machine.
+ *
+ * Args:
+ *   op: Flat operation index.
+ *
+ * Returns:
+ *   Machine predecessor, or -1 for the first operation.
+ */
+int SequenceSchedule::machinePredecessor(int op) const {
+    int p = position[op];
+    return p > 0 ? sequences[instance.machine(op)][p - 1] : -1;
+}
+
+/**
+ * Gets the operation processed after op on its machine.
+ *
+ * Args:
+ *   op: Flat operation index.
+ *
+ * Returns:
+ *   Machine successor, or -1 for the last operation.
+ */
+int SequenceSchedule::machineSuccessor(int op) const {
+    const auto& sequence = sequences[instance.machine(op)];
+    int p = position[op] + 1;
+    return p < static_cast<int>(sequence.size()) ? sequence[p] : -1;
+}
+
+/**
+ * Loads machine sequences and times every operation.
+ *
+ * Args:
+ *   sequences: Flat operation indices per machine.
+ *
+ * Returns:
+ *   False if the sequences describe a cyclic schedule.
+ */
+bool SequenceSchedule::load(const MachineSequences& newSequences) {
+    const int n = instance.getNumOperations();
+    if (static_cast<int>(newSequences.size()) != instance.getNumMachines()) {
+        throw std::invalid_argument("Machine sequence count does not match instance");
+    }
+
+    sequences = newSequences;
+    position.assign(n, -1);
+    int placed = 0;
+    for (int m = 0; m < instance.getNumMachines(); ++m) {
+        for (int p = 0; p < static_cast<int>(sequences[m].size()); ++p) {
+            int op = sequences[m][p];
+            if (op < 0 || op >= n || instance.machine(op) != m || position[op] >= 0) {
+                throw std::invalid_argument("Invalid operation in machine sequence " + std::to_string(m));
+            }
+            position[op] = p;
+            ++placed;
+        }
+    }
+    if (placed != n) {
+        throw std::invalid_argument("Machine sequences do not cover every operation");
+    }
+
+    // Kahn's algorithm over job and machine arcs
+    start.assign(n, 0);
+    inDegree.assign(n, 0);
+    stack.clear();
+    for (int op = 0; op < n; ++op) {
+        inDegree[op] = (jobPredecessor(op) >= 0) + (machinePredecessor(op) >= 0);
+        if (inDegree[op] == 0) {
+            stack.push_back(op);
+        }
+    }
+
+    int processed = 0;
+    while (!stack.empty()) {
+        int op = stack.back();
+        stack.pop_back();
+        ++processed;
+        int end = start[op] + instance.duration(op);
+        for (int next : {jobSuccessor(op), machineSuccessor(op)}) {
+            if (next < 0) continue;
+            start[next] = std::max(start[next], end);
+            if (--inDegree[next] == 0) {
+                stack.push_back(next);
+            }
+        }
+    }
+
+    updateMakespan();
+    return processed == n;
+}
+
+/**
+ * Swaps two adjacent operations on a machine and re-times the schedule.
+ *
+ * Args:
+ *   machine: Machine index.
+ *   position: Position of the first operation of the pair.
+ *
+ * Returns:
+ *   False if the swap was rejected.
+ */
+bool SequenceSchedule::swapAdjacent(int machine, int pos) {
+    auto& sequence = sequences[machine];
+    if (pos < 0 || pos + 1 >= static_cast<int>(sequence.size())) {
+        throw std::out_of_range("Swap position out of range");
+    }
+
+    std::swap(sequence[pos], sequence[pos + 1]);
+    position[sequence[pos]] = pos;
+    position[sequence[pos + 1]] = pos + 1;
+
+    // Everything whose predecessors changed is reachable from the new front op
+    if (!retimeFrom(sequence[pos])) {
+        std::swap(sequence[pos], sequence[pos + 1]);
+        position[sequence[pos]] = pos;
+        position[sequence[pos + 1]] = pos + 1;
+        return false;
+    }
+    updateMakespan();
+    return true;
+}
+
+/**
+ * Re-times every operation reachable from root in topological order.
+ *
+ * Args:
+ *   root: First operation whose predecessors changed.
+ *
+ * Returns:
+ *   False if the reachable part of the graph contains a cycle.
+ */
+bool SequenceSchedule::retimeFrom(int root) {
+    const int n = instance.getNumOperations();
+    if (static_cast<int>(visited.size()) != n) {
+        visited.assign(n, 0);
+        inDegree.assign(n, 0);
+    }
+
+    affected.clear();
+    stack.assign(1, root);
+    visited[root] = 1;
+    while (!stack.empty()) {
+        int op = stack.back();
+        stack.pop_back();
+        affected.push_back(op);
+        for (int next : {jobSuccessor(op), machineSuccessor(op)}) {
+            if (next >= 0 && !visited[next]) {
+                visited[next] = 1;
+                stack.push_back(next);
+            }
+        }
+    }
+
+    // Only arcs inside the affected set constrain the processing order
+    saved.clear();
+    for (int op : affected) {
+        saved.push_back(start[op]);
+        int jobPrev = jobPredecessor(op);
+        int machinePrev = machinePredecessor(op);
+        inDegree[op] = (jobPrev >= 0 && visited[jobPrev]) + (machinePrev >= 0 && visited[machinePrev]);
+        if (inDegree[op] == 0) {
+            stack.push_back(op);
+        }
+    }
+
+    size_t processed = 0;
+    while (!stack.empty()) {
+        int op = stack.back();
+        stack.pop_back();
+        ++processed;
+        int jobPrev = jobPredecessor(op);
+        int machinePrev = machinePredecessor(op);
+        int ready = 0;
+        if (jobPrev >= 0) ready = start[jobPrev] + instance.duration(jobPrev);
+        if (machinePrev >= 0) ready = std::max(ready, start[machinePrev] + instance.duration(machinePrev));
+        start[op] = ready;
+
+        for (int next : {jobSuccessor(op), machineSuccessor(op)}) {
+            if (next >= 0 && --inDegree[next] == 0) {
+                stack.push_back(next);
+            }
+        }
+    }
+
+    bool acyclic = processed == affected.size();
+    for (size_t i = 0; i < affected.size(); ++i) {
+        if (!acyclic) {
+            start[affected[i]] = saved[i];
+        }
+        visited[affected[i]] = 0;
+    }
+    return acyclic;
+}
+
+/**
+ * Recomputes the makespan from the last operation of each job.
+ */
+void SequenceSchedule::updateMakespan() {
+    makespan = 0;
+    for (int j = 0; j < instance.getNumJobs(); ++j) {
+        int last = instance.jobStart(j + 1) - 1;
+        if (last >= instance.jobStart(j)) {
+            makespan = std::max(makespan, start[last] + instance.duration(last));
+        }
+    }
+}
+
+/**
+ * Writes start times and machine order back into a problem instance.
+ *
+ * Args:
+ *   problem: Problem instance the flat instance was built from.
+ */
+void SequenceSchedule::applyTo(ProblemInstance& problem) const {
+    std::vector<std::shared_ptr<Operation>> byIndex(instance.getNumOperations());
+    for (const auto& job : problem.jobs) {
+        for (const auto& operation : job->operations) {
+            int op = instance.indexOf(job->jobId, operation->operationId);
+            if (op < 0) {
+                throw std::runtime_error("Problem does not match flat instance");
+            }
+            byIndex[op] = operation;
+        }
+    }
+
+    for (auto& machine : problem.machines) {
+        machine->reset();
+    }
+    for (int m = 0; m < instance.getNumMachines(); ++m) {
+        auto machine = problem.getMachine(m);
+        if (!machine) {
+            throw std::runtime_error("Problem does not match flat instance");
+        }
+        for (int op : sequences[m]) {
+            machine->scheduleOperation(byIndex[op], start[op]);
+        }
+    }
+}
@@ -0,0 +1,749 @@
+#include "solution_reader.hpp"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <nlohmann/json.hpp>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using json = nlohmann::json;
+
+namespace {
+
+struct OperationRecord {
+    int jobId = 0, machineId = 0, processingTime = 0, operationId = 0, startTime = 0, endTime = 0;
+};
+
+struct MachineRecord {
+    int machineId;
+    int availableTime;
+    size_t first; // first entry in SolutionRecords::scheduled
+    size_t count;
+    bool hasAvailableTime;
+};
+
+struct ScheduledRecord {
+    int jobId = 0, operationId = 0, startTime = 0, endTime = 0;
+};
+
+/**
+ * Finds operations by (jobId, operationId). Jobs with ascending ids, the
+ * normal case, are searched in place; others get a sorted id table.
+ */
+class OperationLookup {
+public:
+    explicit OperationLookup(const ProblemInstance& problem) : problem(problem), tables(problem.jobs.size()) {
+        for (size_t j = 0; j < problem.jobs.size(); ++j) {
+            const auto& ops = problem.jobs[j]->operations;
+            bool sorted = std::is_sorted(ops.begin(), ops.end(), [](const auto& a, const auto& b) {
+                return a->operationId < b->operationId;
+            });
+            if (!sorted) {
+                auto& table = tables[j];
+                table.reserve(ops.size());
+                for (size_t k = 0; k < ops.size(); ++k) {
+                    table.emplace_back(ops[k]->operationId, static_cast<int>(k));
+                }
+                std::sort(table.begin(), table.end());
+            }
+        }
+    }
+
+    /**
+     * Returns the first operation of the job with the given id, or null.
+     */
+    std::shared_ptr<Operation> find(int jobId, int operationId) const {
+        auto job = problem.getJob(jobId);
+        if (!job) {
+            return nullptr;
+        }
+        const auto& ops = job->operations;
+        const auto& table = tables[jobId];
+        if (table.empty()) {
+            auto it = std::lower_bound(ops.begin(), ops.end(), operationId,
+                                       [](const std::shared_ptr<Operation>& a, int id) { return a->operationId < id; });
+            return it != ops.end() && (*it)->operationId == operationId ? *it : nullptr;
+        }
+        auto it = std::lower_bound(table.begin(), table.end(), std::make_pair(operationId, INT_MIN));
+        return it != table.end() && it->first == operationId ? ops[it->second] : nullptr;
+    }
+
+private:
+    const ProblemInstance& problem;
+    std::vector<std::vector<std::pair<int, int>>> tables; // (operationId, index), empty for sorted jobs
+};
+
+/**
+ * Flat records of a solution file, filled while parsing.
+ */
+struct SolutionRecords {
+    int numJobs = 0;
+    int numMachines = 0;
+    int makespan = 0;
+    int totalCompletionTime = 0;
+    double averageFlowTime = 0.0;
+    std::vector<OperationRecord> operations;
+    std::vector<MachineRecord> machines;
+    std::vector<ScheduledRecord> scheduled;
+
+    void reserve(size_t operationCount) {
+        operations.reserve(operationCount);
+        scheduled.reserve(operationCount);
+    }
+
+    /**
+     * Builds the schedule result from the records.
+     */
+    std::shared_ptr<ScheduleResult> build(const char* format) {
+        auto result = std::make_shared<ScheduleResult>();
+        ProblemInstance& problem = result->problem;
+        problem.numJobs = numJobs;
+        problem.numMachines = numMachines;
+        problem.createJobs(problem.numJobs);
+        problem.createMachines(problem.numMachines);
+
+        std::vector<size_t> perJob(problem.jobs.size(), 0);
+        for (const auto& record : operations) {
+            if (record.jobId >= 0 && static_cast<size_t>(record.jobId) < perJob.size()) {
+                perJob[record.jobId]++;
+            }
+        }
+        for (size_t j = 0; j < perJob.size(); ++j) {
+            problem.jobs[j]->operations.reserve(perJob[j]);
+        }
+        for (const auto& record : operations) {
+            auto job = problem.getJob(record.jobId);
+            if (job) {
+                auto operation = std::make_shared<Operation>(record.jobId, record.machineId,
+                                                             record.processingTime, record.operationId);
+                operation->setScheduled(record.startTime, record.endTime);
+                job->addOperation(operation);
+            }
+        }
+        std::vector<OperationRecord>().swap(operations);
+
+        OperationLookup lookup(problem);
+        for (const auto& record : machines) {
+            auto machine = problem.getMachine(record.machineId);
+            if (!machine) {
+                continue;
+            }
+            if (!record.hasAvailableTime) {
+                throw std::runtime_error(std::string("Invalid ") + format + " solution: machine " +
+                                         std::to_string(record.machineId) + " has no availableTime");
+            }
+            machine->availableTime = record.availableTime;
+            machine->scheduledOperations.reserve(record.count);
+            for (size_t i = record.first; i < record.first + record.count; ++i) {
+                const ScheduledRecord& entry = scheduled[i];
+                std::shared_ptr<Operation> operation = lookup.find(entry.jobId, entry.operationId);
+                if (operation) {
+                    operation->setScheduled(entry.startTime, entry.endTime);
+                    machine->scheduledOperations.push_back(operation);
+                }
+            }
+        }
+
+        result->makespan = makespan;
+        result->totalCompletionTime = totalCompletionTime;
+        result->avgFlowTime = averageFlowTime;
+        return result;
+    }
+};
+
+/**
+ * Reads the total operation count that SolutionSerializer writes near the
+ * start (XML) or the end (JSON) of a file, to size the record buffers.
+ */
+size_t operationCountHint(std::string_view content, std::string_view key) {
+    const size_t window = 4096;
+    std::string_view head = content.substr(0, window);
+    std::string_view tail = content.substr(content.size() - std::min(content.size(), window));
+    for (std::string_view part : {head, tail}) {
+        size_t pos = part.rfind(key);
+        if (pos == std::string_view::npos) {
+            continue;
+        }
+        pos = part.find_first_of("0123456789", pos + key.size());
+        size_t count = 0;
+        if (pos != std::string_view::npos) {
+            std::from_chars(part.data() + pos, part.data() + part.size(), count);
+        }
+        return std::min<size_t>(count, content.size() / 64); // an operation takes well over 64 bytes
+    }
+    return 0;
+}
+
+/**
+ * Index of a name in a field list, or -1.
+ */
+template <size_t N>
+int fieldIndex(const std::string_view (&fields)[N], std::string_view name) {
+    for (size_t i = 0; i < N; ++i) {
+        if (fields[i] == name) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+const std::string_view PROBLEM_FIELDS[] = {"numJobs", "numMachines"};
+const std::string_view METRICS_FIELDS[] = {"makespan", "totalCompletionTime", "averageFlowTime"};
+const std::string_view OPERATION_FIELDS[] = {"jobId", "machineId", "processingTime", "operationId", "startTime",
+                                             "endTime"};
+const std::string_view MACHINE_FIELDS[] = {"machineId", "availableTime"};
+const std::string_view SCHEDULED_FIELDS[] = {"jobId", "operationId", "startTime", "endTime"};
+
+/**
+ * Stores field `index` of the innermost open record.
+ */
+void setOperationField(OperationRecord& r, int index, int value) {
+    int* fields[] = {&r.jobId, &r.machineId, &r.processingTime, &r.operationId, &r.startTime, &r.endTime};
+    *fields[index] = value;
+}
+
+void setScheduledField(ScheduledRecord& r, int index, int value) {
+    int* fields[] = {&r.jobId, &r.operationId, &r.startTime, &r.endTime};
+    *fields[index] = value;
+}
+
+/**
+ * SAX handler for JSON solutions. Unknown keys and their values are
+ * skipped; known keys must hold numbers.
+ */
+class JSONSolutionHandler : public json::json_sax_t {
+public:
+    explicit JSONSolutionHandler(SolutionRecords& records) : records(records) {}
+
+    bool null() override { return other(); }
+    bool boolean(bool) override { return other(); }
+    bool number_integer(number_integer_t value) override { return number(static_cast<double>(value)); }
+    bool number_unsigned(number_unsigned_t value) override { return number(static_cast<double>(value)); }
+    bool number_float(number_float_t value, const string_t&) override { return number(value); }
+    bool string(string_t&) override { return other(); }
+    bool binary(binary_t&) override { return other(); }
+
+    bool key(string_t& value) override {
+        currentKey = value;
+        return true;
+    }
+
+    bool start_object(std::size_t) override {
+        Context next = SKIP;
+        switch (top()) {
+            case NONE: next = ROOT; break;
+            case ROOT:
+                next = currentKey == "problem" ? PROBLEM : currentKey == "metrics" ? METRICS : SKIP;
+                break;
+            case OPERATIONS:
+                records.operations.emplace_back();
+                next = OPERATION;
+                break;
+            case MACHINES:
+                records.machines.push_back({0, 0, records.scheduled.size(), 0, false});
+                next = MACHINE;
+                break;
+            case SCHEDULED:
+                records.scheduled.emplace_back();
+                next = SCHEDULED_OPERATION;
+                break;
+            default: break;
+        }
+        stack.push_back({next, 0});
+        return true;
+    }
+
+    bool end_object() override {
+        Frame frame = stack.back();
+        stack.pop_back();
+        switch (frame.context) {
+            case ROOT: require(0x3, frame.seen, "document: needs problem and metrics"); break;
+            case PROBLEM: require(0x3, frame.seen, "problem"); stack.back().seen |= 0x1; break;
+            case METRICS: require(0x7, frame.seen, "metrics"); stack.back().seen |= 0x2; break;
+            case OPERATION: require(0x3f, frame.seen, "operation"); break;
+            case MACHINE:
+                require(0x1, frame.seen, "machine");
+                records.machines.back().hasAvailableTime = (frame.seen & 0x2) != 0;
+                break;
+            case SCHEDULED_OPERATION: require(0xf, frame.seen, "scheduled operation"); break;
+            default: break;
+        }
+        return true;
+    }
+
+    bool start_array(std::size_t) override {
+        Context next = SKIP;
+        if (top() == NONE) {
+            throw std::runtime_error("Invalid JSON solution: expected an object");
+        } else if (top() == ROOT && currentKey == "operations") {
+            next = OPERATIONS;
+        } else if (top() == ROOT && currentKey == "machines") {
+            next = MACHINES;
+        } else if (top() == MACHINE && currentKey == "scheduledOperations") {
+            next = SCHEDULED;
+        }
+        stack.push_back({next, 0});
+        return true;
+    }
+
+    bool end_array() override {
+        if (stack.back().context == SCHEDULED) {
+            records.machines.back().count = records.scheduled.size() - records.machines.back().first;
+        }
+        stack.pop_back();
+        return true;
+    }
+
+    bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& ex) override {
+        throw std::runtime_error(std::string("Invalid JSON solution: ") + ex.what());
+    }
+
+private:
+    enum Context { NONE, ROOT, PROBLEM, METRICS, OPERATIONS, OPERATION, MACHINES, MACHINE, SCHEDULED,
+                   SCHEDULED_OPERATION, SKIP };
+
+    /**
+     * An open object or array, with the fields seen so far as a bit mask.
+     */
+    struct Frame {
+        Context context;
+        unsigned seen;
+    };
+
+    Context top() const { return stack.empty() ? NONE : stack.back().context; }
+
+    static void require(unsigned mask, unsigned seen, const char* what) {
+        if ((seen & mask) != mask) {
+            throw std::runtime_error(std::string("Invalid JSON solution: incomplete ") + what);
+        }
+    }
+
+    /**
+     * A value of a type the loader does not read. Fine for unknown keys.
+     */
+    bool other() {
+        if (field() >= 0) {
+            throw std::runtime_error("Invalid JSON solution: expected a number for " + currentKey);
+        }
+        return true;
+    }
+
+    bool number(double value) {
+        int index = field();
+        if (index < 0) {
+            return true;
+        }
+        int v = static_cast<int>(std::max<double>(INT_MIN, std::min<double>(INT_MAX, value)));
+        switch (top()) {
+            case PROBLEM: (index == 0 ? records.numJobs : records.numMachines) = v; break;
+            case METRICS:
+                if (index == 0) records.makespan = v;
+                else if (index == 1) records.totalCompletionTime = v;
+                else records.averageFlowTime = value;
+                break;
+            case OPERATION: setOperationField(records.operations.back(), index, v); break;
+            case MACHINE:
+                (index == 0 ? records.machines.back().machineId : records.machines.back().availableTime) = v;
+                break;
+            case SCHEDULED_OPERATION: setScheduledField(records.scheduled.back(), index, v); break;
+            default: break;
+        }
+        stack.back().seen |= 1u << index;
+        return true;
+    }
+
+    /**
+     * Index of the current key among the fields of the current object, or
+     * -1 if the loader does not read it.
+     */
+    int field() const {
+        switch (top()) {
+            case PROBLEM: return fieldIndex(PROBLEM_FIELDS, currentKey);
+            case METRICS: return fieldIndex(METRICS_FIELDS, currentKey);
+            case OPERATION: return fieldIndex(OPERATION_FIELDS, currentKey);
+            case MACHINE: return fieldIndex(MACHINE_FIELDS, currentKey);
+            case SCHEDULED_OPERATION: return fieldIndex(SCHEDULED_FIELDS, currentKey);
+            default: return -1;
+        }
+    }
+
+    SolutionRecords& records;
+    std::vector<Frame> stack;
+    std::string currentKey;
+};
+
+/**
+ * Reads an integer the way std::stoi did for the old loader: leading
+ * whitespace and a sign are allowed, trailing text is ignored, and
+ * anything unreadable is 0.
+ */
+int parseInt(std::string_view text) {
+    size_t i = 0;
+    while (i < text.size() && std::isspace(static_cast<unsigned char>(text[i]))) {
+        ++i;
+    }
+    if (i < text.size() && text[i] == '+') {
+        ++i;
+    }
+    int value = 0;
+    auto parsed = std::from_chars(text.data() + i, text.data() + text.size(), value);
+    return parsed.ec == std::errc() ? value : 0;
+}
+
+double parseDouble(std::string_view text) {
+    char buffer[64];
+    size_t length = std::min(text.size(), sizeof(buffer) - 1);
+    std::memcpy(buffer, text.data(), length);
+    buffer[length] = '\0';
+    return std::strtod(buffer, nullptr);
+}
+
+/**
+ * Pull parser for XML solutions. It walks the tags once, keeping the open
+ * element names as views into the buffer, and hands leaf values to the
+ * records without copying them.
+ */
+class XMLSolutionReader {
+public:
+    XMLSolutionReader(const char* data, size_t size, SolutionRecords& records)
+        : p(data), end(data + size), records(records) {}
+
+    void read() {
+        const char* textStart = nullptr;
+        bool leaf = false;
+        while (p < end) {
+            const char* lt = static_cast<const char*>(std::memchr(p, '<', end - p));
+            if (!lt) {
+                break;
+            }
+            if (end - lt >= 4 && std::memcmp(lt, "<!--", 4) == 0) {
+                p = skipPast(lt + 4, "-->");
+                continue;
+            }
+            const char* gt = static_cast<const char*>(std::memchr(lt, '>', end - lt));
+            if (!gt) {
+                throw std::runtime_error("Invalid XML solution: unterminated tag");
+            }
+            p = gt + 1;
+            if (lt[1] == '?' || lt[1] == '!') {
+                continue; // declaration or doctype
+            }
+            if (lt[1] == '/') {
+                std::string_view name = trim(std::string_view(lt + 2, gt - lt - 2));
+                if (path.empty() || path.back() != name) {
+                    throw std::runtime_error("Invalid XML solution: unexpected </" + std::string(name) + ">");
+                }
+                close(name, leaf ? std::string_view(textStart, lt - textStart) : std::string_view());
+                path.pop_back();
+                leaf = false;
+                continue;
+            }
+            const char* nameEnd = lt + 1;
+            while (nameEnd < gt && *nameEnd != '/' && !std::isspace(static_cast<unsigned char>(*nameEnd))) {
+                ++nameEnd;
+            }
+            std::string_view name(lt + 1, nameEnd - lt - 1);
+            path.push_back(name);
+            open(name);
+            if (gt[-1] == '/') {
+                close(name, std::string_view());
+                path.pop_back();
+                leaf = false;
+            } else {
+                textStart = p;
+                leaf = true;
+            }
+        }
+        if (!path.empty()) {
+            throw std::runtime_error("Invalid XML solution: <" + std::string(path.back()) + "> is not closed");
+        }
+    }
+
+private:
+    static std::string_view trim(std::string_view text) {
+        while (!text.empty() && std::isspace(static_cast<unsigned char>(text.back()))) {
+            text.remove_suffix(1);
+        }
+        return text;
+    }
+
+    const char* skipPast(const char* from, std::string_view terminator) const {
+        std::string_view rest(from, end - from);
+        size_t pos = rest.find(terminator);
+        if (pos == std::string_view::npos) {
+            throw std::runtime_error("Invalid XML solution: unterminated comment");
+        }
+        return from + pos + terminator.size();
+    }
+
+    /**
+     * Name of the element `up` levels above the innermost one.
+     */
+    std::string_view ancestor(size_t up) const {
+        return path.size() > up ? path[path.size() - 1 - up] : std::string_view();
+    }
+
+    void open(std::string_view name) {
+        if (name == "operation") {
+            records.operations.emplace_back();
+            inOperation = true;
+        } else if (name == "machine") {
+            records.machines.push_back({0, 0, records.scheduled.size(), 0, true});
+            inMachine = true;
+        } else if (name == "scheduledOperation" && inMachine) {
+            records.scheduled.emplace_back();
+        }
+    }
+
+    void close(std::string_view name, std::string_view text) {
+        std::string_view parent = ancestor(1);
+        int index;
+        if (name == "operation") {
+            inOperation = false;
+        } else if (name == "machine") {
+            records.machines.back().count = records.scheduled.size() - records.machines.back().first;
+            inMachine = false;
+        } else if (parent == "operation" && inOperation &&
+                   (index = fieldIndex(OPERATION_FIELDS, name)) >= 0) {
+            setOperationField(records.operations.back(), index, parseInt(text));
+        } else if (parent == "scheduledOperation" && inMachine &&
+                   (index = fieldIndex(SCHEDULED_FIELDS, name)) >= 0) {
+            setScheduledField(records.scheduled.back(), index, parseInt(text));
+        } else if (parent == "machine" && inMachine && (index = fieldIndex(MACHINE_FIELDS, name)) >= 0) {
+            (index == 0 ? records.machines.back().machineId : records.machines.back().availableTime) = parseInt(text);
+        } else if (parent == "problem" && (index = fieldIndex(PROBLEM_FIELDS, name)) >= 0) {
+            (index == 0 ? records.numJobs : records.numMachines) = parseInt(text);
+        } else if (parent == "metrics" && (index = fieldIndex(METRICS_FIELDS, name)) >= 0) {
+            if (index == 0) records.makespan = parseInt(text);
+            else if (index == 1) records.totalCompletionTime = parseInt(text);
+            else records.averageFlowTime = parseDouble(text);
+        }
+    }
+
+    const char* p;
+    const char* const end;
+    SolutionRecords& records;
+    std::vector<std::string_view> path;
+    bool inOperation = false;
+    bool inMachine = false;
+};
+
+/**
+ * Cursor over one line of a text solution. Each step matches a literal or
+ * an integer and reports failure instead of throwing.
+ */
+class LineScanner {
+public:
+    explicit LineScanner(std::string_view line) : p(line.data()), end(line.data() + line.size()) {}
+
+    bool literal(std::string_view text) {
+        if (static_cast<size_t>(end - p) < text.size() || std::memcmp(p, text.data(), text.size()) != 0) {
+            return false;
+        }
+        p += text.size();
+        return true;
+    }
+
+    bool integer(int& value) {
+        while (p < end && *p == ' ') {
+            ++p;
+        }
+        auto parsed = std::from_chars(p, end, value);
+        if (parsed.ec != std::errc()) {
+            return false;
+        }
+        p = parsed.ptr;
+        return true;
+    }
+
+    /**
+     * Reads "[start-end]", where either time may be negative.
+     */
+    bool interval(int& start, int& finish) {
+        return literal("[") && integer(start) && literal("-") && integer(finish) && literal("]");
+    }
+
+    std::string_view rest() const { return std::string_view(p, end - p); }
+
+private:
+    const char* p;
+    const char* const end;
+};
+
+/**
+ * Reader for the text solution format. It walks the lines once and parses
+ * the fixed line grammar in place; lines that do not match are skipped.
+ */
+class TextSolutionReader {
+public:
+    TextSolutionReader(const char* data, size_t size) : p(data), end(data + size) {}
+
+    std::shared_ptr<ScheduleResult> read() {
+        auto result = std::make_shared<ScheduleResult>();
+        ProblemInstance& problem = result->problem;
+        Section section = METADATA;
+        std::shared_ptr<Job> job;
+        std::shared_ptr<Machine> machine;
+        std::string_view line;
+        while (nextLine(line)) {
+            Section next = sectionOf(line);
+            if (next != section && next != METADATA) {
+                if (section == METADATA) {
+                    problem.createJobs(problem.numJobs);
+                    problem.createMachines(problem.numMachines);
+                }
+                section = next;
+                continue;
+            }
+
+            LineScanner scan(line);
+            int a = 0, b = 0, start = 0, finish = 0;
+            switch (section) {
+                case METADATA:
+                    if (scan.literal("Jobs:")) {
+                        problem.numJobs = parseInt(scan.rest());
+                    } else if (scan.literal("Machines:")) {
+                        problem.numMachines = parseInt(scan.rest());
+                    }
+                    break;
+                case JOBS:
+                    // "Job J:" then "  Operation X: Machine Y [s-e]" lines
+                    if (scan.literal("  Operation ")) {
+                        if (job && scan.integer(a) && scan.literal(": Machine ") && scan.integer(b) &&
+                            scan.literal(" ") && scan.interval(start, finish)) {
+                            auto operation = std::make_shared<Operation>(job->jobId, b, finish - start, a);
+                            operation->setScheduled(start, finish);
+                            job->addOperation(operation);
+                        }
+                    } else {
+                        job = scan.literal("Job ") && scan.integer(a) && scan.literal(":") ? problem.getJob(a) : nullptr;
+                    }
+                    break;
+                case MACHINES:
+                    // "Machine M:" then "  Job J Operation X [s-e]" lines
+                    if (scan.literal("  Job ")) {
+                        if (machine && scan.integer(a) && scan.literal(" Operation ") && scan.integer(b) &&
+                            scan.literal(" ") && scan.interval(start, finish)) {
+                            auto operation = std::make_shared<Operation>(a, machine->machineId, finish - start, b);
+                            operation->setScheduled(start, finish);
+                            machine->scheduledOperations.push_back(operation);
+                            machine->availableTime = finish;
+                        }
+                    } else {
+                        machine = scan.literal("Machine ") && scan.integer(a) && scan.literal(":")
+                                      ? problem.getMachine(a)
+                                      : nullptr;
+                    }
+                    break;
+                case METRICS:
+                    if (scan.literal("Makespan: ")) {
+                        result->makespan = parseInt(scan.rest());
+                    } else if (scan.literal("Total Completion Time: ")) {
+                        result->totalCompletionTime = parseInt(scan.rest());
+                    } else if (scan.literal("Average Flow Time: ")) {
+                        result->avgFlowTime = parseDouble(scan.rest());
+                    }
+                    break;
+            }
+        }
+        if (section == METADATA) {
+            problem.createJobs(problem.numJobs);
+            problem.createMachines(problem.numMachines);
+        }
+        return result;
+    }
+
+private:
+    enum Section { METADATA, JOBS, MACHINES, METRICS };
+
+    /**
+     * Returns the section a heading line starts, or METADATA for other lines.
+     */
+    static Section sectionOf(std::string_view line) {
+        if (line == "SCHEDULING RESULTS:") {
+            return JOBS;
+        } else if (line == "MACHINE SCHEDULES:") {
+            return MACHINES;
+        } else if (line == "PERFORMANCE METRICS:") {
+            return METRICS;
+        }
+        return METADATA;
+    }
+
+    /**
+     * Returns the next line without its line ending.
+     */
+    bool nextLine(std::string_view& line) {
+        if (p >= end) {
+            return false;
+        }
+        const char* newline = static_cast<const char*>(std::memchr(p, '\n', end - p));
+        const char* lineEnd = newline ? newline : end;
+        line = std::string_view(p, lineEnd - p);
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        p = newline ? newline + 1 : end;
+        return true;
+    }
+
+    const char* p;
+    const char* const end;
+};
+
+} // namespace
+
+/**
+ * Reads a text solution in a single pass over the buffer.
+ *
+ * Args:
+ *   data: Solution text.
+ *   size: Number of bytes.
+ *
+ * Returns:
+ *   Loaded schedule result.
+ */
+std::shared_ptr<ScheduleResult> SolutionReader::readText(const char* data, size_t size) {
+    return TextSolutionReader(data, size).read();
+}
+
+/**
+ * Reads a JSON solution with a SAX handler.
+ *
+ * Args:
+ *   data: JSON text.
+ *   size: Number of bytes.
+ *
+ * Returns:
+ *   Loaded schedule result.
+ */
+std::shared_ptr<ScheduleResult> SolutionReader::readJSON(const char* data, size_t size) {
+    SolutionRecords records;
+    records.reserve(operationCountHint(std::string_view(data, size), "\"totalOperations\""));
+    JSONSolutionHandler handler(records);
+    json::sax_parse(data, data + size, &handler);
+    return records.build("JSON");
+}
+
+/**
+ * Reads an XML solution with a pull parser.
+ *
+ * Args:
+ *   data: XML text.
+ *   size: Number of bytes.
+ *
+ * Returns:
+ *   Loaded schedule result.
+ */
+std::shared_ptr<ScheduleResult> SolutionReader::readXML(const char* data, size_t size) {
+    SolutionRecords records;
+    records.reserve(operationCountHint(std::string_view(data, size), "<totalOperations>"));
+    XMLSolutionReader(data, size, records).read();
+    return records.build("XML");
+}
@@ -1,4 +1,71 @@
 #include "solution_serializer.hpp"
+#include "binary_solution.hpp"
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+const size_t WRITE_BUFFER_BYTES = 1 << 20;
+const size_t MAX_NUMBER_BYTES = 24;
+
+/**
+ * Fixed-size write buffer in front of an output stream.
+ */
+class OutputBuffer {
+public:
+    explicit OutputBuffer(std::ostream& out)
+        : out(out), buffer(WRITE_BUFFER_BYTES), p(buffer.data()), limit(buffer.data() + buffer.size()) {}
+
+    ~OutputBuffer() { flush(); }
+
+    OutputBuffer& operator<<(std::string_view text) {
+        if (static_cast<size_t>(limit - p) < text.size()) {
+            flush();
+            if (text.size() > buffer.size()) {
+                out.write(text.data(), static_cast<std::streamsize>(text.size()));
+                return *this;
+            }
+        }
+        std::memcpy(p, text.data(), text.size());
+        p += text.size();
+        return *this;
+    }
+
+    OutputBuffer& operator<<(long long value) {
+        if (static_cast<size_t>(limit - p) < MAX_NUMBER_BYTES) {
+            flush();
+        }
+        p = std::to_chars(p, limit, value).ptr;
+        return *this;
+    }
+
+    OutputBuffer& operator<<(int value) { return *this << static_cast<long long>(value); }
+
+    /**
+     * Formats a double like std::ostream does by default (%g, precision 6).
+     */
+    OutputBuffer& operator<<(double value) {
+        char text[MAX_NUMBER_BYTES + 8];
+        int length = std::snprintf(text, sizeof(text), "%g", value);
+        return *this << std::string_view(text, static_cast<size_t>(length));
+    }
+
+    void flush() {
+        out.write(buffer.data(), p - buffer.data());
+        p = buffer.data();
+    }
+
+private:
+    std::ostream& out;
+    std::vector<char> buffer;
+    char* p;
+    char* const limit;
+};
+
+} // namespace
 
 /**
  * Exports a ScheduleResult to a file in the specified format.
@@ -25,6 +92,9 @@ void SolutionSerializer::exportSolution(const std::shared_ptr<ScheduleResult>& r
         case ExportFormat::XML:
             exportXML(result, filename);
             break;
+        case ExportFormat::BINARY:
+            exportBinary(result, filename);
+            break;
     }
 }
 
@@ -37,59 +107,73 @@ void SolutionSerializer::exportSolution(const std::shared_ptr<ScheduleResult>& r
  */
 void SolutionSerializer::exportText(const std::shared_ptr<ScheduleResult>& result,
                                    const std::string& filename) {
-    std::ofstream file(filename);
+    std::ofstream file(filename, std::ios::binary);
     if (!file.is_open()) {
         throw std::runtime_error("Could not create file: " + filename);
     }
-    
+    writeText(result, file);
+    file.close();
+    if (!file) {
+        throw std::runtime_error("Could not write file: " + filename);
+    }
+}
+
+/**
+ * Streams a ScheduleResult in text format through a fixed-size buffer.
+ *
+ * Args:
+ *   result: Schedule result to write.
+ *   out: Output stream.
+ */
+void SolutionSerializer::writeText(const std::shared_ptr<ScheduleResult>& result, std::ostream& out) {
+    OutputBuffer buffer(out);
+
     // Header
-    file << "JSSP SOLUTION EXPORT\n";
-    file << "===================\n\n";
+    buffer << "JSSP SOLUTION EXPORT\n";
+    buffer << "===================\n\n";
     
     // Problem metadata
-    file << "PROBLEM METADATA:\n";
-    file << "Jobs: " << result->problem.numJobs << "\n";
-    file << "Machines: " << result->problem.numMachines << "\n";
-    file << "Total Operations: " << result->problem.getTotalOperations() << "\n\n";
+    buffer << "PROBLEM METADATA:\n";
+    buffer << "Jobs: " << result->problem.numJobs << "\n";
+    buffer << "Machines: " << result->problem.numMachines << "\n";
+    buffer << "Total Operations: " << result->problem.getTotalOperations() << "\n\n";
     
     // Scheduling results
-    file << "SCHEDULING RESULTS:\n";
-    file << "===================\n\n";
+    buffer << "SCHEDULING RESULTS:\n";
+    buffer << "===================\n\n";
     
     for (const auto& job : result->problem.jobs) {
-        file << "Job " << job->jobId << ":\n";
+        buffer << "Job " << job->jobId << ":\n";
         for (const auto& operation : job->operations) {
             if (operation->isScheduled()) {
-                file << "  Operation " << operation->operationId 
-                     << ": Machine " << operation->machineId 
-                     << " [" << operation->startTime << "-" << operation->endTime << "]\n";
+                buffer << "  Operation " << operation->operationId
+                       << ": Machine " << operation->machineId
+                       << " [" << operation->startTime << "-" << operation->endTime << "]\n";
             }
         }
-        file << "\n";
+        buffer << "\n";
     }
     
     // Machine schedules
-    file << "MACHINE SCHEDULES:\n";
-    file << "==================\n\n";
+    buffer << "MACHINE SCHEDULES:\n";
+    buffer << "==================\n\n";
     
     for (const auto& machine : result->problem.machines) {
-        file << "Machine " << machine->machineId << ":\n";
+        buffer << "Machine " << machine->machineId << ":\n";
         for (const auto& operation : machine->scheduledOperations) {
-            file << "  Job " << operation->jobId 
-                 << " Operation " << operation->operationId 
-                 << " [" << operation->startTime << "-" << operation->endTime << "]\n";
+            buffer << "  Job " << operation->jobId
+                   << " Operation " << operation->operationId
+                   << " [" << operation->startTime << "-" << operation->endTime << "]\n";
         }
-        file << "\n";
+        buffer << "\n";
     }
     
     // Performance metrics
-    file << "PERFORMANCE METRICS:\n";
-    file << "====================\n";
-    file << "Makespan: " << result->makespan << "\n";
-    file << "Total Completion Time: " << result->totalCompletionTime << "\n";
-    file << "Average Flow Time: " << result->avgFlowTime << "\n\n";
-    
-    file.close();
+    buffer << "PERFORMANCE METRICS:\n";
+    buffer << "====================\n";
+    buffer << "Makespan: " << result->makespan << "\n";
+    buffer << "Total Completion Time: " << result->totalCompletionTime << "\n";
+    buffer << "Average Flow Time: " << result->avgFlowTime << "\n\n";
 }
 
 /**
@@ -101,63 +185,89 @@ void SolutionSerializer::exportText(const std::shared_ptr<ScheduleResult>& resul
  */
 void SolutionSerializer::exportJSON(const std::shared_ptr<ScheduleResult>& result,
                                    const std::string& filename) {
-    json j;
-    
-    // Problem metadata
-    j["problem"]["numJobs"] = result->problem.numJobs;
-    j["problem"]["numMachines"] = result->problem.numMachines;
-    j["problem"]["totalOperations"] = result->problem.getTotalOperations();
-    
-    // Operations data
-    json operations = json::array();
-    for (const auto& job : result->problem.jobs) {
-        for (const auto& operation : job->operations) {
-            json op;
-            op["jobId"] = operation->jobId;
-            op["machineId"] = operation->machineId;
-            op["processingTime"] = operation->processingTime;
-            op["operationId"] = operation->operationId;
-            op["startTime"] = operation->startTime;
-            op["endTime"] = operation->endTime;
-            op["scheduled"] = operation->isScheduled();
-            operations.push_back(op);
-        }
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("Could not create file: " + filename);
     }
-    j["operations"] = operations;
-    
+    writeJSON(result, file);
+    file.close();
+    if (!file) {
+        throw std::runtime_error("Could not write file: " + filename);
+    }
+}
+
+/**
+ * Streams a ScheduleResult as JSON. The output is byte-identical to
+ * dumping the equivalent nlohmann::json document with std::setw(4):
+ * keys in sorted order, four-space indentation and a final newline.
+ *
+ * Args:
+ *   result: Schedule result to write.
+ *   out: Output stream.
+ */
+void SolutionSerializer::writeJSON(const std::shared_ptr<ScheduleResult>& result, std::ostream& out) {
+    OutputBuffer buffer(out);
+    buffer << "{\n";
+
     // Machine schedules
-    json machines = json::array();
+    buffer << "    \"machines\": [";
+    const char* separator = "\n";
     for (const auto& machine : result->problem.machines) {
-        json m;
-        m["machineId"] = machine->machineId;
-        m["availableTime"] = machine->availableTime;
-        
-        json scheduledOps = json::array();
+        buffer << separator
+               << "        {\n"
+               << "            \"availableTime\": " << machine->availableTime << ",\n"
+               << "            \"machineId\": " << machine->machineId << ",\n"
+               << "            \"scheduledOperations\": [";
+        const char* opSeparator = "\n";
         for (const auto& operation : machine->scheduledOperations) {
-            json op;
-            op["jobId"] = operation->jobId;
-            op["operationId"] = operation->operationId;
-            op["startTime"] = operation->startTime;
-            op["endTime"] = operation->endTime;
-            scheduledOps.push_back(op);
+            buffer << opSeparator
+                   << "                {\n"
+                   << "                    \"endTime\": " << operation->endTime << ",\n"
+                   << "                    \"jobId\": " << operation->jobId << ",\n"
+                   << "                    \"operationId\": " << operation->operationId << ",\n"
+                   << "                    \"startTime\": " << operation->startTime << "\n"
+                   << "                }";
+            opSeparator = ",\n";
         }
-        m["scheduledOperations"] = scheduledOps;
-        machines.push_back(m);
+        buffer << (machine->scheduledOperations.empty() ? "]\n" : "\n            ]\n") << "        }";
+        separator = ",\n";
     }
-    j["machines"] = machines;
-    
-    // Performance metrics
-    j["metrics"]["makespan"] = result->makespan;
-    j["metrics"]["totalCompletionTime"] = result->totalCompletionTime;
-    j["metrics"]["averageFlowTime"] = result->avgFlowTime;
-    
-    // Write to file
-    std::ofstream file(filename);
-    if (!file.is_open()) {
-        throw std::runtime_error("Could not create file: " + filename);
+    buffer << (result->problem.machines.empty() ? "],\n" : "\n    ],\n");
+
+    // Performance metrics; doubles use the library's shortest round-trip form
+    buffer << "    \"metrics\": {\n"
+           << "        \"averageFlowTime\": " << json(result->avgFlowTime).dump() << ",\n"
+           << "        \"makespan\": " << result->makespan << ",\n"
+           << "        \"totalCompletionTime\": " << result->totalCompletionTime << "\n"
+           << "    },\n";
+
+    // Operations data
+    buffer << "    \"operations\": [";
+    separator = "\n";
+    for (const auto& job : result->problem.jobs) {
+        for (const auto& operation : job->operations) {
+            buffer << separator
+                   << "        {\n"
+                   << "            \"endTime\": " << operation->endTime << ",\n"
+                   << "            \"jobId\": " << operation->jobId << ",\n"
+                   << "            \"machineId\": " << operation->machineId << ",\n"
+                   << "            \"operationId\": " << operation->operationId << ",\n"
+                   << "            \"processingTime\": " << operation->processingTime << ",\n"
+                   << "            \"scheduled\": " << (operation->isScheduled() ? "true" : "false") << ",\n"
+                   << "            \"startTime\": " << operation->startTime << "\n"
+                   << "        }";
+            separator = ",\n";
+        }
     }
-    file << std::setw(4) << j << std::endl;
-    file.close();
+    buffer << (result->problem.getTotalOperations() == 0 ? "],\n" : "\n    ],\n");
+
+    // Problem metadata
+    buffer << "    \"problem\": {\n"
+           << "        \"numJobs\": " << result->problem.numJobs << ",\n"
+           << "        \"numMachines\": " << result->problem.numMachines << ",\n"
+           << "        \"totalOperations\": " << result->problem.getTotalOperations() << "\n"
+           << "    }\n"
+           << "}\n";
 }
 
 /**
@@ -169,67 +279,103 @@ void SolutionSerializer::exportJSON(const std::shared_ptr<ScheduleResult>& resul
  */
 void SolutionSerializer::exportXML(const std::shared_ptr<ScheduleResult>& result,
                                   const std::string& filename) {
-    std::ofstream file(filename);
+    std::ofstream file(filename, std::ios::binary);
     if (!file.is_open()) {
         throw std::runtime_error("Could not create file: " + filename);
     }
-    
-    file << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
-    file << "<jssp_solution>\n";
+    writeXML(result, file);
+    file.close();
+    if (!file) {
+        throw std::runtime_error("Could not write file: " + filename);
+    }
+}
+
+/**
+ * Streams a ScheduleResult in XML format through a fixed-size buffer.
+ *
+ * Args:
+ *   result: Schedule result to write.
+ *   out: Output stream.
+ */
+void SolutionSerializer::writeXML(const std::shared_ptr<ScheduleResult>& result, std::ostream& out) {
+    OutputBuffer buffer(out);
+
+    buffer << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+    buffer << "<jssp_solution>\n";
     
     // Problem metadata
-    file << "  <problem>\n";
-    file << "    <numJobs>" << result->problem.numJobs << "</numJobs>\n";
-    file << "    <numMachines>" << result->problem.numMachines << "</numMachines>\n";
-    file << "    <totalOperations>" << result->problem.getTotalOperations() << "</totalOperations>\n";
-    file << "  </problem>\n\n";
+    buffer << "  <problem>\n";
+    buffer << "    <numJobs>" << result->problem.numJobs << "</numJobs>\n";
+    buffer << "    <numMachines>" << result->problem.numMachines << "</numMachines>\n";
+    buffer << "    <totalOperations>" << result->problem.getTotalOperations() << "</totalOperations>\n";
+    buffer << "  </problem>\n\n";
     
     // Operations
-    file << "  <operations>\n";
+    buffer << "  <operations>\n";
     for (const auto& job : result->problem.jobs) {
         for (const auto& operation : job->operations) {
-            file << "    <operation>\n";
-            file << "      <jobId>" << operation->jobId << "</jobId>\n";
-            file << "      <machineId>" << operation->machineId << "</machineId>\n";
-            file << "      <processingTime>" << operation->processingTime << "</processingTime>\n";
-            file << "      <operationId>" << operation->operationId << "</operationId>\n";
-            file << "      <startTime>" << operation->startTime << "</startTime>\n";
-            file << "      <endTime>" << operation->endTime << "</endTime>\n";
-            file << "      <scheduled>" << (operation->isScheduled() ? "true" : "false") << "</scheduled>\n";
-            file << "    </operation>\n";
+            buffer << "    <operation>\n"
+                   << "      <jobId>" << operation->jobId << "</jobId>\n"
+                   << "      <machineId>" << operation->machineId << "</machineId>\n"
+                   << "      <processingTime>" << operation->processingTime << "</processingTime>\n"
+                   << "      <operationId>" << operation->operationId << "</operationId>\n"
+                   << "      <startTime>" << operation->startTime << "</startTime>\n"
+                   << "      <endTime>" << operation->endTime << "</endTime>\n"
+                   << "      <scheduled>" << (operation->isScheduled() ? "true" : "false") << "</scheduled>\n"
+                   << "    </operation>\n";
         }
     }
-    file << "  </operations>\n\n";
+    buffer << "  </operations>\n\n";
     
     // Machines
-    file << "  <machines>\n";
+    buffer << "  <machines>\n";
     for (const auto& machine : result->problem.machines) {
-        file << "    <machine>\n";
-        file << "      <machineId>" << machine->machineId << "</machineId>\n";
-        file << "      <availableTime>" << machine->availableTime << "</availableTime>\n";
-        file << "      <scheduledOperations>\n";
+        buffer << "    <machine>\n";
+        buffer << "      <machineId>" << machine->machineId << "</machineId>\n";
+        buffer << "      <availableTime>" << machine->availableTime << "</availableTime>\n";
+        buffer << "      <scheduledOperations>\n";
         for (const auto& operation : machine->scheduledOperations) {
-            file << "        <scheduledOperation>\n";
-            file << "          <jobId>" << operation->jobId << "</jobId>\n";
-            file << "          <operationId>" << operation->operationId << "</operationId>\n";
-            file << "          <startTime>" << operation->startTime << "</startTime>\n";
-            file << "          <endTime>" << operation->endTime << "</endTime>\n";
-            file << "        </scheduledOperation>\n";
+            buffer << "        <scheduledOperation>\n"
+                   << "          <jobId>" << operation->jobId << "</jobId>\n"
+                   << "          <operationId>" << operation->operationId << "</operationId>\n"
+                   << "          <startTime>" << operation->startTime << "</startTime>\n"
+                   << "          <endTime>" << operation->endTime << "</endTime>\n"
+                   << "        </scheduledOperation>\n";
         }
-        file << "      </scheduledOperations>\n";
-        file << "    </machine>\n";
+        buffer << "      </scheduledOperations>\n";
+        buffer << "    </machine>\n";
     }
-    file << "  </machines>\n\n";
+    buffer << "  </machines>\n\n";
     
     // Metrics
-    file << "  <metrics>\n";
-    file << "    <makespan>" << result->makespan << "</makespan>\n";
-    file << "    <totalCompletionTime>" << result->totalCompletionTime << "</totalCompletionTime>\n";
-    file << "    <averageFlowTime>" << result->avgFlowTime << "</averageFlowTime>\n";
-    file << "  </metrics>\n";
+    buffer << "  <metrics>\n";
+    buffer << "    <makespan>" << result->makespan << "</makespan>\n";
+    buffer << "    <totalCompletionTime>" << result->totalCompletionTime << "</totalCompletionTime>\n";
+    buffer << "    <averageFlowTime>" << result->avgFlowTime << "</averageFlowTime>\n";
+    buffer << "  </metrics>\n";
     
-    file << "</jssp_solution>\n";
+    buffer << "</jssp_solution>\n";
+}
+
+/**
+ * Exports a ScheduleResult to the compact binary format.
+ *
+ * Args:
+ *   result: Schedule result to export.
+ *   filename: Output file path.
+ */
+void SolutionSerializer::exportBinary(const std::shared_ptr<ScheduleResult>& result,
+                                     const std::string& filename) {
+    std::string data = BinarySolution::encode(*result);
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        throw std::runtime_error("Could not create file: " + filename);
+    }
+    file.write(data.data(), static_cast<std::streamsize>(data.size()));
     file.close();
+    if (!file) {
+        throw std::runtime_error("Could not write file: " + filename);
+    }
 }
 
 /**
@@ -243,7 +389,9 @@ void SolutionSerializer::exportXML(const std::shared_ptr<ScheduleResult>& result
  */
 ExportFormat SolutionSerializer::detectFormat(const std::string& filename) {
     std::string ext = filename.substr(filename.find_last_of('.') + 1);
-    if (ext == "json" || ext == "JSON") {
+    if (ext == "jsol" || ext == "JSOL") {
+        return ExportFormat::BINARY;
+    } else if (ext == "json" || ext == "JSON") {
         return ExportFormat::JSON;
     } else if (ext == "xml" || ext == "XML") {
         return ExportFormat::XML;
@@ -266,6 +414,7 @@ std::string SolutionSerializer::getFormatName(ExportFormat format) {
         case ExportFormat::TEXT: return "Text (.txt)";
         case ExportFormat::JSON: return "JSON (.json)";
         case ExportFormat::XML: return "XML (.xml)";
+        case ExportFormat::BINARY: return "Binary (.jsol)";
         default: return "Unknown";
     }
 }
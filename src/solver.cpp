@@ -1,4 +1,12 @@
 #include "solver.hpp"
+#include "lns_engine.hpp"
+#include "island_model.hpp"
+#include "checkpoint.hpp"
+#include "elite_pool.hpp"
+#include "path_relinking.hpp"
+#include "result_cache.hpp"
+#include "sequence_hash.hpp"
+#include <chrono>
 #include <iomanip>
 
 // FIFO (First-In-First-Out) Algorithm Implementation
@@ -114,6 +122,139 @@ void Solver::scheduleLPT(std::shared_ptr<ProblemInstance> problem) {
     });
 }
 
+// LNS (Large Neighborhood Search) Implementation
+void Solver::scheduleLNS(std::shared_ptr<ProblemInstance> problem) {
+    // SPT gives the starting schedule
+    scheduleSPT(problem);
+    
+    std::cout << "Improving with LNS (" << config.lnsIterations << " iterations)..." << std::endl;
+    FlatInstance flat = FlatInstance::fromProblem(*problem);
+    LNSEngine engine(flat, config.lns);
+    ElitePool elites(std::max(1, config.eliteSize));
+    if (config.eliteSize > 0) {
+        engine.setElitePool(&elites);
+    }
+    engine.reset(flat.machineSequences(*problem));
+    int initialMakespan = engine.getBestMakespan();
+    
+    if (checkpointPath.empty()) {
+        engine.runIterations(config.lnsIterations);
+    } else {
+        // Resume from a checkpoint of this instance and config, then save periodically
+        CheckpointFile checkpoint(checkpointPath);
+        SearchCheckpoint state;
+        uint64_t fingerprint = CheckpointFile::fingerprint(flat);
+        // The iteration budget may grow between runs; every other parameter must match
+        SolverConfig resumable = config;
+        resumable.lnsIterations = 0;
+        uint64_t configFingerprint = CheckpointFile::fingerprint(resumable.toString());
+        if (checkpoint.read(state) && state.instanceFingerprint == fingerprint &&
+            state.configFingerprint == configFingerprint) {
+            engine.restoreState(state);
+            std::cout << "Resuming LNS from " << checkpointPath << " at iteration "
+                      << engine.getStatistics().iterations << std::endl;
+        }
+        
+        auto save = [&]() {
+            engine.saveState(state);
+            state.instanceFingerprint = fingerprint;
+            state.configFingerprint = configFingerprint;
+            checkpoint.write(state);
+        };
+        auto lastSave = std::chrono::steady_clock::now();
+        while (engine.getStatistics().iterations < config.lnsIterations) {
+            engine.runIterations(1);
+            auto now = std::chrono::steady_clock::now();
+            if (std::chrono::duration<double>(now - lastSave).count() >= checkpointInterval) {
+                save();
+                lastSave = now;
+            }
+        }
+        save();
+    }
+    
+    const LNSStatistics& stats = engine.getStatistics();
+    std::cout << "LNS makespan " << initialMakespan << " -> " << engine.getBestMakespan()
+              << " (" << stats.improvements << " improvements, " << stats.subproblems << " subproblems, "
+              << stats.provenOptimal << " solved exactly)" << std::endl;
+    
+    MachineSequences best = engine.getBestSequences();
+    int bestMakespan = engine.getBestMakespan();
+    if (config.eliteSize > 0) {
+        relinkElites(flat, elites, best, bestMakespan);
+    }
+    
+    SequenceSchedule schedule(flat);
+    schedule.load(best);
+    schedule.applyTo(*problem);
+}
+
+// Island-model LNS Implementation
+void Solver::scheduleIslands(std::shared_ptr<ProblemInstance> problem) {
+    // Island workers run in separate processes and have no resumable state
+    if (!checkpointPath.empty()) {
+        std::cerr << "Warning: checkpointing covers LNS only; islands run without " << checkpointPath
+                  << std::endl;
+    }
+    
+    // SPT gives the starting schedule of every island
+    scheduleSPT(problem);
+    
+    IslandConfig islands;
+    islands.islands = config.islands;
+    islands.iterations = config.lnsIterations;
+    islands.migrationInterval = config.migrationInterval;
+    islands.lns = config.lns;
+    islands.lns.threads = 1;
+    
+    std::cout << "Improving with " << islands.islands << " LNS islands (" << islands.iterations
+              << " iterations each)..." << std::endl;
+    FlatInstance flat = FlatInstance::fromProblem(*problem);
+    MachineSequences initial = flat.machineSequences(*problem);
+    SequenceSchedule schedule(flat);
+    schedule.load(initial);
+    int initialMakespan = schedule.getMakespan();
+    
+    ElitePool elites(std::max(1, config.eliteSize));
+    IslandResult result = IslandModel(flat, islands).run(initial, config.eliteSize > 0 ? &elites : nullptr);
+    std::cout << "Island makespan " << initialMakespan << " -> " << result.makespan << " ("
+              << result.completedIslands << " islands completed, " << result.failedIslands << " failed, "
+              << result.migrationsAccepted << " migrations accepted)" << std::endl;
+    
+    if (config.eliteSize > 0) {
+        relinkElites(flat, elites, result.sequences, result.makespan);
+    }
+    // Keep the SPT start if the result does not time
+    if (!schedule.load(result.sequences)) {
+        std::cout << "Island result is cyclic; keeping the SPT schedule" << std::endl;
+        return;
+    }
+    schedule.applyTo(*problem);
+}
+
+// Path relinking phase over the elites of an improvement engine
+void Solver::relinkElites(const FlatInstance& flat, ElitePool& elites, MachineSequences& best,
+                          int& bestMakespan) const {
+    elites.tryInsert(best, bestMakespan);
+    int members = elites.size();
+    if (members < 2) {
+        return;
+    }
+    
+    // Paths from the same member share their first steps; time each schedule once
+    EvaluationCache cache(1 << 16);
+    PathRelinker relinker(flat);
+    relinker.setCache(&cache);
+    int relinked = relinker.runPhase(elites, config.lns.threads, config.lns.seed);
+    std::cout << "Path relinking over " << members << " elites: " << bestMakespan << " -> "
+              << std::min(bestMakespan, relinked) << " (" << static_cast<int>(cache.getHitRate() * 100)
+              << "% of schedules cached)" << std::endl;
+    if (relinked < bestMakespan) {
+        best = elites.getBest().sequences;
+        bestMakespan = relinked;
+    }
+}
+
 // Generic priority-based scheduling
 void Solver::scheduleWithPriority(std::shared_ptr<ProblemInstance> problem, 
                                  std::function<bool(const std::shared_ptr<Operation>&, 
@@ -188,19 +329,38 @@ std::shared_ptr<ScheduleResult> Solver::solve(std::shared_ptr<ProblemInstance> p
     
     auto result = std::make_shared<ScheduleResult>();
     
+    // A verified cache hit schedules the problem without running the algorithm
+    std::string cacheKey;
+    bool cached = false;
+    if (cache) {
+        cacheKey = ResultCache::makeKey(*problem, algorithm, config);
+        cached = cache->lookup(cacheKey, *problem);
+        if (cached) {
+            std::cout << "Loaded schedule from cache " << cache->getDirectory() << std::endl;
+        }
+    }
+    
     // Schedule based on algorithm
-    switch (algorithm) {
-        case SchedulingAlgorithm::FIFO:
-            scheduleFIFO(problem);
-            break;
-        case SchedulingAlgorithm::SPT:
-            scheduleSPT(problem);
-            break;
-        case SchedulingAlgorithm::LPT:
-            scheduleLPT(problem);
-            break;
-        default:
-            throw std::runtime_error("Unknown algorithm");
+    if (!cached) {
+        switch (algorithm) {
+            case SchedulingAlgorithm::FIFO:
+                scheduleFIFO(problem);
+                break;
+            case SchedulingAlgorithm::SPT:
+                scheduleSPT(problem);
+                break;
+            case SchedulingAlgorithm::LPT:
+                scheduleLPT(problem);
+                break;
+            case SchedulingAlgorithm::LNS:
+                scheduleLNS(problem);
+                break;
+            case SchedulingAlgorithm::ISLANDS:
+                scheduleIslands(problem);
+                break;
+            default:
+                throw std::runtime_error("Unknown algorithm");
+        }
     }
     
     result->problem = *problem; // Copy problem AFTER scheduling
@@ -208,6 +368,14 @@ std::shared_ptr<ScheduleResult> Solver::solve(std::shared_ptr<ProblemInstance> p
     // Calculate metrics
     result->calculateMetrics();
     
+    if (cache && !cached) {
+        try {
+            cache->store(cacheKey, *result);
+        } catch (const std::exception& e) {
+            std::cerr << "Warning: " << e.what() << std::endl;
+        }
+    }
+    
     std::cout << "\nScheduling completed!" << std::endl;
     std::cout << "Algorithm: " << getCurrentAlgorithmName() << std::endl;
     std::cout << "Makespan: " << result->makespan << std::endl;
@@ -218,7 +386,7 @@ std::shared_ptr<ScheduleResult> Solver::solve(std::shared_ptr<ProblemInstance> p
 }
 
 // Constructor
-Solver::Solver(SchedulingAlgorithm algo) : algorithm(algo) {}
+Solver::Solver(SchedulingAlgorithm algo) : algorithm(algo), checkpointInterval(5.0) {}
 
 // Set algorithm
 void Solver::setAlgorithm(SchedulingAlgorithm algo) { 
@@ -230,6 +398,52 @@ SchedulingAlgorithm Solver::getAlgorithm() const {
     return algorithm; 
 }
 
+// Set LNS iterations
+void Solver::setLNSIterations(int iterations) {
+    config.lnsIterations = std::max(0, iterations);
+}
+
+// Get LNS iterations
+int Solver::getLNSIterations() const {
+    return config.lnsIterations;
+}
+
+// Set engine config
+void Solver::setConfig(const SolverConfig& newConfig) {
+    config = newConfig;
+}
+
+// Get engine config
+const SolverConfig& Solver::getConfig() const {
+    return config;
+}
+
+// Load engine config from file
+void Solver::loadConfig(const std::string& filename) {
+    config = SolverConfig::loadFromFile(filename);
+}
+
+// Set checkpoint file
+void Solver::setCheckpoint(const std::string& path, double intervalSeconds) {
+    checkpointPath = path;
+    checkpointInterval = std::max(0.0, intervalSeconds);
+}
+
+// Get checkpoint file
+const std::string& Solver::getCheckpointPath() const {
+    return checkpointPath;
+}
+
+// Set result cache
+void Solver::setCache(std::shared_ptr<ResultCache> resultCache) {
+    cache = std::move(resultCache);
+}
+
+// Get result cache
+std::shared_ptr<ResultCache> Solver::getCache() const {
+    return cache;
+}
+
 // Static factory methods
 std::shared_ptr<Solver> Solver::createFIFOSolver() {
     return std::make_shared<Solver>(SchedulingAlgorithm::FIFO);
@@ -243,12 +457,22 @@ std::shared_ptr<Solver> Solver::createLPTSolver() {
     return std::make_shared<Solver>(SchedulingAlgorithm::LPT);
 }
 
+std::shared_ptr<Solver> Solver::createLNSSolver() {
+    return std::make_shared<Solver>(SchedulingAlgorithm::LNS);
+}
+
+std::shared_ptr<Solver> Solver::createIslandSolver() {
+    return std::make_shared<Solver>(SchedulingAlgorithm::ISLANDS);
+}
+
 // Get algorithm name
 std::string Solver::getAlgorithmName(SchedulingAlgorithm algo) {
     switch (algo) {
         case SchedulingAlgorithm::FIFO: return "FIFO (First-In-First-Out)";
         case SchedulingAlgorithm::SPT: return "SPT (Shortest Processing Time)";
         case SchedulingAlgorithm::LPT: return "LPT (Longest Processing Time)";
+        case SchedulingAlgorithm::LNS: return "LNS (Large Neighborhood Search)";
+        case SchedulingAlgorithm::ISLANDS: return "Island LNS (Multi-Process)";
         default: return "Unknown";
     }
 }
@@ -0,0 +1,191 @@
+#include "solver_config.hpp"
+#include <algorithm>
+#include <climits>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+
+/**
+ * Removes leading and trailing whitespace.
+ */
+std::string trim(const std::string& text) {
+    size_t begin = text.find_first_not_of(" \t\r");
+    if (begin == std::string::npos) return "";
+    size_t end = text.find_last_not_of(" \t\r");
+    return text.substr(begin, end - begin + 1);
+}
+
+/**
+ * Smallest value accepted for a key.
+ */
+long minimumValue(const std::string& key) {
+    if (key == "block_size") return 2;
+    if (key == "machines_per_subproblem" || key == "node_limit") return 1;
+    if (key == "islands" || key == "migration_interval") return 1;
+    return 0;
+}
+
+} // namespace
+
+/**
+ * Parses a config from "key = value" text.
+ *
+ * Args:
+ *   text: Config file contents.
+ *
+ * Returns:
+ *   Parsed config.
+ */
+SolverConfig SolverConfig::parseString(const std::string& text) {
+    SolverConfig config;
+    std::istringstream stream(text);
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(stream, line)) {
+        ++lineNumber;
+        size_t comment = line.find('#');
+        if (comment != std::string::npos) line.erase(comment);
+        line = trim(line);
+        if (line.empty()) continue;
+
+        size_t equals = line.find('=');
+        if (equals == std::string::npos) {
+            throw std::invalid_argument("Config line " + std::to_string(lineNumber) + ": expected key = value");
+        }
+        std::string key = trim(line.substr(0, equals));
+        std::string value = trim(line.substr(equals + 1));
+
+        size_t used = 0;
+        long parsed = 0;
+        try {
+            parsed = std::stol(value, &used);
+        } catch (const std::exception&) {
+            used = 0;
+        }
+        if (used == 0 || used != value.size()) {
+            throw std::invalid_argument("Config line " + std::to_string(lineNumber) + ": invalid value '" + value + "'");
+        }
+        config.setValue(key, parsed);
+    }
+    return config;
+}
+
+/**
+ * Loads a config file.
+ *
+ * Args:
+ *   filename: Path to config file.
+ *
+ * Returns:
+ *   Parsed config.
+ */
+SolverConfig SolverConfig::loadFromFile(const std::string& filename) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        throw std::runtime_error("Cannot open config file: " + filename);
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    return parseString(buffer.str());
+}
+
+/**
+ * Saves the config in the format read by loadFromFile.
+ *
+ * Args:
+ *   filename: Output file path.
+ */
+void SolverConfig::saveToFile(const std::string& filename) const {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        throw std::runtime_error("Cannot create config file: " + filename);
+    }
+    file << toString();
+}
+
+/**
+ * Formats the config as "key = value" lines.
+ *
+ * Returns:
+ *   Config file contents.
+ */
+std::string SolverConfig::toString() const {
+    std::ostringstream out;
+    for (const auto& key : getKeys()) {
+        out << key << " = " << getValue(key) << "\n";
+    }
+    return out.str();
+}
+
+/**
+ * Reads a parameter by its config key.
+ *
+ * Args:
+ *   key: Config key.
+ *
+ * Returns:
+ *   Parameter value.
+ */
+long SolverConfig::getValue(const std::string& key) const {
+    if (key == "lns_iterations") return lnsIterations;
+    if (key == "block_size") return lns.blockSize;
+    if (key == "machines_per_subproblem") return lns.machinesPerSubproblem;
+    if (key == "node_limit") return lns.nodeLimit;
+    if (key == "threads") return lns.threads;
+    if (key == "tabu_tenure") return lns.tabuTenure;
+    if (key == "seed") return static_cast<long>(lns.seed);
+    if (key == "islands") return islands;
+    if (key == "migration_interval") return migrationInterval;
+    if (key == "elite_size") return eliteSize;
+    throw std::invalid_argument("Unknown config key: " + key);
+}
+
+/**
+ * Writes a parameter by its config key.
+ *
+ * Args:
+ *   key: Config key.
+ *   value: New value.
+ */
+void SolverConfig::setValue(const std::string& key, long value) {
+    const auto& keys = getKeys();
+    if (std::find(keys.begin(), keys.end(), key) == keys.end()) {
+        throw std::invalid_argument("Unknown config key: " + key);
+    }
+    if (value < minimumValue(key) || (key != "seed" && value > INT_MAX)) {
+        throw std::invalid_argument("Config value out of range for " + key + ": " + std::to_string(value));
+    }
+    int narrow = static_cast<int>(value);
+    if (key == "lns_iterations") lnsIterations = narrow;
+    else if (key == "block_size") lns.blockSize = narrow;
+    else if (key == "machines_per_subproblem") lns.machinesPerSubproblem = narrow;
+    else if (key == "node_limit") lns.nodeLimit = narrow;
+    else if (key == "threads") lns.threads = narrow;
+    else if (key == "tabu_tenure") lns.tabuTenure = narrow;
+    else if (key == "islands") islands = narrow;
+    else if (key == "migration_interval") migrationInterval = narrow;
+    else if (key == "elite_size") eliteSize = narrow;
+    else lns.seed = static_cast<uint64_t>(value);
+}
+
+/**
+ * Gets all config keys in file order.
+ *
+ * Returns:
+ *   Config keys.
+ */
+const std::vector<std::string>& SolverConfig::getKeys() {
+    static const std::vector<std::string> keys = {
+        "lns_iterations", "block_size", "machines_per_subproblem", "node_limit", "threads", "tabu_tenure", "seed",
+        "islands", "migration_interval", "elite_size"};
+    return keys;
+}
+
+bool SolverConfig::operator==(const SolverConfig& other) const {
+    for (const auto& key : getKeys()) {
+        if (getValue(key) != other.getValue(key)) return false;
+    }
+    return true;
+}
@@ -0,0 +1,172 @@
+#include "text_batch.hpp"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * Constructor for TextBatch.
+ *
+ * Args:
+ *   font: Font to lay out and draw with.
+ */
+TextBatch::TextBatch(const sf::Font& font) : font(font) {}
+
+/**
+ * Removes all labels. Cached layouts are kept.
+ */
+void TextBatch::clear() {
+    for (auto& entry : pages) {
+        entry.second.vertices.clear();
+    }
+}
+
+/**
+ * Adds a label. The offset is rounded to whole pixels, so glyphs are sampled
+ * from the atlas without blurring.
+ *
+ * Args:
+ *   text: Label text; one line.
+ *   size: Character size.
+ *   position: Position of the anchor point.
+ *   color: Text color.
+ *   anchor: Fraction of the text size the label is moved back by.
+ */
+void TextBatch::add(const std::string& text, unsigned size, sf::Vector2f position, sf::Color color,
+                    sf::Vector2f anchor) {
+    Page& page = pages[size];
+    const Layout& cached = layout(page, text, size);
+    float offsetX = std::round(position.x - anchor.x * cached.bounds.width);
+    float offsetY = std::round(position.y - anchor.y * cached.bounds.height);
+    for (const sf::Vertex& vertex : cached.vertices) {
+        page.vertices.append(sf::Vertex(sf::Vector2f(vertex.position.x + offsetX, vertex.position.y + offsetY), color,
+                                        vertex.texCoords));
+    }
+}
+
+/**
+ * Gets the bounds of a string, as sf::Text::getLocalBounds would.
+ *
+ * Args:
+ *   text: Text.
+ *   size: Character size.
+ *
+ * Returns:
+ *   Bounds relative to the text origin.
+ */
+sf::FloatRect TextBatch::getLocalBounds(const std::string& text, unsigned size) {
+    return layout(pages[size], text, size).bounds;
+}
+
+/**
+ * Draws all labels, one draw call per character size.
+ *
+ * Args:
+ *   target: Window or render texture to draw to.
+ */
+void TextBatch::draw(sf::RenderTarget& target) {
+    for (auto& entry : pages) {
+        if (entry.second.vertices.getVertexCount() > 0) {
+            sf::RenderStates states(&font.getTexture(entry.first));
+            target.draw(entry.second.vertices, states);
+        }
+    }
+}
+
+/**
+ * Gets the number of glyphs added since the last clear().
+ *
+ * Returns:
+ *   Glyph count.
+ */
+size_t TextBatch::getGlyphCount() const {
+    size_t vertices = 0;
+    for (const auto& entry : pages) {
+        vertices += entry.second.vertices.getVertexCount();
+    }
+    return vertices / 6;
+}
+
+/**
+ * Gets the number of cached layouts over all character sizes.
+ *
+ * Returns:
+ *   Layout count.
+ */
+size_t TextBatch::getLayoutCount() const {
+    size_t layouts = 0;
+    for (const auto& entry : pages) {
+        layouts += entry.second.layouts.size();
+    }
+    return layouts;
+}
+
+/**
+ * Gets the cached layout of a string, computing it on first use. Follows
+ * sf::Text for regular text: kerning between characters, the space advance
+ * for blanks, and glyph quads padded by a pixel.
+ */
+const TextBatch::Layout& TextBatch::layout(Page& page, const std::string& text, unsigned size) {
+    auto found = page.layouts.find(text);
+    if (found != page.layouts.end()) {
+        return found->second;
+    }
+    if (page.layouts.size() >= MAX_LAYOUTS) {
+        page.layouts.clear();
+    }
+
+    Layout& result = page.layouts[text];
+    if (text.empty()) {
+        return result;
+    }
+    result.vertices.reserve(text.size() * 6);
+
+    const float padding = 1.0f;
+    float whitespaceWidth = font.getGlyph(U' ', size, false).advance;
+    float x = 0;
+    float y = static_cast<float>(size);
+    float minX = static_cast<float>(size);
+    float minY = static_cast<float>(size);
+    float maxX = 0;
+    float maxY = 0;
+    sf::Uint32 previous = 0;
+    for (unsigned char c : text) {
+        sf::Uint32 current = c;
+        x += font.getKerning(previous, current, size);
+        previous = current;
+
+        if (current == ' ' || current == '\t') {
+            x += current == ' ' ? whitespaceWidth : whitespaceWidth * 4;
+            maxX = std::max(maxX, x);
+            maxY = std::max(maxY, y);
+            continue;
+        }
+
+        const sf::Glyph& glyph = font.getGlyph(current, size, false);
+        float left = glyph.bounds.left;
+        float top = glyph.bounds.top;
+        float right = glyph.bounds.left + glyph.bounds.width;
+        float bottom = glyph.bounds.top + glyph.bounds.height;
+
+        float u1 = static_cast<float>(glyph.textureRect.left) - padding;
+        float v1 = static_cast<float>(glyph.textureRect.top) - padding;
+        float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width) + padding;
+        float v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height) + padding;
+        sf::Vector2f topLeft(x + left - padding, y + top - padding);
+        sf::Vector2f bottomRight(x + right + padding, y + bottom + padding);
+
+        sf::Color white = sf::Color::White;
+        result.vertices.emplace_back(topLeft, white, sf::Vector2f(u1, v1));
+        result.vertices.emplace_back(sf::Vector2f(bottomRight.x, topLeft.y), white, sf::Vector2f(u2, v1));
+        result.vertices.emplace_back(sf::Vector2f(topLeft.x, bottomRight.y), white, sf::Vector2f(u1, v2));
+        result.vertices.emplace_back(sf::Vector2f(topLeft.x, bottomRight.y), white, sf::Vector2f(u1, v2));
+        result.vertices.emplace_back(sf::Vector2f(bottomRight.x, topLeft.y), white, sf::Vector2f(u2, v1));
+        result.vertices.emplace_back(bottomRight, white, sf::Vector2f(u2, v2));
+
+        minX = std::min(minX, x + left);
+        maxX = std::max(maxX, x + right);
+        minY = std::min(minY, y + top);
+        maxY = std::max(maxY, y + bottom);
+        x += glyph.advance;
+    }
+    result.bounds = sf::FloatRect(minX, minY, maxX - minX, maxY - minY);
+    return result;
+}
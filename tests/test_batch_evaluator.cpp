@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+#include <random>
+#include <thread>
+#include "batch_evaluator.hpp"
+#include "flat_instance.hpp"
+#include "parser.hpp"
+#include "solver.hpp"
+
+class BatchEvaluatorTest : public ::testing::Test {
+protected:
+    /**
+     * SetUp method for test fixture.
+     */
+    void SetUp() override {
+        problem = Parser::generateSimpleProblem();
+        flat = FlatInstance::fromProblem(*problem);
+    }
+
+    /**
+     * Builds random job-repetition sequences for the fixture instance.
+     */
+    std::vector<std::vector<int>> randomSequences(int count, unsigned seed) {
+        std::vector<int> base;
+        for (int j = 0; j < flat.getNumJobs(); ++j) {
+            base.insert(base.end(), flat.jobLength(j), j);
+        }
+        std::mt19937 rng(seed);
+        std::vector<std::vector<int>> sequences;
+        for (int i = 0; i < count; ++i) {
+            std::shuffle(base.begin(), base.end(), rng);
+            sequences.push_back(base);
+        }
+        return sequences;
+    }
+
+    std::shared_ptr<ProblemInstance> problem;
+    FlatInstance flat;
+};
+
+TEST_F(BatchEvaluatorTest, FlatLayoutMatchesProblem) {
+    EXPECT_EQ(flat.getNumJobs(), 3);
+    EXPECT_EQ(flat.getNumMachines(), 3);
+    EXPECT_EQ(flat.getNumOperations(), 9);
+    EXPECT_EQ(flat.jobStart(1), 3);
+    EXPECT_EQ(flat.machine(3), 1);
+    EXPECT_EQ(flat.duration(5), 3);
+    EXPECT_EQ(flat.indexOf(2, 7), 7);
+    EXPECT_EQ(flat.indexOf(2, 3), -1);
+}
+
+TEST_F(BatchEvaluatorTest, DecodingSolverOrderDoesNotWorsenMakespan) {
+    auto solver = std::make_shared<Solver>(SchedulingAlgorithm::SPT);
+    auto result = solver->solve(problem);
+
+    BatchEvaluator evaluator(flat, EvaluatorBackend::Scalar);
+    std::vector<int> sequence = flat.sequenceFromSchedule(result->problem);
+    EXPECT_LE(evaluator.evaluate(sequence), result->makespan);
+}
+
+TEST_F(BatchEvaluatorTest, AllBackendsAgreeWithScalar) {
+    auto sequences = randomSequences(37, 7); // not a multiple of any lane count
+    BatchEvaluator scalar(flat, EvaluatorBackend::Scalar);
+
+    std::vector<int> expected;
+    for (const auto& sequence : sequences) {
+        expected.push_back(scalar.evaluate(sequence));
+    }
+
+    for (auto backend : {EvaluatorBackend::Scalar, EvaluatorBackend::AVX2, EvaluatorBackend::AVX512}) {
+        if (!BatchEvaluator::isSupported(backend)) continue;
+        BatchEvaluator evaluator(flat, backend);
+        EXPECT_EQ(evaluator.getBackend(), backend);
+        EXPECT_EQ(evaluator.evaluateBatch(sequences), expected) << BatchEvaluator::getBackendName(backend);
+    }
+}
+
+TEST_F(BatchEvaluatorTest, RejectsInvalidSequences) {
+    BatchEvaluator evaluator(flat);
+    std::vector<std::vector<int>> tooShort = {{0, 1, 2}};
+    std::vector<std::vector<int>> wrongCounts = {{0, 0, 0, 0, 1, 1, 2, 2, 2}};
+    std::vector<std::vector<int>> badJob = {{0, 0, 0, 1, 1, 1, 2, 2, 9}};
+
+    EXPECT_THROW(evaluator.evaluateBatch(tooShort), std::invalid_argument);
+    EXPECT_THROW(evaluator.evaluateBatch(wrongCounts), std::invalid_argument);
+    EXPECT_THROW(evaluator.evaluateBatch(badJob), std::invalid_argument);
+}
+
+TEST_F(BatchEvaluatorTest, EmptyBatch) {
+    BatchEvaluator evaluator(flat);
+    EXPECT_TRUE(evaluator.evaluateBatch(std::vector<std::vector<int>>()).empty());
+    EXPECT_GE(evaluator.getLaneCount(), 1);
+}
+
+TEST_F(BatchEvaluatorTest, DefaultsToCalibratedBackendAndAllThreads) {
+    EvaluatorBackend selected = BatchEvaluator::selectBackend();
+    EXPECT_TRUE(BatchEvaluator::isSupported(selected));
+    EXPECT_EQ(BatchEvaluator::selectBackend(), selected);
+
+    BatchEvaluator evaluator(flat);
+    EXPECT_EQ(evaluator.getBackend(), selected);
+    EXPECT_EQ(evaluator.getThreadCount(), std::max(1, static_cast<int>(std::thread::hardware_concurrency())));
+
+    // Threaded and single-threaded runs agree
+    auto sequences = randomSequences(2000, 11);
+    std::vector<int> threaded = evaluator.evaluateBatch(sequences);
+    evaluator.setThreadCount(1);
+    EXPECT_EQ(evaluator.evaluateBatch(sequences), threaded);
+}
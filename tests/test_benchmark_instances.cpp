@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "benchmark_instances.hpp"
+
+class BenchmarkInstancesTest : public ::testing::Test {
+protected:
+    /**
+     * SetUp method for test fixture.
+     */
+    void SetUp() override {
+        // Fisher and Thompson 6x6 as published in OR-Library
+        ft06 =
+            " instance ft06\n"
+            " +++++++++++++++++++++++++++++\n"
+            " Fisher and Thompson 6x6 instance, alternate name (mt06)\n"
+            " 6 6\n"
+            " 2  1  0  3  1  6  3  7  5  3  4  6\n"
+            " 1  8  2  5  4 10  5 10  0 10  3  4\n"
+            " 2  5  3  4  5  8  0  9  1  1  4  7\n"
+            " 1  5  0  5  2  5  3  3  4  8  5  9\n"
+            " 2  9  1  3  4  5  5  4  0  3  3  1\n"
+            " 1  3  3  3  5  9  0 10  4  4  2  1\n"
+            " +++++++++++++++++++++++++++++\n";
+        path = "test_benchmark.txt";
+    }
+
+    void TearDown() override {
+        std::remove(path.c_str());
+    }
+
+    /**
+     * Formats an instance in Taillard layout with labels.
+     */
+    std::string toTaillard(const ProblemInstance& problem, const std::string& header) {
+        std::ostringstream out;
+        out << "Nb of jobs, Nb of Machines, Time seed, Machine seed, Upper bound, Lower bound\n";
+        out << header << "\nTimes\n";
+        for (const auto& job : problem.jobs) {
+            for (const auto& op : job->operations) {
+                out << " " << op->processingTime;
+            }
+            out << "\n";
+        }
+        out << "Machines\n";
+        for (const auto& job : problem.jobs) {
+            for (const auto& op : job->operations) {
+                out << " " << op->machineId + 1;
+            }
+            out << "\n";
+        }
+        return out.str();
+    }
+
+    std::string ft06;
+    std::string path;
+};
+
+TEST_F(BenchmarkInstancesTest, ReadsORLibraryInstance) {
+    auto problem = BenchmarkReader::parseORLibrary(ft06);
+    ASSERT_EQ(problem->numJobs, 6);
+    ASSERT_EQ(problem->numMachines, 6);
+    EXPECT_EQ(problem->getTotalOperations(), 36);
+
+    auto op = problem->getJob(1)->getOperation(4);
+    EXPECT_EQ(op->machineId, 0);
+    EXPECT_EQ(op->processingTime, 10);
+    EXPECT_EQ(op->operationId, 10);
+    EXPECT_EQ(problem->getJob(5)->getOperation(5)->machineId, 2);
+}
+
+TEST_F(BenchmarkInstancesTest, SelectsInstanceFromCollection) {
+    std::string collection =
+        " instance tiny\n 2 1\n 0 4\n 0 5\n"
+        + ft06 +
+        " instance other\n 1 2\n 1 3 0 4\n";
+
+    EXPECT_EQ(BenchmarkReader::parseORLibrary(collection)->numJobs, 2);
+    EXPECT_EQ(BenchmarkReader::parseORLibrary(collection, "ft06")->numMachines, 6);
+    auto other = BenchmarkReader::parseORLibrary(collection, "other");
+    EXPECT_EQ(other->getJob(0)->getOperation(0)->machineId, 1);
+    EXPECT_THROW(BenchmarkReader::parseORLibrary(collection, "ft10"), std::invalid_argument);
+}
+
+TEST_F(BenchmarkInstancesTest, GeneratesPublishedTaillardInstance) {
+    auto problem = TaillardGenerator::generate("ta01");
+    ASSERT_EQ(problem->numJobs, 15);
+    ASSERT_EQ(problem->numMachines, 15);
+
+    // First job of ta01 as published
+    std::vector<int> machines = {7, 13, 5, 8, 4, 3, 11, 12, 9, 15, 10, 14, 6, 1, 2};
+    std::vector<int> times = {94, 66, 10, 53, 26, 15, 65, 82, 10, 27, 93, 92, 96, 70, 83};
+    for (int k = 0; k < 15; ++k) {
+        EXPECT_EQ(problem->getJob(0)->getOperation(k)->machineId, machines[k] - 1);
+        EXPECT_EQ(problem->getJob(0)->getOperation(k)->processingTime, times[k]);
+    }
+
+    // Every job visits every machine once
+    for (const auto& job : problem->jobs) {
+        std::vector<bool> seen(15, false);
+        for (const auto& op : job->operations) {
+            EXPECT_FALSE(seen[op->machineId]);
+            seen[op->machineId] = true;
+        }
+    }
+
+    EXPECT_THROW(TaillardGenerator::generate("ta99"), std::invalid_argument);
+    EXPECT_THROW(TaillardGenerator::generate(TaillardSeeds{15, 15, 0, 1}), std::invalid_argument);
+}
+
+TEST_F(BenchmarkInstancesTest, BuiltInTaillardTableCoversSizeClasses) {
+    std::vector<std::string> names = TaillardGenerator::getInstanceNames();
+    ASSERT_EQ(names.size(), 30u);
+    std::vector<int32_t> timeSeeds;
+    for (size_t i = 0; i < names.size(); ++i) {
+        std::string name = (i < 9 ? "ta0" : "ta") + std::to_string(i + 1);
+        ASSERT_EQ(names[i], name);
+        TaillardSeeds seeds;
+        ASSERT_TRUE(TaillardGenerator::findSeeds(name, seeds));
+        EXPECT_EQ(seeds.jobs, i < 10 ? 15 : 20) << name;
+        EXPECT_EQ(seeds.machines, i < 20 ? 15 : 20) << name;
+        timeSeeds.push_back(seeds.timeSeed);
+    }
+    std::sort(timeSeeds.begin(), timeSeeds.end());
+    EXPECT_EQ(std::adjacent_find(timeSeeds.begin(), timeSeeds.end()), timeSeeds.end());
+
+    // Larger classes are generated from seeds supplied by the caller
+    TaillardSeeds seeds;
+    EXPECT_FALSE(TaillardGenerator::findSeeds("ta31", seeds));
+    EXPECT_THROW(TaillardGenerator::generate("ta31"), std::invalid_argument);
+}
+
+TEST_F(BenchmarkInstancesTest, ReadsTaillardLayout) {
+    auto generated = TaillardGenerator::generate("ta01");
+    std::string text = toTaillard(*generated, "15 15 840612802 398197754 1231 1005");
+    EXPECT_EQ(BenchmarkReader::detectFormat(text), BenchmarkFormat::TAILLARD);
+    EXPECT_EQ(BenchmarkReader::detectFormat(ft06), BenchmarkFormat::OR_LIBRARY);
+
+    TaillardSeeds seeds;
+    ASSERT_TRUE(BenchmarkReader::readTaillardSeeds(text, seeds));
+    EXPECT_EQ(seeds.timeSeed, 840612802);
+    EXPECT_EQ(seeds.machineSeed, 398197754);
+    EXPECT_FALSE(BenchmarkReader::readTaillardSeeds(ft06, seeds));
+
+    std::ofstream(path) << text;
+    auto loaded = BenchmarkReader::loadFile(path);
+    auto regenerated = TaillardGenerator::generate(seeds);
+    for (int j = 0; j < 15; ++j) {
+        for (int k = 0; k < 15; ++k) {
+            EXPECT_EQ(loaded->getJob(j)->getOperation(k)->machineId, regenerated->getJob(j)->getOperation(k)->machineId);
+            EXPECT_EQ(loaded->getJob(j)->getOperation(k)->processingTime, regenerated->getJob(j)->getOperation(k)->processingTime);
+        }
+    }
+}
+
+TEST_F(BenchmarkInstancesTest, RejectsMalformedFiles) {
+    EXPECT_THROW(BenchmarkReader::parseORLibrary("instance empty\n"), std::invalid_argument);
+    EXPECT_THROW(BenchmarkReader::parseORLibrary("0 3\n"), std::invalid_argument);
+    EXPECT_THROW(BenchmarkReader::parseORLibrary("2 2\n0 1 1 1\n"), std::invalid_argument);
+    EXPECT_THROW(BenchmarkReader::parseORLibrary("1 2\n0 1 2 1\n"), std::invalid_argument);
+    EXPECT_THROW(BenchmarkReader::parseORLibrary("1 2\n0 1 1 0\n"), std::invalid_argument);
+    EXPECT_THROW(BenchmarkReader::parseORLibrary("1 2\n0 1 1 x\n"), std::invalid_argument);
+    EXPECT_THROW(BenchmarkReader::parseTaillard("1 2\nTimes\n3 4\nMachines\n0 1\n"), std::invalid_argument);
+    EXPECT_THROW(BenchmarkReader::loadFile("missing.txt"), std::runtime_error);
+}
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+#include "binary_instance.hpp"
+#include "instance_generator.hpp"
+#include "parser.hpp"
+#include "sequence_schedule.hpp"
+#include "solver.hpp"
+
+class BinaryInstanceTest : public ::testing::Test {
+protected:
+    /**
+     * SetUp method for test fixture.
+     */
+    void SetUp() override {
+        GeneratorConfig config;
+        config.jobs = 12;
+        config.machines = 5;
+        config.operationsPerJob = 7;
+        config.seed = 3;
+        problem = InstanceGenerator(config).generate();
+        path = "test_instance.jsspb";
+        std::remove(path.c_str());
+    }
+
+    void TearDown() override {
+        std::remove(path.c_str());
+    }
+
+    std::shared_ptr<ProblemInstance> problem;
+    std::string path;
+};
+
+TEST_F(BinaryInstanceTest, LoadsInPlace) {
+    FlatInstance expected = FlatInstance::fromProblem(*problem);
+    BinaryInstance::write(*problem, path);
+    ASSERT_TRUE(BinaryInstance::isBinary(path));
+
+    FlatInstance loaded = BinaryInstance::load(path, true);
+    ASSERT_EQ(loaded.getNumJobs(), expected.getNumJobs());
+    ASSERT_EQ(loaded.getNumMachines(), expected.getNumMachines());
+    ASSERT_EQ(loaded.getNumOperations(), expected.getNumOperations());
+    for (int j = 0; j <= expected.getNumJobs(); ++j) {
+        EXPECT_EQ(loaded.jobStarts()[j], expected.jobStarts()[j]);
+    }
+    for (int op = 0; op < expected.getNumOperations(); ++op) {
+        EXPECT_EQ(loaded.job(op), expected.job(op));
+        EXPECT_EQ(loaded.machine(op), expected.machine(op));
+        EXPECT_EQ(loaded.duration(op), expected.duration(op));
+        EXPECT_EQ(loaded.operationId(op), expected.operationId(op));
+    }
+    EXPECT_EQ(loaded.indexOf(3, expected.operationId(expected.jobStart(3) + 2)), expected.jobStart(3) + 2);
+
+    // Schedules decode the same on the mapped arrays
+    auto result = Solver(SchedulingAlgorithm::SPT).solve(problem);
+    MachineSequences sequences = expected.machineSequences(result->problem);
+    SequenceSchedule fromMemory(expected);
+    SequenceSchedule fromFile(loaded);
+    ASSERT_TRUE(fromMemory.load(sequences));
+    ASSERT_TRUE(fromFile.load(sequences));
+    EXPECT_EQ(fromFile.getMakespan(), fromMemory.getMakespan());
+}
+
+TEST_F(BinaryInstanceTest, CopiesKeepTheMappingAlive) {
+    BinaryInstance::write(*problem, path);
+    FlatInstance copy;
+    {
+        FlatInstance loaded = BinaryInstance::load(path);
+        copy = loaded;
+    }
+    std::remove(path.c_str());
+    EXPECT_EQ(copy.duration(copy.getNumOperations() - 1),
+              problem->jobs.back()->operations.back()->processingTime);
+
+    auto rebuilt = copy.toProblem();
+    ASSERT_EQ(rebuilt->getTotalOperations(), problem->getTotalOperations());
+    EXPECT_EQ(rebuilt->getJob(5)->getOperation(3)->machineId, problem->getJob(5)->getOperation(3)->machineId);
+}
+
+TEST_F(BinaryInstanceTest, ParserRecognizesBinaryFiles) {
+    BinaryInstance::write(*problem, path);
+    auto parsed = Parser::parseFile(path);
+    ASSERT_EQ(parsed->numJobs, 12);
+    ASSERT_EQ(parsed->getTotalOperations(), 84);
+    for (int j = 0; j < 12; ++j) {
+        for (int k = 0; k < 7; ++k) {
+            EXPECT_EQ(parsed->getJob(j)->getOperation(k)->processingTime,
+                      problem->getJob(j)->getOperation(k)->processingTime);
+        }
+    }
+}
+
+TEST_F(BinaryInstanceTest, RejectsDamagedFiles) {
+    BinaryInstance::write(*problem, path);
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    long size = static_cast<long>(in.tellg());
+    in.close();
+
+    // A damaged operation passes the header check but not verification, the default
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(size - 64 * 3);
+        file.put(static_cast<char>(0x7f));
+    }
+    EXPECT_NO_THROW(BinaryInstance::load(path, false));
+    EXPECT_THROW(BinaryInstance::load(path, true), std::runtime_error);
+    EXPECT_THROW(BinaryInstance::load(path), std::runtime_error);
+
+    ASSERT_EQ(truncate(path.c_str(), size - 64), 0);
+    EXPECT_THROW(BinaryInstance::load(path), std::runtime_error);
+
+    std::ofstream(path) << "3 3\n0 0 1\n";
+    EXPECT_FALSE(BinaryInstance::isBinary(path));
+    EXPECT_THROW(BinaryInstance::load(path), std::runtime_error);
+    EXPECT_THROW(BinaryInstance::load("missing.jsspb"), std::runtime_error);
+}
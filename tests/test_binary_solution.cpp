@@ -0,0 +1,250 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include "binary_solution.hpp"
+#include "instance_generator.hpp"
+#include "parser.hpp"
+#include "solution_serializer.hpp"
+#include "solver.hpp"
+
+class BinarySolutionTest : public ::testing::Test {
+protected:
+    /**
+     * SetUp method for test fixture.
+     */
+    void SetUp() override {
+        GeneratorConfig config;
+        config.jobs = 15;
+        config.machines = 6;
+        config.operationsPerJob = 6;
+        config.seed = 11;
+        result = Solver(SchedulingAlgorithm::SPT).solve(InstanceGenerator(config).generate());
+        path = "test_solution.jsol";
+        jsonPath = "test_solution.json";
+    }
+
+    void TearDown() override {
+        std::remove(path.c_str());
+        std::remove(jsonPath.c_str());
+    }
+
+    /**
+     * Writes a result as a binary solution file.
+     */
+    void writeFile(const ScheduleResult& schedule) const {
+        std::string data = BinarySolution::encode(schedule);
+        std::ofstream(path, std::ios::binary | std::ios::trunc) << data;
+    }
+
+    /**
+     * Checks a view query against the operations of a loaded machine.
+     */
+    static void expectWindow(BinarySolutionView& view, const ScheduleResult& schedule, int machine, int from, int to) {
+        std::vector<const Operation*> expected;
+        for (const auto& operation : schedule.problem.machines[machine]->scheduledOperations) {
+            bool empty = operation->endTime == operation->startTime;
+            if (operation->startTime < to && (operation->endTime > from || (empty && operation->startTime >= from))) {
+                expected.push_back(operation.get());
+            }
+        }
+        std::vector<Operation> actual = view.query(machine, from, to);
+        ASSERT_EQ(actual.size(), expected.size()) << "machine " << machine << " [" << from << ", " << to << ")";
+        for (size_t i = 0; i < expected.size(); ++i) {
+            EXPECT_EQ(actual[i].jobId, expected[i]->jobId);
+            EXPECT_EQ(actual[i].machineId, machine);
+            EXPECT_EQ(actual[i].operationId, expected[i]->operationId);
+            EXPECT_EQ(actual[i].processingTime, expected[i]->processingTime);
+            EXPECT_EQ(actual[i].startTime, expected[i]->startTime);
+            EXPECT_EQ(actual[i].endTime, expected[i]->endTime);
+        }
+    }
+
+    /**
+     * Claims the largest machine count and a directory offset that wraps
+     * around to the file size when the directory size is added.
+     */
+    static std::string wrappedDirectory(std::string data) {
+        const int32_t machines = 0x7fffffff;
+        uint64_t offset = static_cast<uint64_t>(data.size()) - static_cast<uint64_t>(machines) * 16;
+        std::memcpy(&data[12], &machines, sizeof(machines));
+        std::memcpy(&data[40], &offset, sizeof(offset));
+        return data;
+    }
+
+    /**
+     * Returns the size of a file in bytes.
+     */
+    static long fileSize(const std::string& filename) {
+        std::ifstream in(filename, std::ios::binary | std::ios::ate);
+        return static_cast<long>(in.tellg());
+    }
+
+    std::shared_ptr<ScheduleResult> result;
+    std::string path;
+    std::string jsonPath;
+};
+
+TEST_F(BinarySolutionTest, RoundTrip) {
+    std::string data = BinarySolution::encode(*result);
+    auto decoded = BinarySolution::decode(data.data(), data.size());
+
+    EXPECT_EQ(decoded->makespan, result->makespan);
+    EXPECT_EQ(decoded->totalCompletionTime, result->totalCompletionTime);
+    EXPECT_DOUBLE_EQ(decoded->avgFlowTime, result->avgFlowTime);
+    ASSERT_EQ(decoded->problem.numJobs, result->problem.numJobs);
+    ASSERT_EQ(decoded->problem.numMachines, result->problem.numMachines);
+
+    for (int j = 0; j < result->problem.numJobs; ++j) {
+        const auto& expected = result->problem.jobs[j]->operations;
+        const auto& actual = decoded->problem.jobs[j]->operations;
+        ASSERT_EQ(actual.size(), expected.size());
+        for (size_t k = 0; k < expected.size(); ++k) {
+            EXPECT_EQ(actual[k]->jobId, expected[k]->jobId);
+            EXPECT_EQ(actual[k]->machineId, expected[k]->machineId);
+            EXPECT_EQ(actual[k]->processingTime, expected[k]->processingTime);
+            EXPECT_EQ(actual[k]->operationId, expected[k]->operationId);
+            EXPECT_EQ(actual[k]->startTime, expected[k]->startTime);
+            EXPECT_EQ(actual[k]->endTime, expected[k]->endTime);
+        }
+    }
+
+    for (int m = 0; m < result->problem.numMachines; ++m) {
+        const auto& expected = *result->problem.machines[m];
+        const auto& actual = *decoded->problem.machines[m];
+        EXPECT_EQ(actual.availableTime, expected.availableTime);
+        ASSERT_EQ(actual.scheduledOperations.size(), expected.scheduledOperations.size());
+        for (size_t i = 0; i < expected.scheduledOperations.size(); ++i) {
+            const auto& operation = actual.scheduledOperations[i];
+            EXPECT_EQ(operation->operationId, expected.scheduledOperations[i]->operationId);
+            EXPECT_EQ(operation->startTime, expected.scheduledOperations[i]->startTime);
+            // Machines share the operations of the jobs
+            int k = 0;
+            while (decoded->problem.jobs[operation->jobId]->operations[k]->operationId != operation->operationId) {
+                ++k;
+            }
+            EXPECT_EQ(decoded->problem.jobs[operation->jobId]->operations[k], operation);
+        }
+    }
+}
+
+TEST_F(BinarySolutionTest, RecognizedByMagic) {
+    SolutionSerializer::exportSolution(result, path, ExportFormat::BINARY);
+    EXPECT_EQ(SolutionSerializer::detectFormat(path), ExportFormat::BINARY);
+    EXPECT_EQ(SolutionSerializer::detectFormat("missing.jsol"), ExportFormat::BINARY);
+    EXPECT_EQ(SolutionSerializer::getFormatName(ExportFormat::BINARY), "Binary (.jsol)");
+
+    // Exports go by the extension; loading goes by the magic
+    std::rename(path.c_str(), jsonPath.c_str());
+    EXPECT_EQ(SolutionSerializer::detectFormat(jsonPath), ExportFormat::JSON);
+    EXPECT_TRUE(BinarySolution::isBinary(jsonPath));
+    EXPECT_FALSE(BinarySolution::isBinary("missing.jsol"));
+    auto loaded = Parser::loadSolution(jsonPath);
+    EXPECT_EQ(loaded->makespan, result->makespan);
+    EXPECT_EQ(loaded->problem.getTotalOperations(), result->problem.getTotalOperations());
+}
+
+TEST_F(BinarySolutionTest, SmallerThanJSON) {
+    SolutionSerializer::exportSolution(result, path, ExportFormat::BINARY);
+    SolutionSerializer::exportSolution(result, jsonPath, ExportFormat::JSON);
+    EXPECT_LT(fileSize(path) * 10, fileSize(jsonPath));
+}
+
+TEST_F(BinarySolutionTest, RejectsCorruptData) {
+    std::string data = BinarySolution::encode(*result);
+
+    std::string damaged = data;
+    damaged[BinarySolution::HEADER_SIZE + 5] ^= 0x01;
+    EXPECT_THROW(BinarySolution::decode(damaged.data(), damaged.size()), std::runtime_error);
+
+    EXPECT_THROW(BinarySolution::decode(data.data(), data.size() - 1), std::runtime_error);
+    EXPECT_THROW(BinarySolution::decode(data.data(), 10), std::runtime_error);
+
+    std::string otherVersion = data;
+    otherVersion[4] = 2;
+    EXPECT_THROW(BinarySolution::decode(otherVersion.data(), otherVersion.size()), std::runtime_error);
+
+    // A directory offset past the end must not wrap around to the file size
+    std::string crafted = wrappedDirectory(data);
+    EXPECT_THROW(BinarySolution::decode(crafted.data(), crafted.size()), std::runtime_error);
+
+    // Unscheduled results encode too
+    ScheduleResult empty;
+    empty.problem.createJobs(2);
+    empty.problem.createMachines(2);
+    empty.problem.getJob(1)->addOperation(std::make_shared<Operation>(1, 0, 4, 0));
+    std::string encoded = BinarySolution::encode(empty);
+    auto decoded = BinarySolution::decode(encoded.data(), encoded.size());
+    EXPECT_EQ(decoded->problem.getJob(1)->getOperation(0)->processingTime, 4);
+    EXPECT_FALSE(decoded->problem.getJob(1)->getOperation(0)->isScheduled());
+}
+
+TEST_F(BinarySolutionTest, ViewQueriesTimeWindows) {
+    GeneratorConfig config;
+    config.jobs = 300;
+    config.machines = 4;
+    config.seed = 12;
+    auto large = Solver(SchedulingAlgorithm::SPT).solve(InstanceGenerator(config).generate());
+    writeFile(*large);
+
+    BinarySolutionView view(path, true);
+    EXPECT_EQ(view.getNumJobs(), 300);
+    EXPECT_EQ(view.getNumMachines(), 4);
+    EXPECT_EQ(view.getMakespan(), large->makespan);
+    EXPECT_EQ(view.getNumEntries(), static_cast<size_t>(large->problem.getTotalOperations()));
+    EXPECT_LT(view.getIndexBytes(), 100u); // only the directory so far
+
+    int makespan = large->makespan;
+    int windows[][2] = {{0, makespan}, {0, 1}, {makespan / 3, makespan / 3 + 40}, {makespan / 2, makespan},
+                        {makespan - 1, makespan + 100}, {makespan, makespan + 10}, {-50, 3}};
+    for (int m = 0; m < 4; ++m) {
+        EXPECT_EQ(view.getMachineSize(m), large->problem.machines[m]->scheduledOperations.size());
+        for (const auto& window : windows) {
+            expectWindow(view, *large, m, window[0], window[1]);
+        }
+    }
+    EXPECT_TRUE(view.query(0, 10, 10).empty());
+    EXPECT_TRUE(view.query(7, 0, makespan).empty());
+}
+
+TEST_F(BinarySolutionTest, ViewHandlesUnorderedMachinesAndSparseIds) {
+    for (const auto& job : result->problem.jobs) {
+        for (const auto& operation : job->operations) {
+            operation->operationId = operation->operationId * 3 + 7;
+        }
+    }
+    auto& sequence = result->problem.machines[2]->scheduledOperations;
+    std::reverse(sequence.begin(), sequence.end());
+    writeFile(*result);
+
+    BinarySolutionView view(path);
+    int makespan = result->makespan;
+    for (int m = 0; m < result->problem.numMachines; ++m) {
+        expectWindow(view, *result, m, 0, makespan);
+        expectWindow(view, *result, m, makespan / 4, makespan / 2);
+    }
+}
+
+TEST_F(BinarySolutionTest, ViewRejectsCorruptFiles) {
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << "Job 0: not binary";
+    EXPECT_THROW(BinarySolutionView view(path), std::runtime_error);
+
+    std::string data = BinarySolution::encode(*result);
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << data.substr(0, data.size() - 4);
+    EXPECT_THROW(BinarySolutionView view(path), std::runtime_error);
+
+    // A damaged chunk is found by the checksum; unverified, other machines still read
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << wrappedDirectory(data);
+    EXPECT_THROW(BinarySolutionView view(path), std::runtime_error);
+
+    std::string damaged = data;
+    damaged[data.size() - 16 * result->problem.numMachines - 3] = '\x7f';
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << damaged;
+    EXPECT_THROW(BinarySolutionView view(path, true), std::runtime_error);
+    BinarySolutionView view(path);
+    EXPECT_NO_THROW(view.query(0, 0, result->makespan));
+}
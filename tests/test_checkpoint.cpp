@@ -0,0 +1,289 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <unistd.h>
+#include "checkpoint.hpp"
+#include "elite_pool.hpp"
+#include "solver.hpp"
+
+class CheckpointTest : public ::testing::Test {
+protected:
+    /**
+     * SetUp method for test fixture.
+     */
+    void SetUp() override {
+        auto result = Solver(SchedulingAlgorithm::SPT).solve(makeProblem());
+        flat = FlatInstance::fromProblem(result->problem);
+        initial = flat.machineSequences(result->problem);
+        path = "test_checkpoint.ckpt";
+        std::remove(path.c_str());
+        config.threads = 2;
+        config.seed = 7;
+    }
+
+    void TearDown() override {
+        std::remove(path.c_str());
+    }
+
+    /**
+     * Builds the same random 10x6 instance on every call.
+     */
+    std::shared_ptr<ProblemInstance> makeProblem() {
+        auto instance = std::make_shared<ProblemInstance>();
+        instance->createJobs(10);
+        instance->createMachines(6);
+        std::mt19937 rng(12);
+        int id = 0;
+        for (int j = 0; j < 10; ++j) {
+            std::vector<int> machines = {0, 1, 2, 3, 4, 5};
+            std::shuffle(machines.begin(), machines.end(), rng);
+            for (int m : machines) {
+                instance->getJob(j)->addOperation(std::make_shared<Operation>(j, m, 1 + static_cast<int>(rng() % 30), id++));
+            }
+        }
+        return instance;
+    }
+
+    FlatInstance flat;
+    MachineSequences initial;
+    std::string path;
+    LNSConfig config;
+};
+
+TEST_F(CheckpointTest, RoundTripsSearchState) {
+    LNSEngine engine(flat, config);
+    engine.reset(initial);
+    engine.runIterations(15);
+
+    SearchCheckpoint saved;
+    engine.saveState(saved);
+    saved.instanceFingerprint = CheckpointFile::fingerprint(flat);
+    saved.configFingerprint = CheckpointFile::fingerprint(SolverConfig().toString());
+    saved.elites.push_back({engine.getBestSequences(), engine.getBestMakespan(), 42});
+
+    CheckpointFile file(path);
+    file.write(saved);
+
+    SearchCheckpoint loaded;
+    ASSERT_TRUE(CheckpointFile(path).read(loaded));
+    EXPECT_EQ(loaded.instanceFingerprint, saved.instanceFingerprint);
+    EXPECT_EQ(loaded.configFingerprint, saved.configFingerprint);
+    EXPECT_EQ(loaded.current, saved.current);
+    EXPECT_EQ(loaded.best, saved.best);
+    EXPECT_EQ(loaded.bestMakespan, saved.bestMakespan);
+    EXPECT_EQ(loaded.tabu, saved.tabu);
+    EXPECT_EQ(loaded.rngState, saved.rngState);
+    EXPECT_EQ(loaded.statistics.iterations, 15);
+    ASSERT_EQ(loaded.elites.size(), 1u);
+    EXPECT_EQ(loaded.elites[0].hash, 42u);
+    EXPECT_EQ(loaded.elites[0].sequences, saved.best);
+}
+
+TEST_F(CheckpointTest, ResumeContinuesExactly) {
+    LNSEngine uninterrupted(flat, config);
+    uninterrupted.reset(initial);
+    uninterrupted.runIterations(40);
+
+    LNSEngine first(flat, config);
+    first.reset(initial);
+    first.runIterations(20);
+    SearchCheckpoint state;
+    first.saveState(state);
+    CheckpointFile(path).write(state);
+
+    SearchCheckpoint loaded;
+    ASSERT_TRUE(CheckpointFile(path).read(loaded));
+    LNSEngine resumed(flat, config);
+    resumed.restoreState(loaded);
+    resumed.runIterations(20);
+
+    EXPECT_EQ(resumed.getBestMakespan(), uninterrupted.getBestMakespan());
+    EXPECT_EQ(resumed.getBestSequences(), uninterrupted.getBestSequences());
+    EXPECT_EQ(resumed.getStatistics().iterations, 40);
+    EXPECT_EQ(resumed.getStatistics().nodes, uninterrupted.getStatistics().nodes);
+}
+
+TEST_F(CheckpointTest, SavesAndRestoresElitePool) {
+    ElitePool elites(4);
+    LNSEngine engine(flat, config);
+    engine.setElitePool(&elites);
+    engine.reset(initial);
+    engine.runIterations(20);
+    SearchCheckpoint state;
+    engine.saveState(state);
+    ASSERT_GT(state.elites.size(), 0u);
+    CheckpointFile(path).write(state);
+
+    SearchCheckpoint loaded;
+    ASSERT_TRUE(CheckpointFile(path).read(loaded));
+    ElitePool restoredElites(4);
+    LNSEngine resumed(flat, config);
+    resumed.setElitePool(&restoredElites);
+    resumed.restoreState(loaded);
+    std::vector<EliteSolution> expected = elites.snapshot();
+    std::vector<EliteSolution> actual = restoredElites.snapshot();
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(actual[i].sequences, expected[i].sequences);
+        EXPECT_EQ(actual[i].makespan, expected[i].makespan);
+        EXPECT_EQ(actual[i].hash, expected[i].hash);
+    }
+
+    // An elite whose makespan does not match its schedule is rejected
+    loaded.elites[0].makespan += 1;
+    EXPECT_THROW(resumed.restoreState(loaded), std::invalid_argument);
+}
+
+TEST_F(CheckpointTest, WritesOnlyChangedSections) {
+    LNSEngine engine(flat, config);
+    engine.reset(initial);
+    SearchCheckpoint state;
+    engine.saveState(state);
+
+    CheckpointFile file(path);
+    size_t snapshot = file.write(state);
+    size_t unchanged = file.write(state);
+    EXPECT_LT(unchanged, snapshot);
+
+    std::swap(state.current[1][0], state.current[1][1]);
+    size_t changed = file.write(state);
+    EXPECT_GT(changed, unchanged);
+    EXPECT_LT(changed, snapshot);
+
+    SearchCheckpoint loaded;
+    ASSERT_TRUE(CheckpointFile(path).read(loaded));
+    EXPECT_EQ(loaded.current, state.current);
+
+    // Many small writes are compacted back into one snapshot
+    for (int i = 0; i < 100; ++i) {
+        state.statistics.iterations = i;
+        file.write(state);
+    }
+    std::ifstream sizeCheck(path, std::ios::binary | std::ios::ate);
+    EXPECT_LE(static_cast<size_t>(sizeCheck.tellg()), 5 * snapshot + 1);
+    ASSERT_TRUE(CheckpointFile(path).read(loaded));
+    EXPECT_EQ(loaded.statistics.iterations, 99);
+}
+
+TEST_F(CheckpointTest, TornWriteFallsBackToLastCommit) {
+    LNSEngine engine(flat, config);
+    engine.reset(initial);
+    SearchCheckpoint state;
+    engine.saveState(state);
+
+    CheckpointFile file(path);
+    file.write(state);
+    state.statistics.iterations = 5;
+    size_t last = file.write(state);
+
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    long size = static_cast<long>(in.tellg());
+    in.close();
+    ASSERT_EQ(truncate(path.c_str(), size - static_cast<long>(last) / 2), 0);
+
+    SearchCheckpoint loaded;
+    ASSERT_TRUE(CheckpointFile(path).read(loaded));
+    EXPECT_EQ(loaded.statistics.iterations, 0);
+
+    std::ofstream garbage(path, std::ios::binary | std::ios::trunc);
+    garbage << "not a checkpoint";
+    garbage.close();
+    EXPECT_FALSE(CheckpointFile(path).read(loaded));
+    EXPECT_FALSE(CheckpointFile("missing.ckpt").read(loaded));
+}
+
+TEST_F(CheckpointTest, SolverResumesWhereItStopped) {
+    SolverConfig solverConfig;
+    solverConfig.lns = config;
+
+    Solver uninterrupted(SchedulingAlgorithm::LNS);
+    solverConfig.lnsIterations = 40;
+    uninterrupted.setConfig(solverConfig);
+    auto expected = uninterrupted.solve(makeProblem());
+
+    Solver preempted(SchedulingAlgorithm::LNS);
+    solverConfig.lnsIterations = 20;
+    preempted.setConfig(solverConfig);
+    preempted.setCheckpoint(path, 0.0);
+    preempted.solve(makeProblem());
+
+    Solver resumed(SchedulingAlgorithm::LNS);
+    solverConfig.lnsIterations = 40;
+    resumed.setConfig(solverConfig);
+    resumed.setCheckpoint(path);
+    auto result = resumed.solve(makeProblem());
+    EXPECT_EQ(result->makespan, expected->makespan);
+    for (size_t j = 0; j < result->problem.jobs.size(); ++j) {
+        for (size_t o = 0; o < result->problem.jobs[j]->operations.size(); ++o) {
+            EXPECT_EQ(result->problem.jobs[j]->operations[o]->startTime,
+                      expected->problem.jobs[j]->operations[o]->startTime);
+        }
+    }
+
+    SearchCheckpoint loaded;
+    ASSERT_TRUE(CheckpointFile(path).read(loaded));
+    EXPECT_EQ(loaded.statistics.iterations, 40);
+}
+
+TEST_F(CheckpointTest, SolverResumesOnlyWithSameConfig) {
+    SolverConfig solverConfig;
+    solverConfig.lns = config;
+    solverConfig.lnsIterations = 20;
+    Solver preempted(SchedulingAlgorithm::LNS);
+    preempted.setConfig(solverConfig);
+    preempted.setCheckpoint(path, 0.0);
+    preempted.solve(makeProblem());
+
+    // A different seed starts over instead of mixing two searches
+    solverConfig.lnsIterations = 40;
+    solverConfig.lns.seed = 8;
+    Solver reseeded(SchedulingAlgorithm::LNS);
+    reseeded.setConfig(solverConfig);
+    reseeded.setCheckpoint(path);
+    testing::internal::CaptureStdout();
+    reseeded.solve(makeProblem());
+    EXPECT_EQ(testing::internal::GetCapturedStdout().find("Resuming"), std::string::npos);
+
+    // A larger iteration budget alone still resumes
+    solverConfig.lnsIterations = 60;
+    Solver extended(SchedulingAlgorithm::LNS);
+    extended.setConfig(solverConfig);
+    extended.setCheckpoint(path);
+    testing::internal::CaptureStdout();
+    extended.solve(makeProblem());
+    EXPECT_NE(testing::internal::GetCapturedStdout().find("Resuming LNS from " + path + " at iteration 40"),
+              std::string::npos);
+}
+
+TEST_F(CheckpointTest, IslandSolverWarnsAndSkipsCheckpoint) {
+    SolverConfig solverConfig;
+    solverConfig.lnsIterations = 10;
+    solverConfig.islands = 2;
+    solverConfig.migrationInterval = 5;
+    Solver islands(SchedulingAlgorithm::ISLANDS);
+    islands.setConfig(solverConfig);
+    islands.setCheckpoint(path, 0.0);
+    testing::internal::CaptureStderr();
+    islands.solve(makeProblem());
+    EXPECT_NE(testing::internal::GetCapturedStderr().find("checkpointing covers LNS only"), std::string::npos);
+    EXPECT_FALSE(std::ifstream(path).good());
+}
+
+TEST_F(CheckpointTest, RestoreRejectsForeignState) {
+    LNSEngine engine(flat, config);
+    engine.reset(initial);
+    SearchCheckpoint state;
+    engine.saveState(state);
+
+    SearchCheckpoint broken = state;
+    broken.currentMakespan += 1;
+    EXPECT_THROW(engine.restoreState(broken), std::invalid_argument);
+
+    broken = state;
+    broken.rngState.clear();
+    EXPECT_THROW(engine.restoreState(broken), std::invalid_argument);
+}
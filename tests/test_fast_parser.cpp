@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include "fast_parser.hpp"
+#include "mapped_file.hpp"
+#include "parser.hpp"
+
+class FastParserTest : public ::testing::Test {
+protected:
+    /**
+     * SetUp method for test fixture.
+     */
+    void SetUp() override {
+        path = "test_fast_parser.jssp";
+        std::remove(path.c_str());
+    }
+
+    void TearDown() override {
+        std::remove(path.c_str());
+    }
+
+    /**
+     * Writes text to the test file.
+     */
+    void writeFile(const std::string& text) {
+        std::ofstream out(path, std::ios::binary);
+        out << text;
+    }
+
+    /**
+     * Parses in-memory text.
+     */
+    std::shared_ptr<ProblemInstance> parse(const std::string& text, ParseReport& report) {
+        return FastParser::parseBuffer(text.data(), text.size(), report);
+    }
+
+    std::string path;
+};
+
+TEST_F(FastParserTest, MatchesStreamParser) {
+    std::string text = "3 3\n0 0 2\n0 1 3\n0 2 1\n1 1 1\n1 2 2\n1 0 3\n2 2 3\n2 0 1\n2 1 2\n";
+    writeFile(text);
+    ParseReport report;
+    auto fast = FastParser::parseFile(path, report);
+    auto expected = Parser::parseString(text);
+
+    EXPECT_TRUE(report.ok());
+    EXPECT_EQ(report.operations, 9u);
+    EXPECT_EQ(report.lines, 10u);
+    ASSERT_EQ(fast->numJobs, expected->numJobs);
+    ASSERT_EQ(fast->numMachines, expected->numMachines);
+    for (int j = 0; j < expected->numJobs; ++j) {
+        ASSERT_EQ(fast->getJob(j)->getOperationCount(), expected->getJob(j)->getOperationCount());
+        for (int o = 0; o < expected->getJob(j)->getOperationCount(); ++o) {
+            auto a = fast->getJob(j)->getOperation(o);
+            auto b = expected->getJob(j)->getOperation(o);
+            EXPECT_EQ(a->machineId, b->machineId);
+            EXPECT_EQ(a->processingTime, b->processingTime);
+            EXPECT_EQ(a->operationId, b->operationId);
+        }
+    }
+}
+
+TEST_F(FastParserTest, ReportsRejectedLines) {
+    std::string text =
+        "2 2\n"
+        "0 0 5\n"
+        "3 1 2\n"
+        "1 2 3\n"
+        "1 1 -2\n"
+        "1 1\n"
+        "1 x 4\n"
+        "1 1 99999999999\n"
+        "\n"
+        "  1\t0 4  \r\n"
+        "1 1 3";
+    ParseReport report;
+    auto problem = parse(text, report);
+
+    EXPECT_FALSE(report.ok());
+    EXPECT_EQ(report.operations, 3u);
+    EXPECT_EQ(report.skipped, 6u);
+    EXPECT_EQ(report.lines, 11u);
+    ASSERT_EQ(report.errors.size(), 6u);
+    EXPECT_EQ(report.errors[0].line, 3u);
+    EXPECT_EQ(report.errors[0].message, "job 3 out of range");
+    EXPECT_EQ(report.errors[1].line, 4u);
+    EXPECT_EQ(report.errors[1].message, "machine 2 out of range");
+    EXPECT_EQ(report.errors[2].message, "processing time -2 is not positive");
+    EXPECT_EQ(report.errors[3].line, 6u);
+    EXPECT_EQ(report.errors[5].line, 8u);
+
+    // Operation ids count accepted operations only
+    EXPECT_EQ(problem->getJob(1)->getOperation(0)->operationId, 1);
+    EXPECT_EQ(problem->getJob(1)->getOperation(1)->machineId, 1);
+    EXPECT_EQ(problem->getJob(1)->getOperation(1)->operationId, 2);
+}
+
+TEST_F(FastParserTest, CapsReportedErrors) {
+    std::string text = "1 1\n0 0 1\n";
+    for (size_t i = 0; i < FastParser::MAX_REPORTED_ERRORS + 10; ++i) {
+        text += "0 5 1\n";
+    }
+    ParseReport report;
+    parse(text, report);
+    EXPECT_EQ(report.errors.size(), FastParser::MAX_REPORTED_ERRORS);
+    EXPECT_EQ(report.skipped, FastParser::MAX_REPORTED_ERRORS + 10);
+}
+
+TEST_F(FastParserTest, RejectsBadHeadersAndEmptyInput) {
+    ParseReport report;
+    EXPECT_THROW(parse("", report), std::runtime_error);
+    EXPECT_THROW(parse("\n\n", report), std::runtime_error);
+    EXPECT_THROW(parse("0 3\n0 0 1\n", report), std::runtime_error);
+    EXPECT_THROW(parse("2 2 2\n0 0 1\n", report), std::runtime_error);
+    EXPECT_THROW(parse("2 2\n0 0 -1\n", report), std::runtime_error);
+    EXPECT_EQ(report.skipped, 1u);
+
+    writeFile("");
+    EXPECT_THROW(FastParser::parseFile(path, report), std::runtime_error);
+    EXPECT_THROW(FastParser::parseFile("missing.jssp", report), std::runtime_error);
+}
+
+TEST_F(FastParserTest, MappedFileViewsWholeFile) {
+    writeFile("2 1\n0 0 4\n1 0 6\n");
+    MappedFile file(path);
+    EXPECT_EQ(file.view(), "2 1\n0 0 4\n1 0 6\n");
+
+    MappedFile moved(std::move(file));
+    EXPECT_EQ(file.data(), nullptr);
+    EXPECT_EQ(moved.size(), 16u);
+
+    writeFile("");
+    MappedFile empty(path);
+    EXPECT_EQ(empty.size(), 0u);
+    EXPECT_THROW(MappedFile("missing.jssp"), std::runtime_error);
+}
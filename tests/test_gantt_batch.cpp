@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include "gantt_batch.hpp"
+
+class GanttBatchTest : public ::testing::Test {
+protected:
+    /**
+     * SetUp method for test fixture.
+     */
+    void SetUp() override {
+        batch.clear();
+    }
+
+    GanttBatch batch;
+};
+
+TEST_F(GanttBatchTest, CountsBarsAndVertices) {
+    EXPECT_EQ(batch.getBarCount(), 0u);
+    EXPECT_EQ(batch.getVertexCount(), 0u);
+
+    // Two triangles per bar, four lines per outline
+    batch.addBar(sf::FloatRect(0, 0, 10, 5), sf::Color::Red, sf::Color::Black);
+    batch.addBar(sf::FloatRect(10, 0, 10, 5), sf::Color::Green, sf::Color::Black);
+    batch.addBar(sf::FloatRect(20, 0, 0.5f, 5), sf::Color::Blue);
+    EXPECT_EQ(batch.getBarCount(), 3u);
+    EXPECT_EQ(batch.getVertexCount(), 3u * 6 + 2u * 8);
+
+    // A frame is four thin rectangles in the grid batch
+    batch.addBackground(sf::FloatRect(0, 0, 30, 5), sf::Color::White);
+    batch.addFrame(sf::FloatRect(0, 0, 30, 5), sf::Color::Black);
+    EXPECT_EQ(batch.getBarCount(), 3u);
+    EXPECT_EQ(batch.getVertexCount(), 3u * 6 + 2u * 8 + 5u * 6);
+
+    batch.clear();
+    EXPECT_EQ(batch.getBarCount(), 0u);
+    EXPECT_EQ(batch.getVertexCount(), 0u);
+}
+
+TEST_F(GanttBatchTest, DrawsLayersInOrder) {
+    sf::RenderTexture target;
+    ASSERT_TRUE(target.create(40, 20));
+
+    // Bars cover the grid batch; frames are drawn just outside their rectangle
+    batch.addBackground(sf::FloatRect(0, 0, 40, 20), sf::Color::White);
+    batch.addFrame(sf::FloatRect(5, 2, 30, 16), sf::Color::Blue);
+    batch.addBar(sf::FloatRect(10, 5, 20, 10), sf::Color::Red, sf::Color::Black);
+
+    // The second draw reuses the uploaded buffers where they are available
+    for (int frame = 0; frame < 2; ++frame) {
+        target.clear(sf::Color::Black);
+        batch.draw(target);
+        target.display();
+        sf::Image image = target.getTexture().copyToImage();
+        EXPECT_EQ(image.getPixel(20, 10), sf::Color::Red);
+        EXPECT_EQ(image.getPixel(2, 10), sf::Color::White);
+        EXPECT_EQ(image.getPixel(20, 1), sf::Color::Blue);
+    }
+
+    // Rebuilt geometry replaces the old one
+    batch.clear();
+    batch.addBar(sf::FloatRect(0, 0, 40, 20), sf::Color::Green);
+    target.clear(sf::Color::Black);
+    batch.draw(target);
+    target.display();
+    EXPECT_EQ(target.getTexture().copyToImage().getPixel(20, 10), sf::Color::Green);
+}
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "instance_generator.hpp"
+#include "parser.hpp"
+
+class InstanceGeneratorTest : public ::testing::Test {
+protected:
+    /**
+     * SetUp method for test fixture.
+     */
+    void SetUp() override {
+        config.jobs = 30;
+        config.machines = 8;
+        config.seed = 11;
+        path = "test_generated.jssp";
+    }
+
+    void TearDown() override {
+        std::remove(path.c_str());
+    }
+
+    GeneratorConfig config;
+    std::string path;
+};
+
+TEST_F(InstanceGeneratorTest, StreamedFileMatchesInMemoryInstance) {
+    for (RoutingModel routing : {RoutingModel::RANDOM_PERMUTATION, RoutingModel::FLOW, RoutingModel::BOTTLENECK}) {
+        config.routing = routing;
+        config.durations = DurationDistribution::NORMAL;
+        config.operationsPerJob = 13;
+        InstanceGenerator generator(config);
+        auto expected = generator.generate();
+        EXPECT_EQ(generator.writeFile(path), 30u * 13u);
+
+        auto parsed = Parser::parseFile(path);
+        ASSERT_EQ(parsed->numJobs, 30);
+        ASSERT_EQ(parsed->numMachines, 8);
+        for (int j = 0; j < 30; ++j) {
+            ASSERT_EQ(parsed->getJob(j)->getOperationCount(), 13);
+            for (int k = 0; k < 13; ++k) {
+                auto a = parsed->getJob(j)->getOperation(k);
+                auto b = expected->getJob(j)->getOperation(k);
+                EXPECT_EQ(a->machineId, b->machineId);
+                EXPECT_EQ(a->processingTime, b->processingTime);
+                EXPECT_EQ(a->operationId, b->operationId);
+            }
+        }
+    }
+}
+
+TEST_F(InstanceGeneratorTest, SameSeedSameInstance) {
+    std::ostringstream first;
+    std::ostringstream second;
+    InstanceGenerator(config).write(first);
+    InstanceGenerator(config).write(second);
+    EXPECT_EQ(first.str(), second.str());
+
+    config.seed = 12;
+    std::ostringstream third;
+    InstanceGenerator(config).write(third);
+    EXPECT_NE(first.str(), third.str());
+}
+
+TEST_F(InstanceGeneratorTest, RoutingModelsShapeRoutes) {
+    // One operation per machine: every route is a permutation
+    auto permutations = InstanceGenerator(config).generate();
+    for (const auto& job : permutations->jobs) {
+        std::set<int> machines;
+        for (const auto& op : job->operations) {
+            machines.insert(op->machineId);
+        }
+        EXPECT_EQ(machines.size(), 8u);
+    }
+
+    config.routing = RoutingModel::FLOW;
+    config.operationsPerJob = 5;
+    auto flow = InstanceGenerator(config).generate();
+    for (const auto& job : flow->jobs) {
+        ASSERT_EQ(job->getOperationCount(), 5);
+        for (int k = 1; k < 5; ++k) {
+            EXPECT_LT(job->getOperation(k - 1)->machineId, job->getOperation(k)->machineId);
+        }
+    }
+
+    config.routing = RoutingModel::BOTTLENECK;
+    config.operationsPerJob = 40;
+    config.bottlenecks = 2;
+    config.bottleneckShare = 0.7;
+    auto skewed = InstanceGenerator(config).generate();
+    int onBottlenecks = 0;
+    for (const auto& job : skewed->jobs) {
+        for (int k = 0; k < 40; ++k) {
+            int machine = job->getOperation(k)->machineId;
+            onBottlenecks += machine < 2 ? 1 : 0;
+            if (k > 0) {
+                EXPECT_NE(machine, job->getOperation(k - 1)->machineId);
+            }
+        }
+    }
+    EXPECT_NEAR(onBottlenecks / 1200.0, 0.7, 0.05);
+}
+
+TEST_F(InstanceGeneratorTest, DurationsStayInRange) {
+    config.minDuration = 10;
+    config.maxDuration = 20;
+    for (DurationDistribution durations : {DurationDistribution::UNIFORM, DurationDistribution::NORMAL,
+                                           DurationDistribution::EXPONENTIAL}) {
+        config.durations = durations;
+        auto problem = InstanceGenerator(config).generate();
+        for (const auto& job : problem->jobs) {
+            for (const auto& op : job->operations) {
+                EXPECT_GE(op->processingTime, 10);
+                EXPECT_LE(op->processingTime, 20);
+            }
+        }
+    }
+}
+
+TEST_F(InstanceGeneratorTest, RejectsInvalidConfigs) {
+    GeneratorConfig bad = config;
+    bad.jobs = 0;
+    EXPECT_THROW(InstanceGenerator{bad}, std::invalid_argument);
+    bad = config;
+    bad.minDuration = 0;
+    EXPECT_THROW(InstanceGenerator{bad}, std::invalid_argument);
+    bad = config;
+    bad.routing = RoutingModel::BOTTLENECK;
+    bad.bottlenecks = 8;
+    EXPECT_THROW(InstanceGenerator{bad}, std::invalid_argument);
+    bad = config;
+    bad.operationsPerJob = -1;
+    EXPECT_THROW(InstanceGenerator{bad}, std::invalid_argument);
+    EXPECT_THROW(InstanceGenerator(config).writeFile("/nonexistent/dir/x.jssp"), std::runtime_error);
+}
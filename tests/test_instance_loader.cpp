@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include "binary_instance.hpp"
+#include "instance_loader.hpp"
+#include "parser.hpp"
+
+namespace fs = std::filesystem;
+
+class InstanceLoaderTest : public ::testing::Test {
+protected:
+    /**
+     * SetUp method for test fixture.
+     */
+    void SetUp() override {
+        directory = "test_instance_loader";
+        fs::remove_all(directory);
+        fs::create_directories(directory + "/nested/deeper");
+    }
+
+    void TearDown() override {
+        fs::remove_all(directory);
+    }
+
+    /**
+     * Writes text to a file below the test directory.
+     */
+    void writeFile(const std::string& name, const std::string& text) {
+        std::ofstream out(directory + "/" + name, std::ios::binary);
+        out << text;
+    }
+
+    std::string directory;
+};
+
+TEST_F(InstanceLoaderTest, DiscoversInstancesRecursively) {
+    writeFile("b.jssp", "1 1\n0 0 1\n");
+    writeFile("nested/a.jssp", "1 1\n0 0 1\n");
+    writeFile("nested/deeper/c.jsspb", "");
+    writeFile("nested/notes.txt", "1 1\n0 0 1\n");
+
+    auto paths = InstanceLoader::discover(directory);
+    ASSERT_EQ(paths.size(), 3u);
+    EXPECT_EQ(paths[0], directory + "/b.jssp");
+    EXPECT_EQ(paths[1], directory + "/nested/a.jssp");
+    EXPECT_EQ(paths[2], directory + "/nested/deeper/c.jsspb");
+
+    EXPECT_THROW(InstanceLoader::discover(directory + "/b.jssp"), std::runtime_error);
+    EXPECT_THROW(InstanceLoader::discover("missing_directory"), std::runtime_error);
+}
+
+TEST_F(InstanceLoaderTest, LoadsFilesInParallelWithStats) {
+    // Files of different sizes, so the largest-first order differs from the path order
+    for (int i = 0; i < 12; ++i) {
+        std::string text = std::to_string(i + 1) + " 2\n";
+        for (int j = 0; j <= i; ++j) {
+            text += std::to_string(j) + " 0 3\n" + std::to_string(j) + " 1 4\n";
+        }
+        writeFile("nested/instance_" + std::to_string(100 + i) + ".jssp", text);
+    }
+    writeFile("skipped.jssp", "2 2\n0 0 1\n0 9 1\n1 1 2\n");
+    writeFile("broken.jssp", "not an instance\n");
+    BinaryInstance::write(*Parser::generateSimpleProblem(), directory + "/nested/deeper/simple.jsspb");
+
+    auto files = InstanceLoader::loadDirectory(directory, 4);
+    ASSERT_EQ(files.size(), 15u);
+    EXPECT_EQ(files[0].path, directory + "/broken.jssp");
+    EXPECT_FALSE(files[0].ok());
+    EXPECT_FALSE(files[0].error.empty());
+
+    const InstanceFile& binary = files[1];
+    ASSERT_TRUE(binary.ok()) << binary.error;
+    EXPECT_EQ(binary.problem->getTotalOperations(), 9);
+    EXPECT_EQ(binary.report.operations, 9u);
+
+    for (int i = 0; i < 12; ++i) {
+        const InstanceFile& file = files[2 + i];
+        ASSERT_TRUE(file.ok()) << file.path << ": " << file.error;
+        EXPECT_EQ(file.path, directory + "/nested/instance_" + std::to_string(100 + i) + ".jssp");
+        EXPECT_EQ(file.problem->numJobs, i + 1);
+        EXPECT_EQ(file.report.operations, static_cast<size_t>(2 * (i + 1)));
+        EXPECT_EQ(file.bytes, fs::file_size(file.path));
+        EXPECT_GE(file.seconds, 0.0);
+    }
+
+    const InstanceFile& skipped = files[14];
+    ASSERT_TRUE(skipped.ok());
+    EXPECT_EQ(skipped.report.operations, 2u);
+    EXPECT_EQ(skipped.report.skipped, 1u);
+}
+
+TEST_F(InstanceLoaderTest, LoadFilesKeepsTheGivenOrder) {
+    writeFile("a.jssp", "1 1\n0 0 1\n");
+    writeFile("b.jssp", "2 1\n0 0 1\n1 0 1\n");
+    std::vector<std::string> paths = {directory + "/b.jssp", directory + "/missing.jssp", directory + "/a.jssp"};
+
+    auto files = InstanceLoader::loadFiles(paths);
+    ASSERT_EQ(files.size(), 3u);
+    EXPECT_EQ(files[0].problem->numJobs, 2);
+    EXPECT_FALSE(files[1].ok());
+    EXPECT_EQ(files[1].path, paths[1]);
+    EXPECT_EQ(files[2].problem->numJobs, 1);
+    EXPECT_TRUE(InstanceLoader::loadFiles({}).empty());
+}
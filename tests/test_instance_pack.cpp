@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "instance_generator.hpp"
+#include "instance_pack.hpp"
+#include "parser.hpp"
+
+class InstancePackTest : public ::testing::Test {
+protected:
+    /**
+     * SetUp method for test fixture.
+     */
+    void SetUp() override {
+        path = "test_instance_pack.jsspk";
+        for (int i = 0; i < 5; ++i) {
+            GeneratorConfig config;
+            config.jobs = 3 + i;
+            config.machines = 2 + i % 3;
+            config.seed = 40 + i;
+            problems.push_back(InstanceGenerator(config).generate());
+        }
+    }
+
+    void TearDown() override {
+        std::remove(path.c_str());
+    }
+
+    /**
+     * Writes the generated problems to the test pack.
+     */
+    void writePack() {
+        InstancePackWriter writer(path);
+        for (size_t i = 0; i < problems.size(); ++i) {
+            writer.add("set/instance_" + std::to_string(i) + ".jssp", *problems[i]);
+        }
+        EXPECT_EQ(writer.size(), problems.size());
+        writer.finish();
+    }
+
+    /**
+     * Checks that a flat instance holds the same jobs as a problem.
+     */
+    static void expectSame(const FlatInstance& flat, const ProblemInstance& problem) {
+        auto restored = flat.toProblem();
+        ASSERT_EQ(restored->numJobs, problem.numJobs);
+        ASSERT_EQ(restored->numMachines, problem.numMachines);
+        for (int j = 0; j < problem.numJobs; ++j) {
+            const auto& expected = problem.jobs[j]->operations;
+            const auto& actual = restored->jobs[j]->operations;
+            ASSERT_EQ(actual.size(), expected.size());
+            for (size_t k = 0; k < expected.size(); ++k) {
+                EXPECT_EQ(actual[k]->machineId, expected[k]->machineId);
+                EXPECT_EQ(actual[k]->processingTime, expected[k]->processingTime);
+                EXPECT_EQ(actual[k]->operationId, expected[k]->operationId);
+            }
+        }
+    }
+
+    std::string path;
+    std::vector<std::shared_ptr<ProblemInstance>> problems;
+};
+
+TEST_F(InstancePackTest, MappedPackRestoresInstances) {
+    writePack();
+    ASSERT_TRUE(InstancePack::isPack(path));
+
+    FlatInstance kept;
+    {
+        InstancePack pack(path);
+        ASSERT_EQ(pack.size(), problems.size());
+        for (size_t i = 0; i < problems.size(); ++i) {
+            const PackEntry& entry = pack.entry(i);
+            EXPECT_EQ(entry.name, "set/instance_" + std::to_string(i) + ".jssp");
+            EXPECT_EQ(entry.offset % 64, 0u);
+            EXPECT_EQ(entry.numJobs, problems[i]->numJobs);
+            EXPECT_EQ(entry.numOperations, problems[i]->getTotalOperations());
+            expectSame(pack.flat(i, true), *problems[i]);
+        }
+        EXPECT_EQ(pack.find("set/instance_3.jssp"), 3);
+        EXPECT_EQ(pack.find("missing"), -1);
+        EXPECT_EQ(pack.problem(2)->getTotalOperations(), problems[2]->getTotalOperations());
+        kept = pack.flat(4);
+    }
+    expectSame(kept, *problems[4]); // the instance keeps the mapping alive
+}
+
+TEST_F(InstancePackTest, StreamingReaderReadsInOrder) {
+    writePack();
+    InstancePackReader reader(path);
+    ASSERT_EQ(reader.getEntries().size(), problems.size());
+
+    std::vector<FlatInstance> instances;
+    FlatInstance instance;
+    while (reader.next(instance, true)) {
+        instances.push_back(instance);
+        EXPECT_EQ(reader.position(), instances.size());
+    }
+    ASSERT_EQ(instances.size(), problems.size());
+    for (size_t i = 0; i < problems.size(); ++i) {
+        expectSame(instances[i], *problems[i]);
+    }
+    EXPECT_FALSE(reader.next(instance));
+}
+
+TEST_F(InstancePackTest, EmptyAndUnfinishedPacks) {
+    {
+        InstancePackWriter writer(path);
+        writer.finish();
+    }
+    EXPECT_EQ(InstancePack(path).size(), 0u);
+
+    {
+        InstancePackWriter writer(path);
+        writer.add("one", *problems[0]);
+    }
+    EXPECT_FALSE(InstancePack::isPack(path));
+    EXPECT_THROW(InstancePack pack(path), std::runtime_error);
+    EXPECT_THROW(InstancePackReader reader(path), std::runtime_error);
+}
+
+TEST_F(InstancePackTest, RejectsCorruptPacks) {
+    writePack();
+    std::string bytes;
+    {
+        std::ifstream in(path, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    // A flipped byte in the index fails its checksum
+    std::string corrupt = bytes;
+    corrupt[corrupt.size() - 3] ^= 0x20;
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << corrupt;
+    EXPECT_THROW(InstancePack pack(path), std::runtime_error);
+
+    // A truncated pack no longer matches its header
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << bytes.substr(0, bytes.size() - 10);
+    EXPECT_THROW(InstancePack pack(path), std::runtime_error);
+    EXPECT_THROW(InstancePackReader reader(path), std::runtime_error);
+
+    // A flipped byte inside an image is caught on verification only
+    corrupt = bytes;
+    corrupt[64 + 128] ^= 0x01;
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << corrupt;
+    InstancePack pack(path);
+    EXPECT_THROW(pack.flat(0, true), std::runtime_error);
+    EXPECT_NO_THROW(pack.flat(1, true));
+}
+
+TEST_F(InstancePackTest, VerifiesImagesByDefault) {
+    writePack();
+    std::string corrupt;
+    {
+        std::ifstream in(path, std::ios::binary);
+        corrupt.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    corrupt[64 + 128] ^= 0x01;
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << corrupt;
+
+    // A corrupt image is a clean error rather than an out-of-bounds read
+    InstancePack pack(path);
+    EXPECT_THROW(pack.problem(0), std::runtime_error);
+    EXPECT_THROW(pack.flat(0), std::runtime_error);
+    EXPECT_NO_THROW(pack.flat(0, false));
+    EXPECT_EQ(pack.problem(1)->getTotalOperations(), problems[1]->getTotalOperations());
+
+    InstancePackReader reader(path);
+    FlatInstance instance;
+    EXPECT_THROW(reader.next(instance), std::runtime_error);
+}
@@ -0,0 +1,224 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "elite_pool.hpp"
+#include "island_model.hpp"
+#include "sequence_schedule.hpp"
+#include "solver.hpp"
+
+class IslandModelTest : public ::testing::Test {
+protected:
+    /**
+     * SetUp method for test fixture.
+     */
+    void SetUp() override {
+        problem = std::make_shared<ProblemInstance>();
+        problem->createJobs(10);
+        problem->createMachines(5);
+        std::mt19937 rng(4);
+        int id = 0;
+        for (int j = 0; j < 10; ++j) {
+            std::vector<int> machines = {0, 1, 2, 3, 4};
+            std::shuffle(machines.begin(), machines.end(), rng);
+            for (int m : machines) {
+                problem->getJob(j)->addOperation(std::make_shared<Operation>(j, m, 1 + static_cast<int>(rng() % 20), id++));
+            }
+        }
+        auto result = Solver(SchedulingAlgorithm::SPT).solve(problem);
+        flat = FlatInstance::fromProblem(result->problem);
+        initial = flat.machineSequences(result->problem);
+    }
+
+    /**
+     * Times a schedule from scratch.
+     */
+    int makespanOf(const MachineSequences& sequences) {
+        SequenceSchedule schedule(flat);
+        EXPECT_TRUE(schedule.load(sequences));
+        return schedule.getMakespan();
+    }
+
+    std::shared_ptr<ProblemInstance> problem;
+    FlatInstance flat;
+    MachineSequences initial;
+};
+
+TEST_F(IslandModelTest, RingSkipsOwnAndOverwrittenSchedules) {
+    MigrationRing ring(3, 4);
+    uint64_t cursor = 0;
+    ring.publish(0, 50, {0, 1, 2, 3});
+    ring.publish(1, 40, {3, 2, 1, 0});
+
+    std::vector<Migrant> migrants = ring.collect(0, cursor);
+    ASSERT_EQ(migrants.size(), 1u);
+    EXPECT_EQ(migrants[0].sender, 1);
+    EXPECT_EQ(migrants[0].makespan, 40);
+    EXPECT_EQ(migrants[0].sequence, (std::vector<int>{3, 2, 1, 0}));
+    EXPECT_EQ(cursor, 2u);
+    EXPECT_TRUE(ring.collect(0, cursor).empty());
+
+    // Five more publishes overwrite the two oldest unread slots
+    for (int i = 0; i < 5; ++i) {
+        ring.publish(2, 30 - i, {i, i, i, i});
+    }
+    migrants = ring.collect(0, cursor);
+    ASSERT_EQ(migrants.size(), 3u);
+    EXPECT_EQ(migrants.front().makespan, 28);
+    EXPECT_EQ(ring.getPublished(), 7u);
+    EXPECT_THROW(ring.publish(0, 1, {1, 2}), std::invalid_argument);
+}
+
+TEST_F(IslandModelTest, RingNeverReturnsTornSchedules) {
+    // Two slots wrap constantly under four writers; every schedule read must be one writer's
+    MigrationRing ring(2, 256);
+    std::atomic<bool> writing{true};
+    std::vector<std::thread> writers;
+    for (int sender = 0; sender < 4; ++sender) {
+        writers.emplace_back([&ring, sender]() {
+            std::vector<int> sequence(256, sender);
+            for (int i = 0; i < 5000; ++i) {
+                ring.publish(sender, sender, sequence);
+            }
+        });
+    }
+    std::thread reader([&ring, &writing]() {
+        uint64_t cursor = 0;
+        while (writing.load()) {
+            for (const Migrant& migrant : ring.collect(-1, cursor)) {
+                EXPECT_EQ(migrant.makespan, migrant.sender);
+                EXPECT_EQ(std::count(migrant.sequence.begin(), migrant.sequence.end(), migrant.sender), 256);
+            }
+        }
+    });
+    for (auto& writer : writers) {
+        writer.join();
+    }
+    writing = false;
+    reader.join();
+    EXPECT_EQ(ring.getPublished(), 20000u);
+}
+
+TEST_F(IslandModelTest, RingIsSharedWithChildProcesses) {
+    MigrationRing ring(4, 2);
+    pid_t pid = fork();
+    if (pid == 0) {
+        ring.publish(7, 11, {5, 6});
+        _exit(0);
+    }
+    ASSERT_GT(pid, 0);
+    int status = 0;
+    waitpid(pid, &status, 0);
+
+    uint64_t cursor = 0;
+    std::vector<Migrant> migrants = ring.collect(0, cursor);
+    ASSERT_EQ(migrants.size(), 1u);
+    EXPECT_EQ(migrants[0].sender, 7);
+    EXPECT_EQ(migrants[0].sequence, (std::vector<int>{5, 6}));
+}
+
+TEST_F(IslandModelTest, IslandsImproveAndMigrate) {
+    IslandConfig config;
+    config.islands = 3;
+    config.iterations = 60;
+    config.migrationInterval = 10;
+    config.lns.threads = 1;
+
+    IslandResult result = IslandModel(flat, config).run(initial);
+    EXPECT_EQ(result.completedIslands, 3);
+    EXPECT_EQ(result.failedIslands, 0);
+    EXPECT_LE(result.makespan, makespanOf(initial));
+    EXPECT_EQ(makespanOf(result.sequences), result.makespan);
+    EXPECT_GT(result.migrationsPublished, 0u);
+
+    // Final and migrated schedules can be collected for relinking
+    ElitePool elites(8);
+    result = IslandModel(flat, config).run(initial, &elites);
+    ASSERT_GT(elites.size(), 0);
+    EXPECT_EQ(elites.getBest().makespan, result.makespan);
+    for (const auto& elite : elites.snapshot()) {
+        EXPECT_EQ(makespanOf(elite.sequences), elite.makespan);
+    }
+}
+
+TEST_F(IslandModelTest, FailedIslandsAreContained) {
+    IslandConfig config;
+    config.islands = 2;
+    config.iterations = 10;
+
+    // Every worker throws on the malformed schedule; the parent survives
+    MachineSequences malformed = initial;
+    malformed[0].pop_back();
+    EXPECT_THROW(IslandModel(flat, config).run(malformed), std::runtime_error);
+    EXPECT_NO_THROW(IslandModel(flat, config).run(initial));
+
+    config.islands = 0;
+    EXPECT_THROW(IslandModel(flat, config), std::invalid_argument);
+}
+
+TEST_F(IslandModelTest, WorkersOverMemoryLimitFail) {
+    // Leave room for the copied address space, then overrun it on island 0 only
+    long pages = 0;
+    std::ifstream("/proc/self/statm") >> pages;
+    ASSERT_GT(pages, 0);
+    IslandConfig config;
+    config.islands = 2;
+    config.iterations = 10;
+    config.memoryLimitMB = pages * sysconf(_SC_PAGESIZE) / (1L << 20) + 256;
+    long limitMB = config.memoryLimitMB;
+    config.workerHook = [limitMB](int island) {
+        if (island == 0) {
+            std::vector<char> block(static_cast<size_t>(limitMB) << 20, 1);
+            std::cout << block.back();
+        }
+    };
+
+    IslandResult result = IslandModel(flat, config).run(initial);
+    EXPECT_EQ(result.completedIslands, 1);
+    EXPECT_EQ(result.failedIslands, 1);
+    EXPECT_EQ(result.stalledIslands, 0);
+}
+
+TEST_F(IslandModelTest, StalledIslandsAreKilled) {
+    IslandConfig config;
+    config.islands = 2;
+    config.iterations = 10;
+    config.stallTimeout = 0.2;
+    config.workerHook = [](int island) {
+        while (island == 0) {
+            pause();
+        }
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    IslandResult result = IslandModel(flat, config).run(initial);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(30));
+    EXPECT_EQ(result.completedIslands, 1);
+    EXPECT_EQ(result.failedIslands, 1);
+    EXPECT_EQ(result.stalledIslands, 1);
+
+    config.stallTimeout = -1;
+    EXPECT_THROW(IslandModel(flat, config), std::invalid_argument);
+}
+
+TEST_F(IslandModelTest, SolverRunsIslands) {
+    auto solver = Solver::createIslandSolver();
+    SolverConfig config;
+    config.lnsIterations = 20;
+    config.islands = 2;
+    config.migrationInterval = 5;
+    solver->setConfig(config);
+
+    int sptMakespan = makespanOf(initial);
+    auto result = solver->solve(problem);
+    EXPECT_LE(result->makespan, sptMakespan);
+}
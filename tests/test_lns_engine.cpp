@@ -0,0 +1,201 @@
+#include <gtest/gtest.h>
+#include <climits>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "checkpoint.hpp"
+#include "elite_pool.hpp"
+#include "lns_engine.hpp"
+#include "parser.hpp"
+#include "solver.hpp"
+
+class LNSEngineTest : public ::testing::Test {
+protected:
+    /**
+     * SetUp method for test fixture.
+     */
+    void SetUp() override {
+        problem = std::make_shared<ProblemInstance>();
+        problem->createJobs(10);
+        problem->createMachines(5);
+        std::mt19937 rng(21);
+        int id = 0;
+        for (int j = 0; j < 10; ++j) {
+            std::vector<int> machines = {0, 1, 2, 3, 4};
+            std::shuffle(machines.begin(), machines.end(), rng);
+            for (int m : machines) {
+                problem->getJob(j)->addOperation(std::make_shared<Operation>(j, m, 1 + static_cast<int>(rng() % 30), id++));
+            }
+        }
+        flat = FlatInstance::fromProblem(*problem);
+    }
+
+    /**
+     * Builds acyclic machine sequences from a random job-repetition order.
+     */
+    MachineSequences randomSequences(const FlatInstance& instance, unsigned seed) {
+        std::vector<int> order;
+        for (int j = 0; j < instance.getNumJobs(); ++j) {
+            order.insert(order.end(), instance.jobLength(j), j);
+        }
+        std::mt19937 rng(seed);
+        std::shuffle(order.begin(), order.end(), rng);
+
+        MachineSequences sequences(instance.getNumMachines());
+        std::vector<int> next(instance.getNumJobs());
+        for (int j = 0; j < instance.getNumJobs(); ++j) next[j] = instance.jobStart(j);
+        for (int job : order) {
+            int op = next[job]++;
+            sequences[instance.machine(op)].push_back(op);
+        }
+        return sequences;
+    }
+
+    std::shared_ptr<ProblemInstance> problem;
+    FlatInstance flat;
+};
+
+TEST_F(LNSEngineTest, ImprovesRandomSchedule) {
+    LNSConfig config;
+    config.threads = 2;
+    LNSEngine engine(flat, config);
+    MachineSequences initial = randomSequences(flat, 4);
+    engine.reset(initial);
+    int before = engine.getBestMakespan();
+
+    int after = engine.runIterations(60);
+    EXPECT_LT(after, before);
+    EXPECT_EQ(engine.getStatistics().iterations, 60);
+    EXPECT_GT(engine.getStatistics().subproblems, 0);
+    EXPECT_GT(engine.getStatistics().improvements, 0);
+
+    SequenceSchedule schedule(flat);
+    ASSERT_TRUE(schedule.load(engine.getBestSequences()));
+    EXPECT_EQ(schedule.getMakespan(), after);
+}
+
+TEST_F(LNSEngineTest, WholeProblemSubproblemIsSolvedExactly) {
+    auto small = Parser::generateSimpleProblem();
+    FlatInstance smallFlat = FlatInstance::fromProblem(*small);
+
+    // Brute force over every machine order (3! per machine)
+    MachineSequences orders = randomSequences(smallFlat, 1);
+    for (auto& sequence : orders) std::sort(sequence.begin(), sequence.end());
+    SequenceSchedule schedule(smallFlat);
+    int optimum = INT_MAX;
+    do {
+        do {
+            do {
+                if (schedule.load(orders)) optimum = std::min(optimum, schedule.getMakespan());
+            } while (std::next_permutation(orders[2].begin(), orders[2].end()));
+        } while (std::next_permutation(orders[1].begin(), orders[1].end()));
+    } while (std::next_permutation(orders[0].begin(), orders[0].end()));
+
+    LNSConfig config;
+    config.blockSize = 3;
+    config.machinesPerSubproblem = 3;
+    config.nodeLimit = 100000;
+    config.threads = 1;
+    LNSEngine engine(smallFlat, config);
+    engine.reset(randomSequences(smallFlat, 8));
+    EXPECT_EQ(engine.runIterations(1), optimum);
+    EXPECT_EQ(engine.getStatistics().provenOptimal, 1);
+}
+
+TEST_F(LNSEngineTest, SolverRunsLNSFromSPT) {
+    auto spt = Solver::createSPTSolver()->solve(problem);
+    int sptMakespan = spt->makespan;
+
+    auto solver = Solver::createLNSSolver();
+    solver->setLNSIterations(30);
+    EXPECT_EQ(solver->getLNSIterations(), 30);
+    auto result = solver->solve(problem);
+    EXPECT_LE(result->makespan, sptMakespan);
+
+    // Machines hold the improved order, timed consistently with the jobs
+    SequenceSchedule schedule(flat);
+    ASSERT_TRUE(schedule.load(flat.machineSequences(result->problem)));
+    EXPECT_EQ(schedule.getMakespan(), result->makespan);
+}
+
+TEST_F(LNSEngineTest, OffersVisitedSchedulesToElitePool) {
+    LNSConfig config;
+    config.threads = 1;
+    LNSEngine engine(flat, config);
+    ElitePool elites(8);
+    engine.setElitePool(&elites);
+    engine.reset(randomSequences(flat, 4));
+    EXPECT_EQ(elites.size(), 1);
+
+    // Every new best is offered, so the pool's best is the engine's
+    engine.runIterations(40);
+    EXPECT_GT(elites.size(), 1);
+    EXPECT_EQ(elites.getBest().makespan, engine.getBestMakespan());
+    SequenceSchedule schedule(flat);
+    for (const auto& elite : elites.snapshot()) {
+        ASSERT_TRUE(schedule.load(elite.sequences));
+        EXPECT_EQ(schedule.getMakespan(), elite.makespan);
+    }
+}
+
+TEST_F(LNSEngineTest, AdoptKeepsTheSearchGoing) {
+    LNSConfig config;
+    config.threads = 1;
+    LNSEngine engine(flat, config);
+    engine.reset(randomSequences(flat, 5));
+    engine.runIterations(10);
+    MachineSequences better = engine.getBestSequences();
+    int bestMakespan = engine.getBestMakespan();
+
+    // Adopting a worse schedule keeps the best; counters and generator carry on
+    LNSEngine other(flat, config);
+    other.reset(randomSequences(flat, 6));
+    other.runIterations(3);
+    other.adopt(randomSequences(flat, 7));
+    EXPECT_EQ(other.getStatistics().iterations, 3);
+    other.adopt(better);
+    EXPECT_LE(other.getBestMakespan(), bestMakespan);
+
+    SearchCheckpoint adopted;
+    other.saveState(adopted);
+    LNSEngine restarted(flat, config);
+    restarted.reset(better);
+    SearchCheckpoint fresh;
+    restarted.saveState(fresh);
+    EXPECT_EQ(adopted.current, fresh.current);
+    EXPECT_NE(adopted.rngState, fresh.rngState);
+}
+
+TEST_F(LNSEngineTest, SolverRelinksElitesAfterLNS) {
+    SolverConfig config;
+    config.lnsIterations = 30;
+    config.lns.threads = 1;
+    config.eliteSize = 0;
+    Solver solver(SchedulingAlgorithm::LNS);
+    solver.setConfig(config);
+    int plain = solver.solve(problem)->makespan;
+
+    // The same search followed by the relinking phase
+    config.eliteSize = 8;
+    solver.setConfig(config);
+    testing::internal::CaptureStdout();
+    auto result = solver.solve(problem);
+    std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_NE(output.find("Path relinking over"), std::string::npos);
+    EXPECT_LE(result->makespan, plain);
+
+    SequenceSchedule schedule(flat);
+    ASSERT_TRUE(schedule.load(flat.machineSequences(result->problem)));
+    EXPECT_EQ(schedule.getMakespan(), result->makespan);
+}
+
+TEST_F(LNSEngineTest, RejectsInvalidUse) {
+    LNSConfig config;
+    config.blockSize = 1;
+    EXPECT_THROW(LNSEngine(flat, config), std::invalid_argument);
+
+    LNSEngine engine(flat);
+    EXPECT_THROW(engine.runIterations(1), std::runtime_error);
+    EXPECT_EQ(LNSEngine::getNeighborhoodName(NeighborhoodType::TimeWindow), "Time window");
+}
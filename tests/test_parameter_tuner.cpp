@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include "parameter_tuner.hpp"
+#include "solver.hpp"
+
+class ParameterTunerTest : public ::testing::Test {
+protected:
+    /**
+     * SetUp method for test fixture.
+     */
+    void SetUp() override {
+        for (unsigned seed = 1; seed <= 3; ++seed) {
+            auto problem = std::make_shared<ProblemInstance>();
+            problem->createJobs(8);
+            problem->createMachines(5);
+            std::mt19937 rng(seed);
+            int id = 0;
+            for (int j = 0; j < 8; ++j) {
+                std::vector<int> machines = {0, 1, 2, 3, 4};
+                std::shuffle(machines.begin(), machines.end(), rng);
+                for (int m : machines) {
+                    problem->getJob(j)->addOperation(std::make_shared<Operation>(j, m, 1 + static_cast<int>(rng() % 20), id++));
+                }
+            }
+            training.push_back(problem);
+        }
+        settings.threads = 2;
+        settings.maxBlocks = 12;
+    }
+
+    std::vector<std::shared_ptr<ProblemInstance>> training;
+    RaceSettings settings;
+};
+
+TEST_F(ParameterTunerTest, ConfigRoundTripsThroughFile) {
+    SolverConfig config;
+    config.lnsIterations = 50;
+    config.lns.blockSize = 8;
+    config.lns.nodeLimit = 750;
+    config.lns.seed = 99;
+
+    const std::string filename = "test_parameter_tuner.cfg";
+    config.saveToFile(filename);
+    EXPECT_EQ(SolverConfig::loadFromFile(filename), config);
+
+    Solver solver(SchedulingAlgorithm::LNS);
+    solver.loadConfig(filename);
+    EXPECT_EQ(solver.getLNSIterations(), 50);
+    EXPECT_EQ(solver.getConfig().lns.blockSize, 8);
+    std::remove(filename.c_str());
+}
+
+TEST_F(ParameterTunerTest, ConfigParsingIsStrict) {
+    SolverConfig parsed = SolverConfig::parseString("# tuned\n\nblock_size = 4  # comment\ntabu_tenure=0\n");
+    EXPECT_EQ(parsed.lns.blockSize, 4);
+    EXPECT_EQ(parsed.lns.tabuTenure, 0);
+    EXPECT_EQ(parsed.lnsIterations, SolverConfig().lnsIterations);
+
+    EXPECT_THROW(SolverConfig::parseString("block_size 4\n"), std::invalid_argument);
+    EXPECT_THROW(SolverConfig::parseString("cooling_rate = 3\n"), std::invalid_argument);
+    EXPECT_THROW(SolverConfig::parseString("block_size = 1\n"), std::invalid_argument);
+    EXPECT_THROW(SolverConfig::parseString("node_limit = 10x\n"), std::invalid_argument);
+    EXPECT_THROW(SolverConfig::loadFromFile("missing_config.cfg"), std::runtime_error);
+}
+
+TEST_F(ParameterTunerTest, FriedmanDropsDominatedCandidates) {
+    std::vector<std::vector<double>> costs;
+    for (int b = 0; b < 10; ++b) {
+        costs.push_back({100.0 + b % 3, 101.0 + (b + 1) % 3, 150.0});
+    }
+    std::vector<bool> keep = ParameterTuner::friedmanSurvivors(costs, 0.05);
+    EXPECT_TRUE(keep[0]);
+    EXPECT_TRUE(keep[1]);
+    EXPECT_FALSE(keep[2]);
+
+    // Identical results give no evidence against anyone
+    std::vector<std::vector<double>> ties(10, std::vector<double>{7.0, 7.0, 7.0});
+    for (bool survives : ParameterTuner::friedmanSurvivors(ties, 0.05)) {
+        EXPECT_TRUE(survives);
+    }
+
+    // Too few blocks to tell apart
+    std::vector<std::vector<double>> few = {{1.0, 2.0, 3.0}};
+    for (bool survives : ParameterTuner::friedmanSurvivors(few, 0.05)) {
+        EXPECT_TRUE(survives);
+    }
+}
+
+TEST_F(ParameterTunerTest, RaceEliminatesWeakConfiguration) {
+    SolverConfig strong;
+    strong.lnsIterations = 40;
+    SolverConfig weak = strong;
+    weak.lnsIterations = 0;
+
+    ParameterTuner tuner(training, settings);
+    RaceResult result = tuner.race({weak, strong});
+    EXPECT_EQ(result.best, strong);
+    EXPECT_EQ(result.survivors.size(), 1u);
+    EXPECT_LE(result.blocks, settings.maxBlocks);
+    EXPECT_EQ(tuner.evaluate(strong, 4), tuner.evaluate(strong, 4));
+}
+
+TEST_F(ParameterTunerTest, TuneRespectsRangesAndBudget) {
+    settings.candidates = 6;
+    settings.races = 2;
+    settings.budget = 60;
+    ParameterTuner tuner(training, settings);
+
+    SolverConfig base;
+    base.lnsIterations = 10;
+    RaceResult result = tuner.tune(base, ParameterTuner::getDefaultRanges());
+    EXPECT_LE(result.evaluations, settings.budget);
+    EXPECT_FALSE(result.survivors.empty());
+    EXPECT_EQ(result.best.lnsIterations, 10);
+    for (const auto& range : ParameterTuner::getDefaultRanges()) {
+        EXPECT_GE(result.best.getValue(range.key), range.minValue);
+        EXPECT_LE(result.best.getValue(range.key), range.maxValue);
+    }
+
+    EXPECT_THROW(tuner.tune(base, {{"block_size", 1, 4, false}}), std::invalid_argument);
+    EXPECT_THROW(ParameterTuner({}, settings), std::invalid_argument);
+}
@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include "path_relinking.hpp"
+#include "sequence_hash.hpp"
+#include "sequence_schedule.hpp"
+#include "thread_pool.hpp"
+
+class PathRelinkingTest : public ::testing::Test {
+protected:
+    /**
+     * SetUp method for test fixture.
+     */
+    void SetUp() override {
+        problem = std::make_shared<ProblemInstance>();
+        problem->createJobs(8);
+        problem->createMachines(6);
+        std::mt19937 rng(9);
+        int id = 0;
+        for (int j = 0; j < 8; ++j) {
+            std::vector<int> machines = {0, 1, 2, 3, 4, 5};
+            std::shuffle(machines.begin(), machines.end(), rng);
+            for (int m : machines) {
+                problem->getJob(j)->addOperation(std::make_shared<Operation>(j, m, 1 + static_cast<int>(rng() % 20), id++));
+            }
+        }
+        flat = FlatInstance::fromProblem(*problem);
+    }
+
+    /**
+     * Builds acyclic machine sequences from a random job-repetition order.
+     */
+    MachineSequences randomSequences(unsigned seed) {
+        std::vector<int> order;
+        for (int j = 0; j < flat.getNumJobs(); ++j) {
+            order.insert(order.end(), flat.jobLength(j), j);
+        }
+        std::mt19937 rng(seed);
+        std::shuffle(order.begin(), order.end(), rng);
+
+        MachineSequences sequences(flat.getNumMachines());
+        std::vector<int> next(flat.getNumJobs());
+        for (int j = 0; j < flat.getNumJobs(); ++j) next[j] = flat.jobStart(j);
+        for (int job : order) {
+            int op = next[job]++;
+            sequences[flat.machine(op)].push_back(op);
+        }
+        return sequences;
+    }
+
+    /**
+     * Times a schedule from scratch.
+     */
+    int makespanOf(const MachineSequences& sequences) {
+        SequenceSchedule schedule(flat);
+        EXPECT_TRUE(schedule.load(sequences));
+        return schedule.getMakespan();
+    }
+
+    std::shared_ptr<ProblemInstance> problem;
+    FlatInstance flat;
+};
+
+TEST_F(PathRelinkingTest, DistanceCountsReorderedPairs) {
+    MachineSequences a = randomSequences(1);
+    EXPECT_EQ(ElitePool::distance(a, a), 0);
+
+    MachineSequences b = a;
+    std::swap(b[2][3], b[2][4]);
+    EXPECT_EQ(ElitePool::distance(a, b), 1);
+
+    std::reverse(b[0].begin(), b[0].end());
+    long k = static_cast<long>(b[0].size());
+    EXPECT_EQ(ElitePool::distance(a, b), 1 + k * (k - 1) / 2);
+    EXPECT_EQ(ElitePool::distance(a, b), ElitePool::distance(b, a));
+}
+
+TEST_F(PathRelinkingTest, PoolStaysBoundedAndDiverse) {
+    ElitePool pool(4, 3);
+    MachineSequences first = randomSequences(1);
+    ASSERT_TRUE(pool.tryInsert(first, makespanOf(first)));
+    EXPECT_FALSE(pool.tryInsert(first, makespanOf(first)));
+
+    // Too close to a member and not a new best
+    MachineSequences near = first;
+    std::swap(near[0][0], near[0][1]);
+    EXPECT_FALSE(pool.tryInsert(near, makespanOf(first) + 1));
+
+    for (unsigned seed = 2; seed < 40; ++seed) {
+        MachineSequences candidate = randomSequences(seed);
+        pool.tryInsert(candidate, makespanOf(candidate));
+    }
+    EXPECT_EQ(pool.size(), 4);
+
+    auto members = pool.snapshot();
+    for (size_t i = 1; i < members.size(); ++i) {
+        EXPECT_LE(members[i - 1].makespan, members[i].makespan);
+    }
+    EXPECT_EQ(pool.getBest().makespan, members.front().makespan);
+}
+
+TEST_F(PathRelinkingTest, RelinkWalksTowardsGuide) {
+    MachineSequences from = randomSequences(3);
+    MachineSequences to = randomSequences(4);
+    long distance = ElitePool::distance(from, to);
+    ASSERT_GT(distance, 1);
+
+    PathRelinker relinker(flat);
+    relinker.setCandidateLimit(0);
+    RelinkResult result = relinker.relink(from, to, 1);
+
+    ASSERT_GE(result.makespan, 0);
+    EXPECT_EQ(makespanOf(result.sequences), result.makespan);
+    EXPECT_LE(result.steps, distance - 1);
+    EXPECT_GE(ElitePool::distance(result.sequences, to), distance - result.steps);
+}
+
+TEST_F(PathRelinkingTest, ParallelPhaseNeverWorsensPool) {
+    ElitePool pool(5, 2);
+    for (unsigned seed = 10; seed < 15; ++seed) {
+        MachineSequences candidate = randomSequences(seed);
+        pool.tryInsert(candidate, makespanOf(candidate));
+    }
+    int before = pool.getBest().makespan;
+
+    PathRelinker relinker(flat);
+    int after = relinker.runPhase(pool, 2, 42);
+    EXPECT_LE(after, before);
+    EXPECT_LE(pool.size(), 5);
+    EXPECT_EQ(makespanOf(pool.getBest().sequences), after);
+
+    ElitePool empty(3);
+    EXPECT_EQ(relinker.runPhase(empty, 2), -1);
+}
+
+TEST_F(PathRelinkingTest, CacheSkipsSchedulesAlreadyTimed) {
+    MachineSequences from = randomSequences(3);
+    MachineSequences to = randomSequences(4);
+    PathRelinker plain(flat);
+    plain.setCandidateLimit(0);
+    RelinkResult expected = plain.relink(from, to, 1);
+
+    // The same walk with incrementally hashed candidates; the second walk times
+    // only what slot collisions evicted
+    EvaluationCache cache(1 << 16);
+    PathRelinker cached(flat);
+    cached.setCandidateLimit(0);
+    cached.setCache(&cache);
+    RelinkResult first = cached.relink(from, to, 1);
+    EXPECT_EQ(first.sequences, expected.sequences);
+    EXPECT_EQ(first.makespan, expected.makespan);
+    EXPECT_EQ(first.steps, expected.steps);
+    uint64_t firstStores = cache.getStores();
+    EXPECT_GT(firstStores, 0u);
+
+    cache.resetStatistics();
+    RelinkResult second = cached.relink(from, to, 1);
+    EXPECT_EQ(second.sequences, expected.sequences);
+    EXPECT_LT(cache.getStores() * 10, firstStores);
+    EXPECT_GT(cache.getHits(), 0u);
+
+    // Paths of a phase share schedules
+    ElitePool pool(4, 2);
+    for (unsigned seed = 20; seed < 24; ++seed) {
+        MachineSequences candidate = randomSequences(seed);
+        pool.tryInsert(candidate, makespanOf(candidate));
+    }
+    cache.clear();
+    cache.resetStatistics();
+    int best = cached.runPhase(pool, 2, 7);
+    EXPECT_GT(cache.getHits(), 0u);
+    EXPECT_EQ(makespanOf(pool.getBest().sequences), best);
+}
+
+TEST_F(PathRelinkingTest, ThreadPoolReturnsResultsAndErrors) {
+    ThreadPool workers(2);
+    auto value = workers.submit([]() { return 6 * 7; });
+    auto failure = workers.submit([]() -> int { throw std::runtime_error("boom"); });
+    EXPECT_EQ(value.get(), 42);
+    EXPECT_THROW(failure.get(), std::runtime_error);
+    EXPECT_EQ(workers.getThreadCount(), 2);
+}
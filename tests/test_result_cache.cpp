@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include "instance_generator.hpp"
+#include "result_cache.hpp"
+#include "schedule_validator.hpp"
+#include "solver.hpp"
+
+class ResultCacheTest : public ::testing::Test {
+protected:
+    /**
+     * SetUp method for test fixture.
+     */
+    void SetUp() override {
+        directory = "test_result_cache_dir";
+        std::filesystem::remove_all(directory);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(directory);
+    }
+
+    /**
+     * Generates an instance; equal seeds give equal instances.
+     */
+    static std::shared_ptr<ProblemInstance> generate(int jobs, int machines, uint64_t seed) {
+        GeneratorConfig config;
+        config.jobs = jobs;
+        config.machines = machines;
+        config.seed = seed;
+        return InstanceGenerator(config).generate();
+    }
+
+    std::string directory;
+};
+
+TEST_F(ResultCacheTest, SecondSolveIsAHit) {
+    auto cache = std::make_shared<ResultCache>(directory);
+    Solver solver(SchedulingAlgorithm::SPT);
+    solver.setCache(cache);
+
+    auto first = solver.solve(generate(12, 4, 3));
+    CacheStatistics stats = cache->getStatistics();
+    EXPECT_EQ(stats.misses, 1);
+    EXPECT_EQ(stats.stores, 1);
+    EXPECT_EQ(cache->size(), 1u);
+
+    // A fresh copy of the same instance hits and gets the same schedule
+    auto problem = generate(12, 4, 3);
+    auto second = solver.solve(problem);
+    stats = cache->getStatistics();
+    EXPECT_EQ(stats.hits, 1);
+    EXPECT_EQ(stats.misses, 1);
+    EXPECT_EQ(stats.stores, 1);
+    EXPECT_EQ(second->makespan, first->makespan);
+    EXPECT_EQ(second->totalCompletionTime, first->totalCompletionTime);
+    EXPECT_TRUE(ScheduleValidator::validate(*second).ok());
+    for (int j = 0; j < problem->numJobs; ++j) {
+        const auto& expected = first->problem.jobs[j]->operations;
+        const auto& actual = second->problem.jobs[j]->operations;
+        for (size_t k = 0; k < expected.size(); ++k) {
+            EXPECT_EQ(actual[k]->startTime, expected[k]->startTime);
+            EXPECT_EQ(actual[k]->endTime, expected[k]->endTime);
+        }
+    }
+    // The caller's own operations are scheduled, as on a miss
+    EXPECT_EQ(problem->getMachine(0)->scheduledOperations[0], second->problem.getMachine(0)->scheduledOperations[0]);
+    EXPECT_EQ(problem->jobs[0]->operations[0]->endTime, first->problem.jobs[0]->operations[0]->endTime);
+
+    // Entries outlive the cache object
+    ResultCache reopened(directory);
+    EXPECT_EQ(reopened.size(), 1u);
+    EXPECT_TRUE(reopened.lookup(ResultCache::makeKey(*problem, SchedulingAlgorithm::SPT, SolverConfig()), *problem));
+}
+
+TEST_F(ResultCacheTest, KeysFollowContentAndSettings) {
+    auto problem = generate(8, 3, 5);
+    SolverConfig config;
+    std::string key = ResultCache::makeKey(*problem, SchedulingAlgorithm::SPT, config);
+    EXPECT_EQ(key.rfind("spt-", 0), 0u);
+    EXPECT_EQ(key.size(), 4u + 32u);
+
+    // Operation ids and object identity are not part of the key
+    auto copy = generate(8, 3, 5);
+    copy->jobs[0]->operations[0]->operationId = 1000;
+    EXPECT_EQ(ResultCache::makeKey(*copy, SchedulingAlgorithm::SPT, config), key);
+
+    copy->jobs[0]->operations[0]->processingTime++;
+    EXPECT_NE(ResultCache::makeKey(*copy, SchedulingAlgorithm::SPT, config), key);
+    EXPECT_NE(ResultCache::makeKey(*problem, SchedulingAlgorithm::LPT, config), key);
+
+    // The engine config only matters to the search algorithms
+    SolverConfig other;
+    other.lnsIterations = 7;
+    EXPECT_EQ(ResultCache::makeKey(*problem, SchedulingAlgorithm::SPT, other), key);
+    EXPECT_NE(ResultCache::makeKey(*problem, SchedulingAlgorithm::LNS, other),
+              ResultCache::makeKey(*problem, SchedulingAlgorithm::LNS, config));
+}
+
+TEST_F(ResultCacheTest, EvictsLeastRecentlyUsed) {
+    ResultCache cache(directory, ResultCache::DEFAULT_MAX_BYTES, 2);
+    Solver solver(SchedulingAlgorithm::FIFO);
+    std::string keys[3];
+    for (int i = 0; i < 3; ++i) {
+        auto problem = generate(5, 3, 10 + i);
+        keys[i] = ResultCache::makeKey(*problem, SchedulingAlgorithm::FIFO, SolverConfig());
+        cache.store(keys[i], *solver.solve(problem));
+        if (i == 1) {
+            // Use the first entry, so the second is the oldest
+            EXPECT_TRUE(cache.lookup(keys[0], *generate(5, 3, 10)));
+        }
+    }
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_TRUE(cache.contains(keys[0]));
+    EXPECT_FALSE(cache.contains(keys[1]));
+    EXPECT_TRUE(cache.contains(keys[2]));
+    EXPECT_EQ(cache.getStatistics().evictions, 1);
+    EXPECT_FALSE(std::filesystem::exists(directory + "/" + keys[1] + ".jsol"));
+
+    // A byte limit below one entry keeps nothing
+    ResultCache tiny(directory, 16);
+    EXPECT_EQ(tiny.size(), 0u);
+    EXPECT_EQ(tiny.getBytes(), 0u);
+}
+
+TEST_F(ResultCacheTest, RejectsEntriesThatFailVerification) {
+    ResultCache cache(directory);
+    Solver solver(SchedulingAlgorithm::SPT);
+    auto problem = generate(6, 3, 21);
+    std::string key = ResultCache::makeKey(*problem, SchedulingAlgorithm::SPT, SolverConfig());
+    cache.store(key, *solver.solve(problem));
+
+    // An entry stored under the key of another instance is not applied
+    auto other = generate(6, 3, 22);
+    int before = other->jobs[0]->operations[0]->endTime;
+    EXPECT_FALSE(cache.lookup(key, *other));
+    EXPECT_EQ(other->jobs[0]->operations[0]->endTime, before);
+    EXPECT_EQ(cache.getStatistics().rejected, 1);
+    EXPECT_FALSE(cache.contains(key));
+
+    // Nor is a corrupt one
+    cache.store(key, *solver.solve(problem));
+    std::string path = directory + "/" + key + ".jsol";
+    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(80);
+    file.put('\x7f');
+    file.close();
+    EXPECT_FALSE(cache.lookup(key, *problem));
+    CacheStatistics stats = cache.getStatistics();
+    EXPECT_EQ(stats.rejected, 2);
+    EXPECT_EQ(stats.misses, 2);
+    EXPECT_EQ(stats.hits, 0);
+    EXPECT_FALSE(std::filesystem::exists(path));
+}
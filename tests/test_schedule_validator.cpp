@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <string>
+#include "instance_generator.hpp"
+#include "parser.hpp"
+#include "schedule_validator.hpp"
+#include "solution_serializer.hpp"
+#include "solver.hpp"
+
+class ScheduleValidatorTest : public ::testing::Test {
+protected:
+    /**
+     * SetUp method for test fixture.
+     */
+    void SetUp() override {
+        GeneratorConfig config;
+        config.jobs = 10;
+        config.machines = 5;
+        config.seed = 17;
+        problem = InstanceGenerator(config).generate();
+        path = "test_schedule_validator.txt";
+    }
+
+    void TearDown() override {
+        std::remove(path.c_str());
+    }
+
+    /**
+     * Builds the two-job schedule
+     *   job 0: op 0 on M0 [0-3], op 1 on M1 [3-5]
+     *   job 1: op 2 on M1 [0-2], op 3 on M0 [3-7]
+     */
+    static std::shared_ptr<ScheduleResult> smallSchedule() {
+        auto result = std::make_shared<ScheduleResult>();
+        result->problem.createJobs(2);
+        result->problem.createMachines(2);
+        int times[4][4] = {{0, 0, 0, 3}, {0, 1, 3, 5}, {1, 1, 0, 2}, {1, 0, 3, 7}};
+        for (int id = 0; id < 4; ++id) {
+            int job = times[id][0], machine = times[id][1], start = times[id][2], end = times[id][3];
+            auto operation = std::make_shared<Operation>(job, machine, end - start, id);
+            result->problem.getJob(job)->addOperation(operation);
+            result->problem.getMachine(machine)->scheduleOperation(operation, start);
+        }
+        result->calculateMetrics();
+        return result;
+    }
+
+    std::shared_ptr<ProblemInstance> problem;
+    std::string path;
+};
+
+TEST_F(ScheduleValidatorTest, SolverSchedulesAreFeasible) {
+    for (auto algorithm : {SchedulingAlgorithm::FIFO, SchedulingAlgorithm::SPT, SchedulingAlgorithm::LPT}) {
+        auto result = Solver(algorithm).solve(problem);
+        ValidationReport report = ScheduleValidator::validate(*result);
+        EXPECT_TRUE(report.ok()) << report.summary();
+        EXPECT_EQ(report.operations, 50u);
+        EXPECT_EQ(report.machineEntries, 50u);
+        EXPECT_EQ(report.makespan, result->makespan);
+        EXPECT_EQ(report.summary(), "feasible");
+    }
+    EXPECT_TRUE(ScheduleValidator::validate(*smallSchedule()).ok());
+    EXPECT_TRUE(ScheduleValidator::validate(ScheduleResult()).ok());
+}
+
+TEST_F(ScheduleValidatorTest, LoadedTextSolutionsAreFeasible) {
+    // Machine schedules of text solutions hold copies of the operations
+    SolutionSerializer::exportText(Solver(SchedulingAlgorithm::SPT).solve(problem), path);
+    ValidationReport report = ScheduleValidator::validate(*Parser::loadSolution(path));
+    EXPECT_TRUE(report.ok()) << report.summary();
+}
+
+TEST_F(ScheduleValidatorTest, ReportsJobViolations) {
+    auto result = smallSchedule();
+    auto& job0 = result->problem.getJob(0)->operations;
+    job0[1]->setScheduled(2, 4); // overlaps its predecessor, which ends at 3
+    result->problem.getJob(1)->operations[0]->setScheduled(-1, 2);
+
+    ValidationReport report = ScheduleValidator::validate(*result);
+    EXPECT_EQ(report.count(ViolationType::PRECEDENCE), 1u);
+    EXPECT_EQ(report.count(ViolationType::NEGATIVE_START), 1u);
+    EXPECT_EQ(report.count(ViolationType::DURATION_MISMATCH), 1u);
+    EXPECT_EQ(report.total, 3u);
+
+    const Violation& precedence = report.violations[0];
+    EXPECT_EQ(precedence.type, ViolationType::PRECEDENCE);
+    EXPECT_EQ(precedence.jobId, 0);
+    EXPECT_EQ(precedence.operationId, 1);
+    EXPECT_EQ(precedence.otherOperationId, 0);
+    EXPECT_EQ(precedence.expected, 3);
+    EXPECT_EQ(precedence.actual, 2);
+    EXPECT_EQ(precedence.describe(), "Job 0 operation 1 starts at 2, before job 0 operation 0 ends at 3");
+}
+
+TEST_F(ScheduleValidatorTest, ReportsMachineViolations) {
+    auto result = smallSchedule();
+    auto machine0 = result->problem.getMachine(0);
+    auto machine1 = result->problem.getMachine(1);
+
+    // Move job 1's last operation onto job 0's first one, out of sequence order
+    auto late = result->problem.getJob(1)->operations[1];
+    late->setScheduled(2, 6);
+    result->makespan = 6;
+    ValidationReport report = ScheduleValidator::validate(*result);
+    ASSERT_EQ(report.total, 1u) << report.summary();
+    EXPECT_EQ(report.violations[0].type, ViolationType::MACHINE_OVERLAP);
+    EXPECT_EQ(report.violations[0].operationId, 3);
+    EXPECT_EQ(report.violations[0].otherOperationId, 0);
+    EXPECT_EQ(report.violations[0].expected, 3);
+    late->setScheduled(3, 7);
+    result->makespan = 7;
+
+    // A copy with other times, a duplicate, an unknown entry and a wrong machine
+    auto copy = std::make_shared<Operation>(*machine1->scheduledOperations[0]);
+    copy->setScheduled(9, 11);
+    machine1->scheduledOperations[0] = copy;
+    machine1->scheduledOperations.push_back(machine1->scheduledOperations[1]);
+    machine1->scheduledOperations.push_back(std::make_shared<Operation>(0, 1, 1, 99));
+    machine1->scheduledOperations.push_back(machine0->scheduledOperations[1]);
+    machine0->scheduledOperations.pop_back();
+    result->makespan = 8;
+
+    report = ScheduleValidator::validate(*result);
+    EXPECT_EQ(report.count(ViolationType::TIME_MISMATCH), 1u);
+    EXPECT_EQ(report.count(ViolationType::DUPLICATE_OPERATION), 1u);
+    EXPECT_EQ(report.count(ViolationType::UNKNOWN_OPERATION), 1u);
+    EXPECT_EQ(report.count(ViolationType::WRONG_MACHINE), 1u);
+    EXPECT_EQ(report.count(ViolationType::MAKESPAN_MISMATCH), 1u);
+    EXPECT_EQ(report.count(ViolationType::MACHINE_OVERLAP), 1u); // job 1 operation 3 now overlaps on machine 1
+    EXPECT_EQ(report.total, 6u) << report.summary();
+
+    machine0->scheduledOperations.clear();
+    report = ScheduleValidator::validate(*result);
+    EXPECT_EQ(report.count(ViolationType::MISSING_FROM_MACHINE), 1u);
+}
+
+TEST_F(ScheduleValidatorTest, MatchesJobLocalOperationIds) {
+    // Ids repeat across jobs, so entries are matched by (jobId, operationId)
+    auto result = smallSchedule();
+    for (auto& job : result->problem.jobs) {
+        for (size_t k = 0; k < job->operations.size(); ++k) {
+            job->operations[k]->operationId = static_cast<int>(k);
+        }
+    }
+    EXPECT_TRUE(ScheduleValidator::validate(*result).ok());
+
+    result->problem.getMachine(1)->scheduledOperations.push_back(std::make_shared<Operation>(1, 1, 2, 5));
+    ValidationReport report = ScheduleValidator::validate(*result);
+    ASSERT_EQ(report.total, 1u);
+    EXPECT_EQ(report.violations[0].type, ViolationType::UNKNOWN_OPERATION);
+    EXPECT_EQ(report.violations[0].describe(), "Job 1 operation 5 on machine 1 is not in any job");
+}
+
+TEST_F(ScheduleValidatorTest, CapsReportedViolations) {
+    auto result = Solver(SchedulingAlgorithm::SPT).solve(problem);
+    for (auto& machine : result->problem.machines) {
+        machine->scheduledOperations.clear();
+    }
+    // 50 missing operations and 1200 unknown entries
+    for (int i = 0; i < 1200; ++i) {
+        result->problem.getMachine(0)->scheduledOperations.push_back(std::make_shared<Operation>(0, 0, 1, 5000 + i));
+    }
+
+    ValidationReport report = ScheduleValidator::validate(*result);
+    EXPECT_EQ(report.count(ViolationType::UNKNOWN_OPERATION), 1200u);
+    EXPECT_EQ(report.count(ViolationType::MISSING_FROM_MACHINE), 50u);
+    EXPECT_EQ(report.total, 1250u);
+    EXPECT_EQ(report.violations.size(), ScheduleValidator::MAX_REPORTED_VIOLATIONS);
+}
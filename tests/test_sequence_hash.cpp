@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "sequence_hash.hpp"
+#include "parser.hpp"
+#include "solver.hpp"
+
+class SequenceHashTest : public ::testing::Test {
+protected:
+    /**
+     * SetUp method for test fixture.
+     */
+    void SetUp() override {
+        problem = Parser::generateSimpleProblem();
+        flat = FlatInstance::fromProblem(*problem);
+        auto solver = std::make_shared<Solver>(SchedulingAlgorithm::SPT);
+        result = solver->solve(problem);
+    }
+
+    std::shared_ptr<ProblemInstance> problem;
+    std::shared_ptr<ScheduleResult> result;
+    FlatInstance flat;
+};
+
+TEST_F(SequenceHashTest, ScheduledMachinesMatchSequences) {
+    MachineSequences sequences = flat.machineSequences(result->problem);
+    ASSERT_EQ(static_cast<int>(sequences.size()), flat.getNumMachines());
+
+    int total = 0;
+    for (int m = 0; m < flat.getNumMachines(); ++m) {
+        for (int op : sequences[m]) {
+            EXPECT_EQ(flat.machine(op), m);
+        }
+        total += static_cast<int>(sequences[m].size());
+    }
+    EXPECT_EQ(total, flat.getNumOperations());
+    EXPECT_EQ(SequenceHasher::hash(flat, result->problem), SequenceHasher::hash(sequences));
+}
+
+TEST_F(SequenceHashTest, IncrementalDeltasMatchRecomputation) {
+    std::vector<int> sequence = {4, 1, 7, 2, 8, 0};
+    uint64_t before = SequenceHasher::hash(sequence);
+
+    std::vector<int> swapped = sequence;
+    std::swap(swapped[1], swapped[4]);
+    EXPECT_EQ(before ^ SequenceHasher::swapDelta(sequence, 1, 4), SequenceHasher::hash(swapped));
+    EXPECT_NE(before, SequenceHasher::hash(swapped));
+
+    for (int from = 0; from < 6; ++from) {
+        for (int to = 0; to < 6; ++to) {
+            std::vector<int> moved = sequence;
+            int op = moved[from];
+            moved.erase(moved.begin() + from);
+            moved.insert(moved.begin() + to, op);
+            EXPECT_EQ(before ^ SequenceHasher::moveDelta(sequence, from, to), SequenceHasher::hash(moved))
+                << from << " -> " << to;
+        }
+    }
+}
+
+TEST_F(SequenceHashTest, CacheStoresAndCountsHits) {
+    EvaluationCache cache(1000);
+    EXPECT_EQ(cache.getCapacity(), 1024u);
+
+    int makespan = -1;
+    uint64_t hash = SequenceHasher::hash(flat, result->problem);
+    EXPECT_FALSE(cache.lookup(hash, makespan));
+    cache.store(hash, result->makespan);
+    EXPECT_TRUE(cache.lookup(hash, makespan));
+    EXPECT_EQ(makespan, result->makespan);
+
+    // Same slot, different hash
+    EXPECT_FALSE(cache.lookup(hash + cache.getCapacity(), makespan));
+    EXPECT_EQ(cache.getLookups(), 3u);
+    EXPECT_EQ(cache.getHits(), 1u);
+    EXPECT_EQ(cache.getStores(), 1u);
+    EXPECT_NEAR(cache.getHitRate(), 1.0 / 3.0, 1e-9);
+
+    cache.clear();
+    cache.resetStatistics();
+    EXPECT_FALSE(cache.lookup(hash, makespan));
+    EXPECT_EQ(cache.getHits(), 0u);
+    EXPECT_THROW(cache.store(hash, -1), std::invalid_argument);
+}
+
+TEST_F(SequenceHashTest, ConcurrentAccessNeverReturnsWrongValue) {
+    EvaluationCache cache(64);
+    std::vector<std::thread> threads;
+    std::vector<int> wrong(4, 0);
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&cache, &wrong, t]() {
+            for (int i = 0; i < 20000; ++i) {
+                // Each hash always maps to the same makespan
+                uint64_t hash = SequenceHasher::key(i % 500, t);
+                int expected = (i % 500) * 10 + t;
+                int makespan = 0;
+                if (cache.lookup(hash, makespan) && makespan != expected) {
+                    ++wrong[t];
+                }
+                cache.store(hash, expected);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (int count : wrong) {
+        EXPECT_EQ(count, 0);
+    }
+    EXPECT_EQ(cache.getLookups(), 80000u);
+}
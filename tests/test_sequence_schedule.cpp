@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <random>
+#include <vector>
+#include "sequence_schedule.hpp"
+#include "parser.hpp"
+#include "solver.hpp"
+
+class SequenceScheduleTest : public ::testing::Test {
+protected:
+    /**
+     * SetUp method for test fixture.
+     */
+    void SetUp() override {
+        problem = std::make_shared<ProblemInstance>();
+        problem->createJobs(6);
+        problem->createMachines(5);
+        std::mt19937 rng(3);
+        int id = 0;
+        for (int j = 0; j < 6; ++j) {
+            std::vector<int> machines = {0, 1, 2, 3, 4};
+            std::shuffle(machines.begin(), machines.end(), rng);
+            for (int m : machines) {
+                problem->getJob(j)->addOperation(std::make_shared<Operation>(j, m, 1 + static_cast<int>(rng() % 9), id++));
+            }
+        }
+        flat = FlatInstance::fromProblem(*problem);
+    }
+
+    /**
+     * Builds acyclic machine sequences from a random job-repetition order.
+     */
+    MachineSequences randomSequences(unsigned seed) {
+        std::vector<int> order;
+        for (int j = 0; j < flat.getNumJobs(); ++j) {
+            order.insert(order.end(), flat.jobLength(j), j);
+        }
+        std::mt19937 rng(seed);
+        std::shuffle(order.begin(), order.end(), rng);
+
+        MachineSequences sequences(flat.getNumMachines());
+        std::vector<int> next(flat.getNumJobs());
+        for (int j = 0; j < flat.getNumJobs(); ++j) next[j] = flat.jobStart(j);
+        for (int job : order) {
+            int op = next[job]++;
+            sequences[flat.machine(op)].push_back(op);
+        }
+        return sequences;
+    }
+
+    std::shared_ptr<ProblemInstance> problem;
+    FlatInstance flat;
+};
+
+TEST_F(SequenceScheduleTest, LoadReproducesSolverTiming) {
+    auto solver = std::make_shared<Solver>(SchedulingAlgorithm::SPT);
+    auto result = solver->solve(problem);
+
+    SequenceSchedule schedule(flat);
+    ASSERT_TRUE(schedule.load(flat.machineSequences(result->problem)));
+    EXPECT_EQ(schedule.getMakespan(), result->makespan);
+    for (const auto& job : result->problem.jobs) {
+        for (const auto& operation : job->operations) {
+            EXPECT_EQ(schedule.startTime(flat.indexOf(job->jobId, operation->operationId)), operation->startTime);
+        }
+    }
+}
+
+TEST_F(SequenceScheduleTest, IncrementalSwapsMatchFullEvaluation) {
+    SequenceSchedule incremental(flat);
+    SequenceSchedule full(flat);
+    ASSERT_TRUE(incremental.load(randomSequences(11)));
+
+    std::mt19937 rng(5);
+    int accepted = 0;
+    int rejected = 0;
+    for (int i = 0; i < 300; ++i) {
+        int machine = static_cast<int>(rng() % flat.getNumMachines());
+        int position = static_cast<int>(rng() % (incremental.getSequences()[machine].size() - 1));
+
+        MachineSequences swapped = incremental.getSequences();
+        std::swap(swapped[machine][position], swapped[machine][position + 1]);
+        bool acyclic = full.load(swapped);
+
+        EXPECT_EQ(incremental.swapAdjacent(machine, position), acyclic);
+        if (acyclic) {
+            ++accepted;
+        } else {
+            ++rejected;
+            ASSERT_TRUE(full.load(incremental.getSequences()));
+        }
+        ASSERT_EQ(incremental.getMakespan(), full.getMakespan());
+        for (int op = 0; op < flat.getNumOperations(); ++op) {
+            ASSERT_EQ(incremental.startTime(op), full.startTime(op));
+        }
+    }
+    EXPECT_GT(accepted, 0);
+    EXPECT_GT(rejected, 0);
+}
+
+TEST_F(SequenceScheduleTest, ApplyToWritesSchedule) {
+    SequenceSchedule schedule(flat);
+    ASSERT_TRUE(schedule.load(randomSequences(2)));
+    schedule.applyTo(*problem);
+
+    ScheduleResult result;
+    result.problem = *problem;
+    result.calculateMetrics();
+    EXPECT_EQ(result.makespan, schedule.getMakespan());
+    EXPECT_EQ(flat.machineSequences(*problem), schedule.getSequences());
+}
+
+TEST_F(SequenceScheduleTest, RejectsMalformedSequences) {
+    SequenceSchedule schedule(flat);
+    MachineSequences sequences = randomSequences(1);
+    sequences[0].pop_back();
+    EXPECT_THROW(schedule.load(sequences), std::invalid_argument);
+
+    sequences = randomSequences(1);
+    std::swap(sequences[0][0], sequences[1][0]);
+    EXPECT_THROW(schedule.load(sequences), std::invalid_argument);
+}
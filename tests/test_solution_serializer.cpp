@@ -0,0 +1,468 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include "instance_generator.hpp"
+#include "parser.hpp"
+#include "solution_serializer.hpp"
+#include "solver.hpp"
+
+class SolutionSerializerTest : public ::testing::Test {
+protected:
+    /**
+     * SetUp method for test fixture.
+     */
+    void SetUp() override {
+        GeneratorConfig config;
+        config.jobs = 8;
+        config.machines = 4;
+        config.operationsPerJob = 5;
+        config.seed = 21;
+        result = Solver(SchedulingAlgorithm::SPT).solve(InstanceGenerator(config).generate());
+        path = "test_serializer_output";
+    }
+
+    void TearDown() override {
+        std::remove(path.c_str());
+    }
+
+    /**
+     * Builds the solution document as a nlohmann::json tree and dumps it
+     * the way exportJSON originally did.
+     */
+    static std::string dumpDocument(const ScheduleResult& result) {
+        json j;
+        j["problem"]["numJobs"] = result.problem.numJobs;
+        j["problem"]["numMachines"] = result.problem.numMachines;
+        j["problem"]["totalOperations"] = result.problem.getTotalOperations();
+
+        json operations = json::array();
+        for (const auto& job : result.problem.jobs) {
+            for (const auto& operation : job->operations) {
+                json op;
+                op["jobId"] = operation->jobId;
+                op["machineId"] = operation->machineId;
+                op["processingTime"] = operation->processingTime;
+                op["operationId"] = operation->operationId;
+                op["startTime"] = operation->startTime;
+                op["endTime"] = operation->endTime;
+                op["scheduled"] = operation->isScheduled();
+                operations.push_back(op);
+            }
+        }
+        j["operations"] = operations;
+
+        json machines = json::array();
+        for (const auto& machine : result.problem.machines) {
+            json m;
+            m["machineId"] = machine->machineId;
+            m["availableTime"] = machine->availableTime;
+            json scheduledOps = json::array();
+            for (const auto& operation : machine->scheduledOperations) {
+                json op;
+                op["jobId"] = operation->jobId;
+                op["operationId"] = operation->operationId;
+                op["startTime"] = operation->startTime;
+                op["endTime"] = operation->endTime;
+                scheduledOps.push_back(op);
+            }
+            m["scheduledOperations"] = scheduledOps;
+            machines.push_back(m);
+        }
+        j["machines"] = machines;
+
+        j["metrics"]["makespan"] = result.makespan;
+        j["metrics"]["totalCompletionTime"] = result.totalCompletionTime;
+        j["metrics"]["averageFlowTime"] = result.avgFlowTime;
+
+        std::ostringstream out;
+        out << std::setw(4) << j << std::endl;
+        return out.str();
+    }
+
+    /**
+     * Writes the text format with ostream insertions, the way exportText
+     * originally did.
+     */
+    static std::string streamText(const ScheduleResult& result) {
+        std::ostringstream file;
+        file << "JSSP SOLUTION EXPORT\n===================\n\n";
+        file << "PROBLEM METADATA:\n";
+        file << "Jobs: " << result.problem.numJobs << "\n";
+        file << "Machines: " << result.problem.numMachines << "\n";
+        file << "Total Operations: " << result.problem.getTotalOperations() << "\n\n";
+        file << "SCHEDULING RESULTS:\n===================\n\n";
+        for (const auto& job : result.problem.jobs) {
+            file << "Job " << job->jobId << ":\n";
+            for (const auto& operation : job->operations) {
+                if (operation->isScheduled()) {
+                    file << "  Operation " << operation->operationId << ": Machine " << operation->machineId
+                         << " [" << operation->startTime << "-" << operation->endTime << "]\n";
+                }
+            }
+            file << "\n";
+        }
+        file << "MACHINE SCHEDULES:\n==================\n\n";
+        for (const auto& machine : result.problem.machines) {
+            file << "Machine " << machine->machineId << ":\n";
+            for (const auto& operation : machine->scheduledOperations) {
+                file << "  Job " << operation->jobId << " Operation " << operation->operationId
+                     << " [" << operation->startTime << "-" << operation->endTime << "]\n";
+            }
+            file << "\n";
+        }
+        file << "PERFORMANCE METRICS:\n====================\n";
+        file << "Makespan: " << result.makespan << "\n";
+        file << "Total Completion Time: " << result.totalCompletionTime << "\n";
+        file << "Average Flow Time: " << result.avgFlowTime << "\n\n";
+        return file.str();
+    }
+
+    /**
+     * Writes the XML format with ostream insertions, the way exportXML
+     * originally did.
+     */
+    static std::string streamXML(const ScheduleResult& result) {
+        std::ostringstream file;
+        file << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<jssp_solution>\n";
+        file << "  <problem>\n";
+        file << "    <numJobs>" << result.problem.numJobs << "</numJobs>\n";
+        file << "    <numMachines>" << result.problem.numMachines << "</numMachines>\n";
+        file << "    <totalOperations>" << result.problem.getTotalOperations() << "</totalOperations>\n";
+        file << "  </problem>\n\n";
+        file << "  <operations>\n";
+        for (const auto& job : result.problem.jobs) {
+            for (const auto& operation : job->operations) {
+                file << "    <operation>\n";
+                file << "      <jobId>" << operation->jobId << "</jobId>\n";
+                file << "      <machineId>" << operation->machineId << "</machineId>\n";
+                file << "      <processingTime>" << operation->processingTime << "</processingTime>\n";
+                file << "      <operationId>" << operation->operationId << "</operationId>\n";
+                file << "      <startTime>" << operation->startTime << "</startTime>\n";
+                file << "      <endTime>" << operation->endTime << "</endTime>\n";
+                file << "      <scheduled>" << (operation->isScheduled() ? "true" : "false") << "</scheduled>\n";
+                file << "    </operation>\n";
+            }
+        }
+        file << "  </operations>\n\n";
+        file << "  <machines>\n";
+        for (const auto& machine : result.problem.machines) {
+            file << "    <machine>\n";
+            file << "      <machineId>" << machine->machineId << "</machineId>\n";
+            file << "      <availableTime>" << machine->availableTime << "</availableTime>\n";
+            file << "      <scheduledOperations>\n";
+            for (const auto& operation : machine->scheduledOperations) {
+                file << "        <scheduledOperation>\n";
+                file << "          <jobId>" << operation->jobId << "</jobId>\n";
+                file << "          <operationId>" << operation->operationId << "</operationId>\n";
+                file << "          <startTime>" << operation->startTime << "</startTime>\n";
+                file << "          <endTime>" << operation->endTime << "</endTime>\n";
+                file << "        </scheduledOperation>\n";
+            }
+            file << "      </scheduledOperations>\n";
+            file << "    </machine>\n";
+        }
+        file << "  </machines>\n\n";
+        file << "  <metrics>\n";
+        file << "    <makespan>" << result.makespan << "</makespan>\n";
+        file << "    <totalCompletionTime>" << result.totalCompletionTime << "</totalCompletionTime>\n";
+        file << "    <averageFlowTime>" << result.avgFlowTime << "</averageFlowTime>\n";
+        file << "  </metrics>\n";
+        file << "</jssp_solution>\n";
+        return file.str();
+    }
+
+    static std::string readFile(const std::string& filename) {
+        std::ifstream in(filename, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    std::shared_ptr<ScheduleResult> result;
+    std::string path;
+};
+
+TEST_F(SolutionSerializerTest, StreamedJSONMatchesDocument) {
+    SolutionSerializer::exportJSON(result, path);
+    EXPECT_EQ(readFile(path), dumpDocument(*result));
+
+    for (double flowTime : {0.0, 12.0, 1.0 / 3.0, 1e20, -2.5e-7}) {
+        result->avgFlowTime = flowTime;
+        std::ostringstream out;
+        SolutionSerializer::writeJSON(result, out);
+        EXPECT_EQ(out.str(), dumpDocument(*result)) << flowTime;
+    }
+}
+
+TEST_F(SolutionSerializerTest, StreamedJSONHandlesEmptyArrays) {
+    auto empty = std::make_shared<ScheduleResult>();
+    std::ostringstream out;
+    SolutionSerializer::writeJSON(empty, out);
+    EXPECT_EQ(out.str(), dumpDocument(*empty));
+
+    // A machine with nothing scheduled and an operation left unscheduled
+    empty->problem.createJobs(1);
+    empty->problem.createMachines(2);
+    empty->problem.getJob(0)->addOperation(std::make_shared<Operation>(0, 1, 3, 0));
+    empty->problem.machines[1]->scheduleOperation(empty->problem.getJob(0)->getOperation(0), 0);
+    empty->problem.getJob(0)->addOperation(std::make_shared<Operation>(0, 0, 2, 1));
+    out.str("");
+    SolutionSerializer::writeJSON(empty, out);
+    EXPECT_EQ(out.str(), dumpDocument(*empty));
+}
+
+TEST_F(SolutionSerializerTest, StreamedJSONLoadsBack) {
+    SolutionSerializer::exportJSON(result, path);
+    auto loaded = Parser::loadJSONSolution(path);
+    EXPECT_EQ(loaded->makespan, result->makespan);
+    EXPECT_EQ(loaded->problem.getTotalOperations(), result->problem.getTotalOperations());
+    EXPECT_THROW(SolutionSerializer::exportJSON(result, "missing_dir/solution.json"), std::runtime_error);
+}
+
+TEST_F(SolutionSerializerTest, JSONLoaderRestoresSchedule) {
+    SolutionSerializer::exportJSON(result, path);
+    auto loaded = Parser::loadJSONSolution(path);
+
+    EXPECT_EQ(loaded->totalCompletionTime, result->totalCompletionTime);
+    EXPECT_DOUBLE_EQ(loaded->avgFlowTime, result->avgFlowTime);
+    ASSERT_EQ(loaded->problem.numJobs, result->problem.numJobs);
+    for (int j = 0; j < result->problem.numJobs; ++j) {
+        const auto& expected = result->problem.jobs[j]->operations;
+        const auto& actual = loaded->problem.jobs[j]->operations;
+        ASSERT_EQ(actual.size(), expected.size());
+        for (size_t k = 0; k < expected.size(); ++k) {
+            EXPECT_EQ(actual[k]->machineId, expected[k]->machineId);
+            EXPECT_EQ(actual[k]->operationId, expected[k]->operationId);
+            EXPECT_EQ(actual[k]->startTime, expected[k]->startTime);
+            EXPECT_EQ(actual[k]->endTime, expected[k]->endTime);
+        }
+    }
+    for (int m = 0; m < result->problem.numMachines; ++m) {
+        const auto& expected = result->problem.machines[m]->scheduledOperations;
+        const auto& actual = loaded->problem.machines[m]->scheduledOperations;
+        EXPECT_EQ(loaded->problem.machines[m]->availableTime, result->problem.machines[m]->availableTime);
+        ASSERT_EQ(actual.size(), expected.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            EXPECT_EQ(actual[i]->operationId, expected[i]->operationId);
+            // Machines share the operations of the jobs
+            bool shared = false;
+            for (const auto& operation : loaded->problem.getJob(actual[i]->jobId)->operations) {
+                shared = shared || operation == actual[i];
+            }
+            EXPECT_TRUE(shared);
+        }
+    }
+}
+
+TEST_F(SolutionSerializerTest, JSONLoaderAcceptsAnyKeyOrder) {
+    std::ofstream(path) << R"({
+        "problem": {"numMachines": 2, "numJobs": 2, "comment": {"nested": [1, 2, {"a": null}]}},
+        "operations": [
+            {"operationId": 0, "jobId": 0, "machineId": 1, "processingTime": 3, "startTime": 0, "endTime": 3},
+            {"operationId": 1, "jobId": 0, "machineId": 0, "processingTime": 2, "startTime": 0, "endTime": 0,
+             "scheduled": false, "tags": ["x"]},
+            {"operationId": 2, "jobId": 5, "machineId": 0, "processingTime": 2, "startTime": 0, "endTime": 0}
+        ],
+        "metrics": {"makespan": 5, "averageFlowTime": 5, "totalCompletionTime": 5},
+        "machines": [
+            {"scheduledOperations": [{"jobId": 0, "operationId": 1, "startTime": 3, "endTime": 5}],
+             "machineId": 0, "availableTime": 5},
+            {"machineId": 1, "availableTime": 3,
+             "scheduledOperations": [{"jobId": 0, "operationId": 0, "startTime": 0, "endTime": 3},
+                                     {"jobId": 1, "operationId": 7, "startTime": 0, "endTime": 1}]},
+            {"machineId": 9}
+        ]
+    })";
+    auto loaded = Parser::loadSolution(path);
+    ASSERT_EQ(loaded->problem.numJobs, 2);
+    ASSERT_EQ(loaded->problem.getJob(0)->operations.size(), 2u); // job 5 does not exist
+    EXPECT_EQ(loaded->problem.getJob(0)->getOperation(1)->startTime, 3);
+    EXPECT_EQ(loaded->problem.getJob(0)->getOperation(1)->endTime, 5);
+    EXPECT_EQ(loaded->problem.getMachine(0)->scheduledOperations[0], loaded->problem.getJob(0)->getOperation(1));
+    EXPECT_EQ(loaded->problem.getMachine(1)->scheduledOperations.size(), 1u); // unknown operation dropped
+    EXPECT_EQ(loaded->makespan, 5);
+    EXPECT_DOUBLE_EQ(loaded->avgFlowTime, 5.0);
+}
+
+TEST_F(SolutionSerializerTest, JSONLoaderRejectsBrokenFiles) {
+    std::ofstream(path) << R"({"problem": {"numJobs": 1, "numMachines": 1}, "operations": [)";
+    EXPECT_THROW(Parser::loadJSONSolution(path), std::runtime_error);
+
+    std::ofstream(path) << R"({"problem": {"numJobs": 1}, "metrics": {"makespan": 0, "totalCompletionTime": 0,
+                               "averageFlowTime": 0}})";
+    EXPECT_THROW(Parser::loadJSONSolution(path), std::runtime_error);
+
+    std::ofstream(path) << R"({"problem": {"numJobs": "one", "numMachines": 1}})";
+    EXPECT_THROW(Parser::loadJSONSolution(path), std::runtime_error);
+
+    std::ofstream(path) << "";
+    EXPECT_THROW(Parser::loadJSONSolution(path), std::runtime_error);
+    EXPECT_THROW(Parser::loadJSONSolution("missing.json"), std::runtime_error);
+}
+
+TEST_F(SolutionSerializerTest, BufferedTextAndXMLMatchStreamOutput) {
+    SolutionSerializer::exportText(result, path);
+    EXPECT_EQ(readFile(path), streamText(*result));
+    SolutionSerializer::exportXML(result, path);
+    EXPECT_EQ(readFile(path), streamXML(*result));
+
+    // Negative times and the %g forms of the flow time
+    result->problem.jobs[0]->operations[0]->setScheduled(-5, -1);
+    for (double flowTime : {0.0, 12.0, 896.375, 1.0 / 3.0, 1234567.0, 1e20, -2.5e-7}) {
+        result->avgFlowTime = flowTime;
+        std::ostringstream text;
+        SolutionSerializer::writeText(result, text);
+        EXPECT_EQ(text.str(), streamText(*result)) << flowTime;
+        std::ostringstream xml;
+        SolutionSerializer::writeXML(result, xml);
+        EXPECT_EQ(xml.str(), streamXML(*result)) << flowTime;
+    }
+}
+
+TEST_F(SolutionSerializerTest, XMLLoaderRestoresSchedule) {
+    SolutionSerializer::exportXML(result, path);
+    auto loaded = Parser::loadSolution(path);
+
+    EXPECT_EQ(loaded->makespan, result->makespan);
+    EXPECT_EQ(loaded->totalCompletionTime, result->totalCompletionTime);
+    EXPECT_NEAR(loaded->avgFlowTime, result->avgFlowTime, 1e-3);
+    ASSERT_EQ(loaded->problem.numJobs, result->problem.numJobs);
+    for (int j = 0; j < result->problem.numJobs; ++j) {
+        const auto& expected = result->problem.jobs[j]->operations;
+        const auto& actual = loaded->problem.jobs[j]->operations;
+        ASSERT_EQ(actual.size(), expected.size());
+        for (size_t k = 0; k < expected.size(); ++k) {
+            EXPECT_EQ(actual[k]->machineId, expected[k]->machineId);
+            EXPECT_EQ(actual[k]->processingTime, expected[k]->processingTime);
+            EXPECT_EQ(actual[k]->startTime, expected[k]->startTime);
+            EXPECT_EQ(actual[k]->endTime, expected[k]->endTime);
+        }
+    }
+    for (int m = 0; m < result->problem.numMachines; ++m) {
+        const auto& expected = result->problem.machines[m]->scheduledOperations;
+        const auto& actual = loaded->problem.machines[m]->scheduledOperations;
+        EXPECT_EQ(loaded->problem.machines[m]->availableTime, result->problem.machines[m]->availableTime);
+        ASSERT_EQ(actual.size(), expected.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            EXPECT_EQ(actual[i]->operationId, expected[i]->operationId);
+            EXPECT_EQ(actual[i]->jobId, expected[i]->jobId);
+        }
+    }
+}
+
+TEST_F(SolutionSerializerTest, XMLLoaderMatchesOperationsThroughIndex) {
+    // Job 0 lists its ids out of order, and the machine section comes first
+    std::ofstream(path) << R"(<?xml version="1.0" encoding="UTF-8"?>
+<jssp_solution>
+  <!-- <operation> inside a comment is ignored -->
+  <machines>
+    <machine>
+      <machineId>0</machineId>
+      <availableTime> 9 </availableTime>
+      <note kind="x"/>
+      <scheduledOperations>
+        <scheduledOperation><jobId>0</jobId><operationId>7</operationId><startTime>0</startTime><endTime>4</endTime></scheduledOperation>
+        <scheduledOperation><jobId>0</jobId><operationId>3</operationId><startTime>4</startTime><endTime>9</endTime></scheduledOperation>
+        <scheduledOperation><jobId>0</jobId><operationId>5</operationId><startTime>9</startTime><endTime>10</endTime></scheduledOperation>
+      </scheduledOperations>
+    </machine>
+  </machines>
+  <problem><numJobs>1</numJobs><numMachines>1</numMachines></problem>
+  <operations>
+    <operation><jobId>0</jobId><machineId>0</machineId><processingTime>4</processingTime><operationId>7</operationId></operation>
+    <operation><jobId>0</jobId><machineId>0</machineId><processingTime>5</processingTime><operationId>3</operationId></operation>
+  </operations>
+  <metrics><makespan>9</makespan><totalCompletionTime>9</totalCompletionTime><averageFlowTime>9.5</averageFlowTime></metrics>
+</jssp_solution>
+)";
+    auto loaded = Parser::loadXMLSolution(path);
+    const auto& scheduled = loaded->problem.getMachine(0)->scheduledOperations;
+    ASSERT_EQ(scheduled.size(), 2u); // operation 5 does not exist
+    EXPECT_EQ(scheduled[0], loaded->problem.getJob(0)->getOperation(0));
+    EXPECT_EQ(scheduled[1], loaded->problem.getJob(0)->getOperation(1));
+    EXPECT_EQ(scheduled[1]->startTime, 4);
+    EXPECT_EQ(loaded->problem.getMachine(0)->availableTime, 9);
+    EXPECT_DOUBLE_EQ(loaded->avgFlowTime, 9.5);
+}
+
+TEST_F(SolutionSerializerTest, XMLLoaderRejectsUnbalancedTags) {
+    std::ofstream(path) << "<?xml version=\"1.0\"?>\n<jssp_solution>\n  <problem><numJobs>1</numMachines>";
+    EXPECT_THROW(Parser::loadXMLSolution(path), std::runtime_error);
+
+    std::ofstream(path) << "<?xml version=\"1.0\"?>\n<jssp_solution>\n  <problem><numJobs>1</numJobs>";
+    EXPECT_THROW(Parser::loadXMLSolution(path), std::runtime_error);
+
+    std::ofstream(path) << "<?xml version=\"1.0\"?>\n<jssp_solution><problem";
+    EXPECT_THROW(Parser::loadXMLSolution(path), std::runtime_error);
+}
+
+TEST_F(SolutionSerializerTest, TextLoaderRestoresSchedule) {
+    SolutionSerializer::exportText(result, path);
+    auto loaded = Parser::loadSolution(path);
+
+    EXPECT_EQ(loaded->makespan, result->makespan);
+    EXPECT_EQ(loaded->totalCompletionTime, result->totalCompletionTime);
+    EXPECT_NEAR(loaded->avgFlowTime, result->avgFlowTime, 1e-3);
+    ASSERT_EQ(loaded->problem.numJobs, result->problem.numJobs);
+    for (int j = 0; j < result->problem.numJobs; ++j) {
+        const auto& expected = result->problem.jobs[j]->operations;
+        const auto& actual = loaded->problem.jobs[j]->operations;
+        ASSERT_EQ(actual.size(), expected.size());
+        for (size_t k = 0; k < expected.size(); ++k) {
+            EXPECT_EQ(actual[k]->operationId, expected[k]->operationId);
+            EXPECT_EQ(actual[k]->machineId, expected[k]->machineId);
+            EXPECT_EQ(actual[k]->startTime, expected[k]->startTime);
+            EXPECT_EQ(actual[k]->endTime, expected[k]->endTime);
+        }
+    }
+    for (int m = 0; m < result->problem.numMachines; ++m) {
+        const auto& expected = result->problem.machines[m]->scheduledOperations;
+        const auto& actual = loaded->problem.machines[m]->scheduledOperations;
+        ASSERT_EQ(actual.size(), expected.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            EXPECT_EQ(actual[i]->jobId, expected[i]->jobId);
+            EXPECT_EQ(actual[i]->operationId, expected[i]->operationId);
+            EXPECT_EQ(actual[i]->startTime, expected[i]->startTime);
+        }
+    }
+}
+
+TEST_F(SolutionSerializerTest, TextLoaderSkipsMalformedLines) {
+    std::ofstream(path) << "JSSP SOLUTION EXPORT\r\n"
+                           "===================\r\n\r\n"
+                           "PROBLEM METADATA:\r\n"
+                           "Jobs: 2\r\n"
+                           "Machines: 1\r\n\r\n"
+                           "SCHEDULING RESULTS:\r\n\r\n"
+                           "Job 0:\r\n"
+                           "  Operation 4: Machine 0 [-5--1]\r\n"
+                           "  Operation x: Machine 0 [1-2]\r\n"
+                           "  Operation 6: Machine 0 [1-3]\r\n\r\n"
+                           "Job 9:\r\n"
+                           "  Operation 1: Machine 0 [0-1]\r\n\r\n"
+                           "MACHINE SCHEDULES:\r\n\r\n"
+                           "Machine 0:\r\n"
+                           "  Job 0 Operation 4 [-5--1]\r\n"
+                           "  Job 0 Operation 6 [1-3\r\n\r\n"
+                           "PERFORMANCE METRICS:\r\n"
+                           "Makespan: 3\r\n"
+                           "Average Flow Time: 2.25";
+    auto loaded = Parser::loadSolution(path);
+
+    const auto& operations = loaded->problem.getJob(0)->operations;
+    ASSERT_EQ(operations.size(), 2u);
+    EXPECT_EQ(operations[0]->startTime, -5);
+    EXPECT_EQ(operations[0]->processingTime, 4);
+    EXPECT_EQ(operations[1]->operationId, 6);
+    EXPECT_TRUE(loaded->problem.getJob(1)->operations.empty());
+    ASSERT_EQ(loaded->problem.getMachine(0)->scheduledOperations.size(), 1u);
+    EXPECT_EQ(loaded->problem.getMachine(0)->availableTime, -1);
+    EXPECT_EQ(loaded->makespan, 3);
+    EXPECT_EQ(loaded->totalCompletionTime, 0);
+    EXPECT_DOUBLE_EQ(loaded->avgFlowTime, 2.25);
+
+    std::ofstream(path) << "not a solution\n";
+    EXPECT_THROW(Parser::loadSolution(path), std::runtime_error);
+    EXPECT_THROW(Parser::loadSolution("missing.txt"), std::runtime_error);
+}
@@ -107,11 +107,25 @@ TEST_F(SolverTest, CreateLPTSolver) {
     EXPECT_EQ(solver->getAlgorithm(), SchedulingAlgorithm::LPT);
 }
 
+TEST_F(SolverTest, CreateLNSSolver) {
+    auto solver = Solver::createLNSSolver();
+    ASSERT_NE(solver, nullptr);
+    EXPECT_EQ(solver->getAlgorithm(), SchedulingAlgorithm::LNS);
+}
+
+TEST_F(SolverTest, CreateIslandSolver) {
+    auto solver = Solver::createIslandSolver();
+    ASSERT_NE(solver, nullptr);
+    EXPECT_EQ(solver->getAlgorithm(), SchedulingAlgorithm::ISLANDS);
+}
+
 // Algorithm name tests
 TEST_F(SolverTest, GetAlgorithmName) {
     EXPECT_EQ(Solver::getAlgorithmName(SchedulingAlgorithm::FIFO), "FIFO (First-In-First-Out)");
     EXPECT_EQ(Solver::getAlgorithmName(SchedulingAlgorithm::SPT), "SPT (Shortest Processing Time)");
     EXPECT_EQ(Solver::getAlgorithmName(SchedulingAlgorithm::LPT), "LPT (Longest Processing Time)");
+    EXPECT_EQ(Solver::getAlgorithmName(SchedulingAlgorithm::LNS), "LNS (Large Neighborhood Search)");
+    EXPECT_EQ(Solver::getAlgorithmName(SchedulingAlgorithm::ISLANDS), "Island LNS (Multi-Process)");
 }
 
 TEST_F(SolverTest, GetCurrentAlgorithmName) {
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <memory>
+#include <string>
+#include "text_batch.hpp"
+
+class TextBatchTest : public ::testing::Test {
+protected:
+    /**
+     * SetUp method for test fixture.
+     */
+    void SetUp() override {
+        if (!font.loadFromFile("/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf")) {
+            GTEST_SKIP() << "DejaVuSans.ttf not available";
+        }
+        batch = std::make_unique<TextBatch>(font);
+    }
+
+    sf::Font font;
+    std::unique_ptr<TextBatch> batch;
+};
+
+TEST_F(TextBatchTest, BoundsMatchText) {
+    for (unsigned size : {10u, 14u}) {
+        for (const char* label : {"J12 Op3", "M7", "100", "Makespan: 42"}) {
+            sf::Text text(label, font, size);
+            sf::FloatRect expected = text.getLocalBounds();
+            sf::FloatRect actual = batch->getLocalBounds(label, size);
+            EXPECT_FLOAT_EQ(actual.left, expected.left) << label;
+            EXPECT_FLOAT_EQ(actual.top, expected.top) << label;
+            EXPECT_FLOAT_EQ(actual.width, expected.width) << label;
+            EXPECT_FLOAT_EQ(actual.height, expected.height) << label;
+        }
+    }
+}
+
+TEST_F(TextBatchTest, CachesLayoutsPerSize) {
+    // Blanks take no quad
+    batch->add("J1 Op2", 10, sf::Vector2f(0, 0), sf::Color::Black);
+    EXPECT_EQ(batch->getGlyphCount(), 5u);
+    EXPECT_EQ(batch->getLayoutCount(), 1u);
+
+    // The same string reuses its layout; another size lays it out again
+    batch->add("J1 Op2", 10, sf::Vector2f(50, 0), sf::Color::Red);
+    EXPECT_EQ(batch->getLayoutCount(), 1u);
+    batch->add("J1 Op2", 12, sf::Vector2f(0, 20), sf::Color::Black);
+    EXPECT_EQ(batch->getLayoutCount(), 2u);
+    EXPECT_EQ(batch->getGlyphCount(), 15u);
+
+    // Clearing drops the labels but keeps the layouts
+    batch->clear();
+    EXPECT_EQ(batch->getGlyphCount(), 0u);
+    EXPECT_EQ(batch->getLayoutCount(), 2u);
+}
+
+TEST_F(TextBatchTest, BoundsTheLayoutCache) {
+    for (size_t i = 0; i <= TextBatch::MAX_LAYOUTS; ++i) {
+        batch->add(std::to_string(i), 10, sf::Vector2f(0, 0), sf::Color::Black);
+    }
+    EXPECT_EQ(batch->getLayoutCount(), 1u);
+}
+
+TEST_F(TextBatchTest, DrawsLikeText) {
+    sf::RenderTexture target;
+    ASSERT_TRUE(target.create(60, 30));
+
+    // A centered label covers the same pixels as an sf::Text moved back by half its size
+    sf::Text text("M12", font, 14);
+    sf::FloatRect bounds = text.getLocalBounds();
+    text.setPosition(std::round(30 - bounds.width / 2), std::round(15 - bounds.height / 2));
+    text.setFillColor(sf::Color::White);
+    target.clear(sf::Color::Black);
+    target.draw(text);
+    target.display();
+    sf::Image expected = target.getTexture().copyToImage();
+
+    batch->add("M12", 14, sf::Vector2f(30, 15), sf::Color::White, sf::Vector2f(0.5f, 0.5f));
+    target.clear(sf::Color::Black);
+    batch->draw(target);
+    target.display();
+    sf::Image actual = target.getTexture().copyToImage();
+
+    int lit = 0;
+    for (unsigned y = 0; y < 30; ++y) {
+        for (unsigned x = 0; x < 60; ++x) {
+            EXPECT_EQ(actual.getPixel(x, y), expected.getPixel(x, y)) << x << "," << y;
+            lit += expected.getPixel(x, y) != sf::Color::Black;
+        }
+    }
+    EXPECT_GT(lit, 0);
+}
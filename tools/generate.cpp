@@ -0,0 +1,105 @@
+#include "instance_generator.hpp"
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+/**
+ * Prints the command line usage.
+ */
+void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options] -o <instance.jssp>\n"
+              << "Writes a random instance in .jssp format without holding it in memory.\n\n"
+              << "Options:\n"
+              << "  -o, --output FILE        instance file to write\n"
+              << "  -j, --jobs N             jobs (default: 10)\n"
+              << "  -m, --machines N         machines (default: 5)\n"
+              << "  --ops-per-job N          operations per job, 0 for one per machine (default: 0)\n"
+              << "  --durations NAME         uniform, normal or exponential (default: uniform)\n"
+              << "  --min N                  shortest processing time (default: 1)\n"
+              << "  --max N                  longest processing time (default: 99)\n"
+              << "  --routing NAME           random, flow or bottleneck (default: random)\n"
+              << "  --bottlenecks N          bottleneck machines (default: 1)\n"
+              << "  --bottleneck-share X     share of operations on them (default: 0.5)\n"
+              << "  --seed N                 random seed (default: 1)\n";
+}
+
+DurationDistribution parseDurations(const std::string& name) {
+    if (name == "uniform") return DurationDistribution::UNIFORM;
+    if (name == "normal") return DurationDistribution::NORMAL;
+    if (name == "exponential") return DurationDistribution::EXPONENTIAL;
+    throw std::invalid_argument("Unknown duration distribution: " + name);
+}
+
+RoutingModel parseRouting(const std::string& name) {
+    if (name == "random") return RoutingModel::RANDOM_PERMUTATION;
+    if (name == "flow") return RoutingModel::FLOW;
+    if (name == "bottleneck") return RoutingModel::BOTTLENECK;
+    throw std::invalid_argument("Unknown routing model: " + name);
+}
+
+} // namespace
+
+/**
+ * Entry point of the instance generator tool.
+ *
+ * Returns:
+ *   0 on success, 1 on error.
+ */
+int main(int argc, char** argv) {
+    try {
+        GeneratorConfig config;
+        std::string output;
+
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            auto value = [&]() -> std::string {
+                if (i + 1 >= argc) throw std::invalid_argument("Missing value for " + arg);
+                return argv[++i];
+            };
+            if (arg == "-h" || arg == "--help") {
+                printUsage(argv[0]);
+                return 0;
+            } else if (arg == "-o" || arg == "--output") {
+                output = value();
+            } else if (arg == "-j" || arg == "--jobs") {
+                config.jobs = std::stoi(value());
+            } else if (arg == "-m" || arg == "--machines") {
+                config.machines = std::stoi(value());
+            } else if (arg == "--ops-per-job") {
+                config.operationsPerJob = std::stoi(value());
+            } else if (arg == "--durations") {
+                config.durations = parseDurations(value());
+            } else if (arg == "--min") {
+                config.minDuration = std::stoi(value());
+            } else if (arg == "--max") {
+                config.maxDuration = std::stoi(value());
+            } else if (arg == "--routing") {
+                config.routing = parseRouting(value());
+            } else if (arg == "--bottlenecks") {
+                config.bottlenecks = std::stoi(value());
+            } else if (arg == "--bottleneck-share") {
+                config.bottleneckShare = std::stod(value());
+            } else if (arg == "--seed") {
+                config.seed = std::stoull(value());
+            } else {
+                throw std::invalid_argument("Unknown option: " + arg);
+            }
+        }
+        if (output.empty()) {
+            printUsage(argv[0]);
+            return 1;
+        }
+
+        auto begin = std::chrono::steady_clock::now();
+        size_t operations = InstanceGenerator(config).writeFile(output);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        std::cout << "Wrote " << operations << " operations to " << output << " in " << seconds << " s" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,96 @@
+#include "instance_loader.hpp"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+/**
+ * Prints the command line usage.
+ */
+void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options] <directory>\n"
+              << "Parses every .jssp and .jsspb file below a directory in parallel and reports per-file stats.\n\n"
+              << "Options:\n"
+              << "  -t, --threads N       parse threads, 0 for all cores (default: 0)\n"
+              << "  -q, --quiet           print only the totals and failures\n";
+}
+
+} // namespace
+
+/**
+ * Entry point of the instance ingestion tool.
+ *
+ * Returns:
+ *   0 if every file was loaded, 1 otherwise.
+ */
+int main(int argc, char** argv) {
+    try {
+        int threads = 0;
+        bool quiet = false;
+        std::string directory;
+
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            auto value = [&]() -> std::string {
+                if (i + 1 >= argc) throw std::invalid_argument("Missing value for " + arg);
+                return argv[++i];
+            };
+            if (arg == "-h" || arg == "--help") {
+                printUsage(argv[0]);
+                return 0;
+            } else if (arg == "-t" || arg == "--threads") {
+                threads = std::stoi(value());
+            } else if (arg == "-q" || arg == "--quiet") {
+                quiet = true;
+            } else if (!arg.empty() && arg[0] == '-') {
+                throw std::invalid_argument("Unknown option: " + arg);
+            } else {
+                directory = arg;
+            }
+        }
+        if (directory.empty()) {
+            printUsage(argv[0]);
+            return 1;
+        }
+
+        auto begin = std::chrono::steady_clock::now();
+        std::vector<InstanceFile> files = InstanceLoader::loadDirectory(directory, threads);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+        size_t failed = 0, operations = 0, skipped = 0;
+        uintmax_t bytes = 0;
+        for (const auto& file : files) {
+            bytes += file.bytes;
+            if (!file.ok()) {
+                failed++;
+                std::cerr << file.path << ": " << file.error << std::endl;
+                continue;
+            }
+            operations += file.report.operations;
+            skipped += file.report.skipped;
+            if (!quiet) {
+                std::cout << file.path << ": " << file.problem->numJobs << " jobs, " << file.problem->numMachines
+                          << " machines, " << file.report.operations << " operations";
+                if (!file.report.ok()) {
+                    std::cout << ", " << file.report.skipped << " lines skipped";
+                }
+                std::cout << ", " << file.bytes << " bytes in " << std::fixed << std::setprecision(3)
+                          << file.seconds * 1000.0 << " ms" << std::defaultfloat << std::endl;
+            }
+        }
+
+        double megabytes = static_cast<double>(bytes) / (1024.0 * 1024.0);
+        std::cout << "Loaded " << files.size() - failed << " of " << files.size() << " files, " << operations
+                  << " operations, " << skipped << " lines skipped, " << std::fixed << std::setprecision(1)
+                  << megabytes << " MB in " << std::setprecision(3) << seconds << " s ("
+                  << std::setprecision(1) << (seconds > 0.0 ? megabytes / seconds : 0.0) << " MB/s)" << std::endl;
+        return failed == 0 ? 0 : 1;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,144 @@
+#include "instance_loader.hpp"
+#include "instance_pack.hpp"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+const size_t BATCH_SIZE = 256; // files parsed at once, to bound memory
+
+/**
+ * Prints the command line usage.
+ */
+void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options] -o <pack.jsspk> <instance | directory>...\n"
+              << "       " << program << " --list <pack.jsspk>\n"
+              << "Packs instance files into one .jsspk file, or lists and verifies a pack.\n\n"
+              << "Options:\n"
+              << "  -o, --output FILE     pack file to write\n"
+              << "  -l, --list FILE       list the instances of a pack and verify them\n"
+              << "  -t, --threads N       parse threads, 0 for all cores (default: 0)\n";
+}
+
+/**
+ * Adds a file, or every instance file below a directory. Entries are named
+ * by their path relative to the directory they were found in.
+ */
+void collectInstances(const std::string& path, std::vector<std::pair<std::string, std::string>>& files) {
+    namespace fs = std::filesystem;
+    if (!fs::is_directory(path)) {
+        files.emplace_back(path, fs::path(path).filename().string());
+        return;
+    }
+    for (const auto& found : InstanceLoader::discover(path)) {
+        files.emplace_back(found, fs::relative(found, path).generic_string());
+    }
+}
+
+/**
+ * Prints the index of a pack and checks every instance.
+ *
+ * Returns:
+ *   0 if every instance is valid, 1 otherwise.
+ */
+int listPack(const std::string& filename) {
+    InstancePack pack(filename);
+    size_t invalid = 0;
+    for (size_t i = 0; i < pack.size(); ++i) {
+        const PackEntry& entry = pack.entry(i);
+        std::cout << entry.name << ": " << entry.numJobs << " jobs, " << entry.numMachines << " machines, "
+                  << entry.numOperations << " operations, " << entry.size << " bytes";
+        try {
+            pack.flat(i, true);
+        } catch (const std::exception& e) {
+            invalid++;
+            std::cout << " INVALID (" << e.what() << ")";
+        }
+        std::cout << std::endl;
+    }
+    std::cout << pack.size() << " instances, " << invalid << " invalid" << std::endl;
+    return invalid == 0 ? 0 : 1;
+}
+
+} // namespace
+
+/**
+ * Entry point of the instance packing tool.
+ *
+ * Returns:
+ *   0 on success, 1 on error.
+ */
+int main(int argc, char** argv) {
+    try {
+        int threads = 0;
+        std::string output;
+        std::string list;
+        std::vector<std::pair<std::string, std::string>> files; // path, entry name
+
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            auto value = [&]() -> std::string {
+                if (i + 1 >= argc) throw std::invalid_argument("Missing value for " + arg);
+                return argv[++i];
+            };
+            if (arg == "-h" || arg == "--help") {
+                printUsage(argv[0]);
+                return 0;
+            } else if (arg == "-o" || arg == "--output") {
+                output = value();
+            } else if (arg == "-l" || arg == "--list") {
+                list = value();
+            } else if (arg == "-t" || arg == "--threads") {
+                threads = std::stoi(value());
+            } else if (!arg.empty() && arg[0] == '-') {
+                throw std::invalid_argument("Unknown option: " + arg);
+            } else {
+                collectInstances(arg, files);
+            }
+        }
+        if (!list.empty()) {
+            return listPack(list);
+        }
+        if (output.empty() || files.empty()) {
+            printUsage(argv[0]);
+            return 1;
+        }
+
+        auto begin = std::chrono::steady_clock::now();
+        InstancePackWriter writer(output);
+        size_t operations = 0;
+        for (size_t first = 0; first < files.size(); first += BATCH_SIZE) {
+            size_t last = std::min(files.size(), first + BATCH_SIZE);
+            std::vector<std::string> paths;
+            for (size_t i = first; i < last; ++i) {
+                paths.push_back(files[i].first);
+            }
+            std::vector<InstanceFile> loaded = InstanceLoader::loadFiles(paths, threads);
+            for (size_t i = 0; i < loaded.size(); ++i) {
+                if (!loaded[i].ok()) {
+                    throw std::runtime_error(loaded[i].path + ": " + loaded[i].error);
+                }
+                if (!loaded[i].report.ok()) {
+                    std::cerr << "Warning: " << loaded[i].path << ": skipped " << loaded[i].report.skipped
+                              << " invalid line(s)" << std::endl;
+                }
+                writer.add(files[first + i].second, *loaded[i].problem);
+                operations += loaded[i].report.operations;
+            }
+        }
+        writer.finish();
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        std::cout << "Packed " << writer.size() << " instances (" << operations << " operations) into " << output
+                  << " in " << seconds << " s" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,133 @@
+#include "instance_loader.hpp"
+#include "parameter_tuner.hpp"
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+/**
+ * Prints the command line usage.
+ */
+void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options] <instance.jssp | directory>...\n"
+              << "Races LNS configurations on the training instances and writes the winner.\n\n"
+              << "Options:\n"
+              << "  -o, --output FILE     config file to write (default: tuned.cfg)\n"
+              << "  --base FILE           config with the starting values and untuned keys\n"
+              << "  --iterations N        LNS iterations per engine run (default: base lns_iterations)\n"
+              << "  --candidates N        configurations per race (default: 24)\n"
+              << "  --races N             iterated races (default: 3)\n"
+              << "  --blocks N            instance/seed blocks per race at most (default: 40)\n"
+              << "  --first-test N        blocks before the first elimination (default: 5)\n"
+              << "  --budget N            total engine runs, 0 for no limit (default: 0)\n"
+              << "  --alpha X             significance level (default: 0.05)\n"
+              << "  --threads N           parallel engine runs, 0 for all cores (default: 0)\n"
+              << "  --seed N              random seed (default: 1)\n";
+}
+
+/**
+ * Adds a training file, or every instance file below a directory.
+ */
+void collectInstances(const std::string& path, std::vector<std::string>& files) {
+    if (!std::filesystem::is_directory(path)) {
+        files.push_back(path);
+        return;
+    }
+    std::vector<std::string> found = InstanceLoader::discover(path);
+    files.insert(files.end(), found.begin(), found.end());
+}
+
+} // namespace
+
+/**
+ * Entry point of the offline tuning tool.
+ *
+ * Returns:
+ *   0 on success, 1 on error.
+ */
+int main(int argc, char** argv) {
+    try {
+        RaceSettings settings;
+        settings.verbose = true;
+        SolverConfig base;
+        int iterations = -1;
+        std::string output = "tuned.cfg";
+        std::vector<std::string> files;
+
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            auto value = [&]() -> std::string {
+                if (i + 1 >= argc) throw std::invalid_argument("Missing value for " + arg);
+                return argv[++i];
+            };
+            if (arg == "-h" || arg == "--help") {
+                printUsage(argv[0]);
+                return 0;
+            } else if (arg == "-o" || arg == "--output") {
+                output = value();
+            } else if (arg == "--base") {
+                base = SolverConfig::loadFromFile(value());
+            } else if (arg == "--iterations") {
+                iterations = std::stoi(value());
+            } else if (arg == "--candidates") {
+                settings.candidates = std::stoi(value());
+            } else if (arg == "--races") {
+                settings.races = std::stoi(value());
+            } else if (arg == "--blocks") {
+                settings.maxBlocks = std::stoi(value());
+            } else if (arg == "--first-test") {
+                settings.firstTest = std::stoi(value());
+            } else if (arg == "--budget") {
+                settings.budget = std::stol(value());
+            } else if (arg == "--alpha") {
+                settings.alpha = std::stod(value());
+            } else if (arg == "--threads") {
+                settings.threads = std::stoi(value());
+            } else if (arg == "--seed") {
+                settings.seed = std::stoull(value());
+            } else if (!arg.empty() && arg[0] == '-') {
+                throw std::invalid_argument("Unknown option: " + arg);
+            } else {
+                collectInstances(arg, files);
+            }
+        }
+        if (iterations >= 0) {
+            base.setValue("lns_iterations", iterations);
+        }
+        if (files.empty()) {
+            printUsage(argv[0]);
+            return 1;
+        }
+
+        std::vector<std::shared_ptr<ProblemInstance>> training;
+        for (const auto& file : InstanceLoader::loadFiles(files, settings.threads)) {
+            if (!file.ok()) {
+                throw std::runtime_error(file.path + ": " + file.error);
+            }
+            training.push_back(file.problem);
+        }
+        std::cout << "Tuning on " << training.size() << " instances" << std::endl;
+
+        auto begin = std::chrono::steady_clock::now();
+        ParameterTuner tuner(training, settings);
+        RaceResult result = tuner.tune(base, ParameterTuner::getDefaultRanges());
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+        SolverConfig best = result.best;
+        best.lns.threads = base.lns.threads;
+        best.lns.seed = base.lns.seed;
+        best.saveToFile(output);
+
+        std::cout << "Ran " << result.evaluations << " engine runs on " << result.blocks << " blocks in "
+                  << seconds << " s" << std::endl;
+        std::cout << "Best configuration written to " << output << ":\n" << best.toString();
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -7,7 +7,96 @@
 #include <memory>
 #include <string>
 #include <array>
+#include <algorithm>
+#include <chrono>
+#include <climits>
 #include <cmath>
+#include <unordered_map>
+#include <utility>
+
+namespace {
+
+// Deep-copies a result for a background export. Machine schedules are
+// remapped to the copied job operations, so the copy shares nothing with
+// the original and later solves or loads cannot change it mid-export.
+std::shared_ptr<ScheduleResult> snapshotResult(const ScheduleResult& result) {
+    auto snapshot = std::make_shared<ScheduleResult>();
+    snapshot->makespan = result.makespan;
+    snapshot->totalCompletionTime = result.totalCompletionTime;
+    snapshot->avgFlowTime = result.avgFlowTime;
+
+    ProblemInstance& problem = snapshot->problem;
+    problem.numJobs = result.problem.numJobs;
+    problem.numMachines = result.problem.numMachines;
+    std::unordered_map<const Operation*, std::shared_ptr<Operation>> operations;
+    std::unordered_map<const Job*, std::shared_ptr<Job>> jobs;
+    operations.reserve(result.problem.getTotalOperations());
+    for (const auto& job : result.problem.jobs) {
+        auto copy = std::make_shared<Job>(job->jobId);
+        copy->operations.reserve(job->operations.size());
+        for (const auto& operation : job->operations) {
+            auto operationCopy = std::make_shared<Operation>(*operation);
+            operations.emplace(operation.get(), operationCopy);
+            copy->operations.push_back(std::move(operationCopy));
+        }
+        jobs.emplace(job.get(), copy);
+        problem.jobs.push_back(std::move(copy));
+    }
+    for (const auto& machine : result.problem.machines) {
+        auto copy = std::make_shared<Machine>(machine->machineId);
+        copy->availableTime = machine->availableTime;
+        copy->scheduledOperations.reserve(machine->scheduledOperations.size());
+        for (const auto& operation : machine->scheduledOperations) {
+            auto found = operations.find(operation.get());
+            copy->scheduledOperations.push_back(found != operations.end() ? found->second
+                                                                          : std::make_shared<Operation>(*operation));
+        }
+        problem.machines.push_back(std::move(copy));
+    }
+    for (const auto& job : result.scheduledJobs) {
+        auto found = jobs.find(job.get());
+        snapshot->scheduledJobs.push_back(found != jobs.end() ? found->second : std::make_shared<Job>(*job));
+    }
+    return snapshot;
+}
+
+// Seconds elapsed since begin, for export progress messages.
+std::string secondsSince(std::chrono::steady_clock::time_point begin) {
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    char text[32];
+    std::snprintf(text, sizeof(text), "%.2f s", seconds);
+    return text;
+}
+
+// Pastel color of a job in the Gantt chart.
+sf::Color jobColor(int jobId) {
+    float hue = (jobId * 137.508f);
+    hue = fmod(hue, 360.0f);
+    
+    float s = 0.6f;
+    float v = 0.85f;
+    float c = v * s;
+    float x = c * (1 - std::abs(fmod(hue / 60.0f, 2) - 1));
+    float m = v - c;
+    float r=0, g=0, b=0;
+    
+    if(hue < 60) { r=c; g=x; b=0; }
+    else if(hue < 120) { r=x; g=c; b=0; }
+    else if(hue < 180) { r=0; g=c; b=x; }
+    else if(hue < 240) { r=0; g=x; b=c; }
+    else if(hue < 300) { r=x; g=0; b=c; }
+    else { r=c; g=0; b=x; }
+    
+    return sf::Color((r+m)*255, (g+m)*255, (b+m)*255);
+}
+
+// End of the viewer's time axis: the makespan plus 5% padding.
+long long viewLimit(const BinarySolutionView& view) {
+    long long makespan = view.getMakespan();
+    return std::min<long long>(INT_MAX, makespan + std::max(1LL, makespan / 20));
+}
+
+} // namespace
 
 // BaseUI constructor: Initializes the UI with default settings, loads font, sets up layout, and logs welcome messages.
 BaseUI::BaseUI() : currentView(ViewMode::Output), selectedAlgo(SchedulingAlgorithm::FIFO), fileScrollOffset(0), dropdownOpen(false) {
@@ -22,8 +111,10 @@ BaseUI::BaseUI() : currentView(ViewMode::Output), selectedAlgo(SchedulingAlgorit
     logToConsole("Select a file and algorithm from the sidebar, then click 'Solve'.");
 }
 
-// BaseUI destructor: Default cleanup.
-BaseUI::~BaseUI() {}
+// BaseUI destructor: Finishes queued exports before the window goes away.
+BaseUI::~BaseUI() {
+    exportQueue.reset();
+}
 
 // Load font from common system paths. Returns true if successful.
 bool BaseUI::loadFont() {
@@ -210,12 +301,14 @@ void BaseUI::initLayout() {
     float currentY = startY;
     
     // Algorithms section at fixed bottom
-    float bottomSectionY = 500;
+    float bottomSectionY = 460;
     
     std::vector<std::pair<std::string, SchedulingAlgorithm>> algos = {
         {"FIFO", SchedulingAlgorithm::FIFO},
         {"SPT", SchedulingAlgorithm::SPT},
-        {"LPT", SchedulingAlgorithm::LPT}
+        {"LPT", SchedulingAlgorithm::LPT},
+        {"LNS", SchedulingAlgorithm::LNS},
+        {"Islands", SchedulingAlgorithm::ISLANDS}
     };
     
     float algoY = bottomSectionY;
@@ -329,6 +422,35 @@ void BaseUI::handleInput() {
             }
         }
         
+        // Viewer mode: the wheel zooms at the cursor, arrow keys pan
+        if (solutionView && currentView == ViewMode::GanttChart) {
+            if (event.type == sf::Event::MouseWheelScrolled &&
+                viewArea.contains(event.mouseWheelScroll.x, event.mouseWheelScroll.y)) {
+                double anchor = (event.mouseWheelScroll.x - viewArea.left) / viewArea.width;
+                zoomSolutionView(event.mouseWheelScroll.delta > 0 ? 0.8 : 1.25, anchor);
+            }
+            if (event.type == sf::Event::KeyPressed) {
+                switch (event.key.code) {
+                    case sf::Keyboard::Left: panSolutionView(-0.2, 0); break;
+                    case sf::Keyboard::Right: panSolutionView(0.2, 0); break;
+                    case sf::Keyboard::Up: panSolutionView(0, -1); break;
+                    case sf::Keyboard::Down: panSolutionView(0, 1); break;
+                    case sf::Keyboard::PageUp: panSolutionView(0, -10); break;
+                    case sf::Keyboard::PageDown: panSolutionView(0, 10); break;
+                    case sf::Keyboard::Add:
+                    case sf::Keyboard::Equal: zoomSolutionView(0.5, 0.5); break;
+                    case sf::Keyboard::Subtract:
+                    case sf::Keyboard::Hyphen: zoomSolutionView(2.0, 0.5); break;
+                    case sf::Keyboard::Home:
+                        viewFrom = 0;
+                        viewTo = viewLimit(*solutionView);
+                        viewFirstMachine = 0;
+                        break;
+                    default: break;
+                }
+            }
+        }
+        
         // Handle window resize
         if (event.type == sf::Event::Resized) {
             sf::FloatRect visibleArea(0, 0, event.size.width, event.size.height);
@@ -375,6 +497,7 @@ void BaseUI::update(sf::Vector2f mousePos) {
     updateBtn(fileButtons, true);
     updateBtn(algoButtons);
     updateBtn(navButtons);
+    drainExportLog();
 }
 
 // Draw the entire UI.
@@ -413,6 +536,10 @@ void BaseUI::drawHeader() {
         window.draw(subtitle);
         
         std::string status = "File: " + (selectedFile.empty() ? "None" : selectedFile);
+        int pending = exportsPending.load();
+        if (pending > 0) {
+            status = "Exporting (" + std::to_string(pending) + ")  |  " + status;
+        }
         sf::Text statusText(status, font, 14);
         // Right-align
         sf::FloatRect bounds = statusText.getLocalBounds();
@@ -463,7 +590,9 @@ void BaseUI::drawSidebar() {
     for (auto& b : algoButtons) {
         b.isSelected = (selectedAlgo == SchedulingAlgorithm::FIFO && b.text.getString() == "FIFO") ||
                        (selectedAlgo == SchedulingAlgorithm::SPT && b.text.getString() == "SPT") ||
-                       (selectedAlgo == SchedulingAlgorithm::LPT && b.text.getString() == "LPT");
+                       (selectedAlgo == SchedulingAlgorithm::LPT && b.text.getString() == "LPT") ||
+                       (selectedAlgo == SchedulingAlgorithm::LNS && b.text.getString() == "LNS") ||
+                       (selectedAlgo == SchedulingAlgorithm::ISLANDS && b.text.getString() == "Islands");
         window.draw(b.shape);
         window.draw(b.text);
     }
@@ -535,6 +664,10 @@ void BaseUI::drawConsole() {
 
 // Draw Gantt chart in main area.
 void BaseUI::drawGanttInMain() {
+    if (solutionView) {
+        drawSolutionView();
+        return;
+    }
     if (!currentResult) {
         if (fontLoaded) {
             sf::Text msg("No results to display.", font, 24);
@@ -567,115 +700,222 @@ void BaseUI::drawGanttInMain() {
     // Time scale
     int maxTime = currentResult->makespan;
     float timeScale = availableWidth / (maxTime * 1.05f); // 5% padding
-    
-    // Time axis
-    sf::RectangleShape axisLine({availableWidth, 1});
-    axisLine.setPosition(startX, startY - 10);
-    axisLine.setFillColor(sf::Color(100, 100, 100));
-    window.draw(axisLine);
-    
-    // Grid and labels
     int timeStep = std::max(1, maxTime / 10);
-    for (int t = 0; t <= maxTime; t += timeStep) {
-        float x = startX + t * timeScale;
-        
-        sf::RectangleShape gridLine({1, availableHeight});
-        gridLine.setPosition(x, startY - 10);
-        gridLine.setFillColor(sf::Color(30, 30, 30));
-        window.draw(gridLine);
+    
+    // Rebuild the geometry and labels only for a new result or window size
+    if (ganttBatchResult.expired() || ganttBatchResult.lock() != currentResult || ganttBatchSize != window.getSize()) {
+        ganttBatch.clear();
+        ganttText.clear();
         
-        if (fontLoaded) {
-            sf::Text label(std::to_string(t), font, 10);
-            label.setOrigin(label.getLocalBounds().width/2, 0);
-            label.setPosition(x, startY - 25);
-            label.setFillColor(sf::Color(150, 150, 150));
-            window.draw(label);
+        // Time axis, grid and labels
+        ganttBatch.addBackground(sf::FloatRect(startX, startY - 10, availableWidth, 1), sf::Color(100, 100, 100));
+        for (int t = 0; t <= maxTime; t += timeStep) {
+            float x = startX + t * timeScale;
+            ganttBatch.addBackground(sf::FloatRect(x, startY - 10, 1, availableHeight), sf::Color(30, 30, 30));
+            if (fontLoaded) {
+                ganttText.add(std::to_string(t), 10, {x, startY - 25}, sf::Color(150, 150, 150), {0.5f, 0});
+            }
         }
-    }
-    
-    // Machine tracks
-    for (int i = 0; i < numMachines; ++i) {
-        float y = startY + i * (machineHeight + gap);
         
-        if (fontLoaded) {
-            sf::Text mText("M" + std::to_string(i), font, 14);
-            mText.setOrigin(mText.getLocalBounds().width, mText.getLocalBounds().height/2);
-            mText.setPosition(startX - 15, y + machineHeight/2);
-            mText.setFillColor(colorTextMain);
-            window.draw(mText);
+        // Machine tracks and labels
+        for (int i = 0; i < numMachines; ++i) {
+            sf::FloatRect track(startX, startY + i * (machineHeight + gap), availableWidth, machineHeight);
+            ganttBatch.addBackground(track, sf::Color(25, 25, 28));
+            ganttBatch.addFrame(track, sf::Color(40, 40, 40));
+            if (fontLoaded) {
+                ganttText.add("M" + std::to_string(i), 14, {startX - 15, track.top + machineHeight/2}, colorTextMain, {1, 0.5f});
+            }
         }
         
-        sf::RectangleShape track({availableWidth, machineHeight});
-        track.setPosition(startX, y);
-        track.setFillColor(sf::Color(25, 25, 28));
-        track.setOutlineColor(sf::Color(40, 40, 40));
-        track.setOutlineThickness(1);
-        window.draw(track);
-    }
-    
-    // Operations
-    for (const auto& job : currentResult->problem.jobs) {
-        // Pastel color per job
-        float hue = (job->jobId * 137.508f);
-        hue = fmod(hue, 360.0f);
+        // Operations, with a label if there is space
+        for (const auto& job : currentResult->problem.jobs) {
+            sf::Color color = jobColor(job->jobId);
+            for (const auto& op : job->operations) {
+                if (op->isScheduled()) {
+                    float y = startY + op->machineId * (machineHeight + gap);
+                    float x = startX + op->startTime * timeScale;
+                    float w = op->processingTime * timeScale;
+                    ganttBatch.addBar(sf::FloatRect(x, y + 2, w, machineHeight - 4), color, sf::Color(255, 255, 255, 100));
+                    if (fontLoaded && w > 15) {
+                        ganttText.add(std::to_string(job->jobId), 10, {x + w/2, y + machineHeight/2}, sf::Color::Black, {0.5f, 0.5f});
+                    }
+                }
+            }
+        }
         
-        float s = 0.6f;
-        float v = 0.85f;
-        float c = v * s;
-        float x = c * (1 - std::abs(fmod(hue / 60.0f, 2) - 1));
-        float m = v - c;
-        float r=0, g=0, b=0;
+        // Makespan info
+        ganttInfo = sf::Text("Makespan: " + std::to_string(currentResult->makespan), font, 16);
+        ganttInfo.setPosition(startX, startY + numMachines * (machineHeight + gap) + 10);
+        ganttInfo.setFillColor(colorAccent);
         
-        if(hue < 60) { r=c; g=x; b=0; }
-        else if(hue < 120) { r=x; g=c; b=0; }
-        else if(hue < 180) { r=0; g=c; b=x; }
-        else if(hue < 240) { r=0; g=x; b=c; }
-        else if(hue < 300) { r=x; g=0; b=c; }
-        else { r=c; g=0; b=x; }
+        ganttBatchResult = currentResult;
+        ganttBatchSize = window.getSize();
+        viewBatchKey.clear();
+    }
+    ganttBatch.draw(window);
+    ganttText.draw(window);
+    if (fontLoaded) {
+        window.draw(ganttInfo);
+    }
+}
+
+// Draw the solution open in viewer mode. The visible rows are decoded only
+// when the time window or layout changes; other frames redraw the cached
+// spans, at most one per pixel column and row.
+void BaseUI::drawSolutionView() {
+    float margin = 30;
+    float startX = sidebarWidth + margin + 40; // Space for labels
+    float startY = headerHeight + margin + 40; // Space for axis
+    float availableWidth = window.getSize().x - startX - margin;
+    float availableHeight = window.getSize().y - startY - margin - 30; // Space for info
+    if (availableWidth < 1 || availableHeight < 1) return;
+    
+    int numMachines = solutionView->getNumMachines();
+    float gap = 4;
+    float machineHeight = std::max(16.0f, std::min(50.0f, availableHeight / std::max(1, numMachines) - gap));
+    int rows = std::min(numMachines - viewFirstMachine, std::max(1, static_cast<int>(availableHeight / (machineHeight + gap))));
+    viewArea = sf::FloatRect(startX, startY, availableWidth, rows * (machineHeight + gap));
+    
+    double timeScale = availableWidth / static_cast<double>(viewTo - viewFrom);
+    long long timeStep = std::max(1LL, (viewTo - viewFrom) / 10);
+    long long firstTick = (viewFrom + timeStep - 1) / timeStep * timeStep;
+    
+    std::string key = std::to_string(viewFrom) + ":" + std::to_string(viewTo) + ":" + std::to_string(viewFirstMachine) +
+                      ":" + std::to_string(rows) + ":" + std::to_string(availableWidth);
+    if (key != viewBatchKey) {
+        try {
+            buildViewRows(rows, availableWidth);
+        } catch (const std::exception& e) {
+            logToConsole("Error reading solution: " + std::string(e.what()));
+            solutionView.reset();
+            viewRows.clear();
+            viewBatchKey.clear();
+            return;
+        }
+        ganttBatch.clear();
+        ganttText.clear();
         
-        sf::Color jobColor((r+m)*255, (g+m)*255, (b+m)*255);
+        // Time axis, grid and labels
+        ganttBatch.addBackground(sf::FloatRect(startX, startY - 10, availableWidth, 1), sf::Color(100, 100, 100));
+        for (long long t = firstTick; t <= viewTo; t += timeStep) {
+            float x = startX + static_cast<float>((t - viewFrom) * timeScale);
+            ganttBatch.addBackground(sf::FloatRect(x, startY - 10, 1, viewArea.height), sf::Color(30, 30, 30));
+            if (fontLoaded) {
+                ganttText.add(std::to_string(t), 10, {x, startY - 25}, sf::Color(150, 150, 150), {0.5f, 0});
+            }
+        }
         
-        for (const auto& op : job->operations) {
-            if (op->isScheduled()) {
-                float y = startY + op->machineId * (machineHeight + gap);
-                float x = startX + op->startTime * timeScale;
-                float w = op->processingTime * timeScale;
-                
-                sf::RectangleShape rect({w, machineHeight - 4});
-                rect.setPosition(x, y + 2);
-                rect.setFillColor(jobColor);
-                rect.setOutlineThickness(1);
-                rect.setOutlineColor(sf::Color(255, 255, 255, 100));
-                
-                window.draw(rect);
-                
-                // Job ID if space
-                if (fontLoaded && w > 15) {
-                    sf::Text idText(std::to_string(job->jobId), font, 10);
-                    idText.setOrigin(idText.getLocalBounds().width/2, idText.getLocalBounds().height/2);
-                    idText.setPosition(x + w/2, y + machineHeight/2);
-                    idText.setFillColor(sf::Color::Black);
-                    window.draw(idText);
+        // Machine tracks, labels and operations
+        for (int i = 0; i < rows; ++i) {
+            float y = startY + i * (machineHeight + gap);
+            sf::FloatRect track(startX, y, availableWidth, machineHeight);
+            ganttBatch.addBackground(track, sf::Color(25, 25, 28));
+            ganttBatch.addFrame(track, sf::Color(40, 40, 40));
+            if (fontLoaded) {
+                ganttText.add("M" + std::to_string(viewFirstMachine + i), 14, {startX - 15, y + machineHeight/2}, colorTextMain, {1, 0.5f});
+            }
+            
+            for (const ViewSpan& span : viewRows[i]) {
+                sf::FloatRect bar(startX + span.x, y + 2, span.width, machineHeight - 4);
+                if (span.packed) {
+                    ganttBatch.addBar(bar, span.jobId >= 0 ? jobColor(span.jobId) : sf::Color(120, 120, 120));
+                } else {
+                    ganttBatch.addBar(bar, jobColor(span.jobId), sf::Color(255, 255, 255, 100));
+                    if (fontLoaded && span.width > 15) {
+                        ganttText.add(std::to_string(span.jobId), 10, {bar.left + span.width/2, y + machineHeight/2}, sf::Color::Black, {0.5f, 0.5f});
+                    }
                 }
             }
         }
+        
+        // Makespan and window info
+        ganttInfo = sf::Text("Makespan: " + std::to_string(solutionView->getMakespan()) +
+                             "  |  Time " + std::to_string(viewFrom) + "-" + std::to_string(viewTo) +
+                             "  |  Machines " + std::to_string(viewFirstMachine) + "-" + std::to_string(viewFirstMachine + rows - 1) +
+                             " of " + std::to_string(numMachines) + "  |  " + std::to_string(solutionView->getNumEntries()) +
+                             " operations (scroll to zoom, arrow keys to pan, Home to reset)", font, 16);
+        ganttInfo.setPosition(startX, startY + viewArea.height + 10);
+        ganttInfo.setFillColor(colorAccent);
+        
+        viewBatchKey = key;
+        ganttBatchResult.reset();
     }
-    
-    // Makespan info
+    ganttBatch.draw(window);
+    ganttText.draw(window);
     if (fontLoaded) {
-        sf::Text info("Makespan: " + std::to_string(currentResult->makespan), font, 16);
-        info.setPosition(startX, startY + numMachines * (machineHeight + gap) + 10);
-        info.setFillColor(colorAccent);
-        window.draw(info);
+        window.draw(ganttInfo);
     }
 }
 
+// Decode the visible rows of the viewer into pixel spans, merging runs of
+// operations narrower than a pixel.
+void BaseUI::buildViewRows(int rows, float width) {
+    double scale = width / static_cast<double>(viewTo - viewFrom);
+    int from = static_cast<int>(viewFrom);
+    int to = static_cast<int>(viewTo);
+    viewRows.resize(rows);
+    for (int i = 0; i < rows; ++i) {
+        std::vector<ViewSpan>& spans = viewRows[i];
+        spans.clear();
+        solutionView->visit(viewFirstMachine + i, from, to, [&](const Operation& op) {
+            float x0 = static_cast<float>(std::max(0.0, (op.startTime - viewFrom) * scale));
+            float x1 = static_cast<float>(std::min<double>(width, (op.endTime - viewFrom) * scale));
+            bool narrow = x1 - x0 < 1.0f;
+            if (narrow && !spans.empty() && spans.back().packed && x0 <= spans.back().x + spans.back().width + 1.0f) {
+                ViewSpan& last = spans.back();
+                last.width = std::max(last.width, x1 - last.x);
+                if (last.jobId != op.jobId) last.jobId = -1;
+                return;
+            }
+            spans.push_back({x0, std::max(x1 - x0, 1.0f), op.jobId, narrow});
+        });
+    }
+}
+
+// Zoom the viewer around an anchor point of the time window.
+void BaseUI::zoomSolutionView(double factor, double anchor) {
+    double span = static_cast<double>(viewTo - viewFrom);
+    double length = std::min<double>(viewLimit(*solutionView), std::max(10.0, span * factor));
+    double at = viewFrom + anchor * span;
+    viewFrom = std::llround(at - anchor * length);
+    viewTo = viewFrom + std::llround(length);
+    panSolutionView(0, 0);
+}
+
+// Pan the viewer, keeping the window on the time axis and the rows in range.
+void BaseUI::panSolutionView(double fraction, int rows) {
+    long long limit = viewLimit(*solutionView);
+    long long length = std::max(1LL, std::min(limit, viewTo - viewFrom));
+    viewFrom += std::llround(fraction * length);
+    viewFrom = std::max(0LL, std::min(viewFrom, limit - length));
+    viewTo = viewFrom + length;
+    viewFirstMachine = std::max(0, std::min(viewFirstMachine + rows, solutionView->getNumMachines() - 1));
+}
+
 // Log message to console.
 void BaseUI::logToConsole(const std::string& message) {
     consoleLines.push_back("> " + message);
     if (consoleLines.size() > 100) consoleLines.erase(consoleLines.begin());
 }
 
+// Queue a console message from an export job.
+void BaseUI::postToConsole(const std::string& message) {
+    std::lock_guard<std::mutex> lock(exportLogMutex);
+    exportLog.push_back(message);
+}
+
+// Move messages posted by export jobs into the console (UI thread only).
+void BaseUI::drainExportLog() {
+    std::vector<std::string> lines;
+    {
+        std::lock_guard<std::mutex> lock(exportLogMutex);
+        lines.swap(exportLog);
+    }
+    for (const auto& line : lines) {
+        logToConsole(line);
+    }
+}
+
 // Load problem file.
 void BaseUI::loadFile(const std::string& filename) {
     std::string path_to_load = filename;
@@ -694,6 +934,7 @@ void BaseUI::loadFile(const std::string& filename) {
         logToConsole("Loaded file: " + filename);
         logToConsole("Jobs: " + std::to_string(currentProblem->numJobs) + ", Machines: " + std::to_string(currentProblem->numMachines));
         currentResult = nullptr; // Reset result
+        solutionView.reset();
     } catch (const std::exception& e) {
         logToConsole("Error loading file: " + std::string(e.what()));
     }
@@ -707,7 +948,9 @@ void BaseUI::solve() {
     }
     logToConsole("Solving with " + std::string(selectedAlgo == SchedulingAlgorithm::FIFO ? "FIFO" : 
                                               selectedAlgo == SchedulingAlgorithm::SPT ? "SPT" : 
-                                              "LPT") + "...");
+                                              selectedAlgo == SchedulingAlgorithm::LPT ? "LPT" : 
+                                              selectedAlgo == SchedulingAlgorithm::LNS ? "LNS" : 
+                                              "Islands") + "...");
     
     // Force draw to show progress
     window.clear(colorBg);
@@ -718,6 +961,7 @@ void BaseUI::solve() {
     
     auto solver = std::make_shared<Solver>(selectedAlgo);
     currentResult = solver->solve(currentProblem);
+    solutionView.reset();
     logToConsole("Solved! Makespan: " + std::to_string(currentResult->makespan));
     currentView = ViewMode::GanttChart; // Switch to Gantt
 }
@@ -736,10 +980,12 @@ void BaseUI::showMessage(const std::string& title, const std::string& message) {
     logToConsole("[" + title + "] " + message);
 }
 
-// Export Gantt chart interactively.
+// Export Gantt chart interactively. Rendering needs the graphics context, so
+// the chart is drawn here and only the PNG encoding runs in the background.
 void BaseUI::exportGanttChartInteractive() {
     if (!currentResult) {
-        logToConsole("Error: No results to export.");
+        logToConsole(solutionView ? "Error: Solutions open in viewer mode cannot be exported."
+                                  : "Error: No results to export.");
         return;
     }
     
@@ -750,22 +996,42 @@ void BaseUI::exportGanttChartInteractive() {
     // Generate filename with timestamp
     std::string filename = ganttDir + "/gantt_" + std::to_string(std::time(nullptr)) + ".png";
     
-    logToConsole("Exporting Gantt chart to PNG...");
+    logToConsole("Rendering Gantt chart...");
     
+    sf::Image image;
     try {
-        // Use GanttChartMaker to save the chart
         auto ganttMaker = std::make_shared<GanttChartMaker>();
-        ganttMaker->saveToFile(currentResult, filename);
-        logToConsole("Gantt chart exported to: " + filename);
+        image = ganttMaker->renderToImage(currentResult);
     } catch (const std::exception& e) {
         logToConsole("Error exporting Gantt chart: " + std::string(e.what()));
+        return;
+    }
+    if (image.getSize().x == 0) {
+        logToConsole("Error exporting Gantt chart: could not render the chart.");
+        return;
     }
+    
+    exportsPending++;
+    logToConsole("Encoding " + std::to_string(image.getSize().x) + "x" + std::to_string(image.getSize().y) +
+                 " PNG in the background...");
+    exportQueue->submit([this, image = std::move(image), filename]() {
+        auto begin = std::chrono::steady_clock::now();
+        if (image.saveToFile(filename)) {
+            postToConsole("Gantt chart exported to: " + filename + " (" + secondsSince(begin) + ")");
+        } else {
+            postToConsole("Error exporting Gantt chart: could not write " + filename);
+        }
+        exportsPending--;
+    });
 }
 
-// Export solution to file.
+// Export solution to file. The formats are written one after another by the
+// export queue from a snapshot, so the UI stays responsive and the current
+// result can change while the export runs.
 void BaseUI::exportSolutionInteractive() {
     if (!currentResult) {
-        logToConsole("Error: No results to export.");
+        logToConsole(solutionView ? "Error: Solutions open in viewer mode cannot be exported."
+                                  : "Error: No results to export.");
         return;
     }
     std::string homeDir = std::getenv("HOME");
@@ -773,42 +1039,43 @@ void BaseUI::exportSolutionInteractive() {
     std::filesystem::create_directories(solutionsDir);
     std::string baseFilename = solutionsDir + "/solution_" + std::to_string(std::time(nullptr));
     
-    logToConsole("Exporting solution in multiple formats...");
-    
-    int successCount = 0;
-    
-    // Export as TEXT
-    try {
-        SolutionSerializer::exportSolution(currentResult, baseFilename + ".txt", ExportFormat::TEXT);
-        logToConsole("[OK] Exported TEXT: " + baseFilename + ".txt");
-        successCount++;
-    } catch (const std::exception& e) {
-        logToConsole("[FAIL] TEXT export failed: " + std::string(e.what()));
-    }
-    
-    // Export as JSON
-    try {
-        SolutionSerializer::exportSolution(currentResult, baseFilename + ".json", ExportFormat::JSON);
-        logToConsole("[OK] Exported JSON: " + baseFilename + ".json");
-        successCount++;
-    } catch (const std::exception& e) {
-        logToConsole("[FAIL] JSON export failed: " + std::string(e.what()));
-    }
-    
-    // Export as XML
-    try {
-        SolutionSerializer::exportSolution(currentResult, baseFilename + ".xml", ExportFormat::XML);
-        logToConsole("[OK] Exported XML: " + baseFilename + ".xml");
-        successCount++;
-    } catch (const std::exception& e) {
-        logToConsole("[FAIL] XML export failed: " + std::string(e.what()));
-    }
-    
-    if (successCount > 0) {
-        logToConsole("Successfully exported " + std::to_string(successCount) + "/3 formats to: " + solutionsDir);
-    } else {
-        logToConsole("Error: All exports failed.");
-    }
+    std::shared_ptr<ScheduleResult> snapshot = snapshotResult(*currentResult);
+    int pending = ++exportsPending;
+    logToConsole("Exporting solution in multiple formats (" + std::to_string(snapshot->problem.getTotalOperations()) +
+                 " operations)" + (pending > 1 ? ", after " + std::to_string(pending - 1) + " queued export(s)" : "") +
+                 "...");
+    
+    exportQueue->submit([this, snapshot, baseFilename, solutionsDir]() {
+        const std::array<std::pair<ExportFormat, const char*>, 4> formats = {{
+            {ExportFormat::TEXT, "TEXT"}, {ExportFormat::JSON, "JSON"},
+            {ExportFormat::XML, "XML"}, {ExportFormat::BINARY, "BINARY"}
+        }};
+        const std::array<const char*, 4> extensions = {".txt", ".json", ".xml", ".jsol"};
+        
+        auto begin = std::chrono::steady_clock::now();
+        int successCount = 0;
+        for (size_t i = 0; i < formats.size(); ++i) {
+            std::string filename = baseFilename + extensions[i];
+            std::string step = "(" + std::to_string(i + 1) + "/" + std::to_string(formats.size()) + ") ";
+            auto formatBegin = std::chrono::steady_clock::now();
+            try {
+                SolutionSerializer::exportSolution(snapshot, filename, formats[i].first);
+                postToConsole("[OK] " + step + "Exported " + formats[i].second + ": " + filename + " (" +
+                              secondsSince(formatBegin) + ")");
+                successCount++;
+            } catch (const std::exception& e) {
+                postToConsole("[FAIL] " + step + formats[i].second + " export failed: " + std::string(e.what()));
+            }
+        }
+        
+        if (successCount > 0) {
+            postToConsole("Successfully exported " + std::to_string(successCount) + "/4 formats to: " + solutionsDir +
+                          " in " + secondsSince(begin));
+        } else {
+            postToConsole("Error: All exports failed.");
+        }
+        exportsPending--;
+    });
 }
 
 // Open file browser for problem file.
@@ -847,7 +1114,7 @@ void BaseUI::browseForFile() {
 // Load solution from file.
 void BaseUI::loadSolutionInteractive() {
     logToConsole("Please use the file dialog to load a solution.");
-    std::string command = "zenity --file-selection --title=\"Load JSSP Solution\" --file-filter=\"*.txt *.json *.xml\" 2>/dev/null";
+    std::string command = "zenity --file-selection --title=\"Load JSSP Solution\" --file-filter=\"*.txt *.json *.xml *.jsol\" 2>/dev/null";
     std::unique_ptr<FILE, decltype(&pclose)> pipe(popen(command.c_str(), "r"), pclose);
     if (!pipe) return;
     char buffer[128];
@@ -855,14 +1122,38 @@ void BaseUI::loadSolutionInteractive() {
     while (fgets(buffer, sizeof(buffer), pipe.get()) != nullptr) result += buffer;
     if (!result.empty() && result.back() == '\n') result.pop_back();
     if (!result.empty()) {
-        try {
-            currentResult = Parser::loadSolution(result);
-            if (currentResult) {
-                logToConsole("Solution loaded. Makespan: " + std::to_string(currentResult->makespan));
+        loadSolutionFromFile(result);
+    }
+}
+
+// Load solution from file. Large binary solutions are opened in viewer mode
+// instead of being decoded into a ScheduleResult.
+void BaseUI::loadSolutionFromFile(const std::string& filename) {
+    try {
+        if (BinarySolution::isBinary(filename)) {
+            auto view = std::make_unique<BinarySolutionView>(filename);
+            if (view->getNumEntries() >= VIEWER_MIN_ENTRIES) {
+                solutionView = std::move(view);
+                currentResult = nullptr;
+                viewFrom = 0;
+                viewTo = viewLimit(*solutionView);
+                viewFirstMachine = 0;
+                viewRows.clear();
+                viewBatchKey.clear();
+                logToConsole("Solution opened in viewer mode (" + std::to_string(solutionView->getNumEntries()) +
+                             " operations). Makespan: " + std::to_string(solutionView->getMakespan()));
                 currentView = ViewMode::GanttChart;
+                return;
             }
-        } catch (const std::exception& e) {
-            logToConsole("Error: " + std::string(e.what()));
         }
+        auto loaded = Parser::loadSolution(filename);
+        if (loaded) {
+            currentResult = loaded;
+            solutionView.reset();
+            logToConsole("Solution loaded. Makespan: " + std::to_string(currentResult->makespan));
+            currentView = ViewMode::GanttChart;
+        }
+    } catch (const std::exception& e) {
+        logToConsole("Error: " + std::string(e.what()));
     }
 }